@@ -113,7 +113,7 @@ def normalize_inputs(request: InferRequestBase, inputs: dict) -> dict:
 class InferRequest(InferRequestBase):
     """InferRequest class represents infer request which can be run in asynchronous or synchronous manners."""
 
-    def infer(self, inputs: Any = None) -> dict:
+    def infer(self, inputs: Any = None, share_outputs: bool = False) -> dict:
         """Infers specified input(s) in synchronous mode.
 
         Blocks all methods of InferRequest while request is running.
@@ -137,31 +137,34 @@ class InferRequest(InferRequestBase):
 
         :param inputs: Data to be set on input tensors.
         :type inputs: Any, optional
+        :param share_outputs: If `True`, results are views of the output tensors instead of copies.
+                              They are overwritten by the next inference of this InferRequest.
+        :type share_outputs: bool, optional
         :return: Dictionary of results from output tensors with ports as keys.
         :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         """
         # If inputs are empty, pass empty dictionary.
         if inputs is None:
-            return super().infer({})
+            return super().infer({}, share_outputs)
         # If inputs are dict, normalize dictionary and call infer method.
         elif isinstance(inputs, dict):
-            return super().infer(normalize_inputs(self, inputs))
+            return super().infer(normalize_inputs(self, inputs), share_outputs)
         # If inputs are list or tuple, enumarate inputs and save them as dictionary.
         # It is an extension of above branch with dict inputs.
         elif isinstance(inputs, (list, tuple)):
-            return super().infer(normalize_inputs(self, {index: input for index, input in enumerate(inputs)}))
+            return super().infer(normalize_inputs(self, {index: input for index, input in enumerate(inputs)}), share_outputs)
         # If inputs are Tensor, call infer method directly.
         elif isinstance(inputs, Tensor):
-            return super().infer(inputs)
+            return super().infer(inputs, share_outputs)
         # If inputs are single numpy array or scalars, use helper function to copy them
         # directly to Tensor or create temporary Tensor to pass into the InferRequest.
         # Pass empty dictionary to infer method, inputs are already set by helper function.
         elif isinstance(inputs, (np.ndarray, np.number, int, float)):
             update_tensor(inputs, self)
-            return super().infer({})
+            return super().infer({}, share_outputs)
         elif hasattr(inputs, "__array__"):
             update_tensor(np.array(inputs, copy=True), self)
-            return super().infer({})
+            return super().infer({}, share_outputs)
         else:
             raise TypeError(f"Incompatible inputs of type: {type(inputs)}")
 
@@ -318,6 +318,33 @@ void regclass_AsyncInferQueue(py::module m) {
             :type callback: function
         )");
 
+    cls.def(
+        "set_output_buffers",
+        [](AsyncInferQueue& self, const std::vector<py::dict>& buffers) {
+            if (buffers.size() != self.m_requests.size()) {
+                throw py::value_error("Number of output buffers " + std::to_string(buffers.size()) +
+                                      " doesn't match the number of jobs " + std::to_string(self.m_requests.size()));
+            }
+            for (size_t handle = 0; handle < self.m_requests.size(); handle++) {
+                self.m_requests[handle].set_output_buffers(buffers[handle]);
+            }
+        },
+        py::arg("buffers"),
+        R"(
+            Sets numpy arrays as output tensors of every InferRequest in the pool without copying.
+            The requests write the results directly to the arrays, so the pipeline doesn't
+            allocate memory for the outputs. Results of a finished request can be read
+            from its arrays in the callback.
+
+            .. code-block:: python
+
+                buffers = [{0: np.empty(shape, dtype=np.float32)} for _ in range(len(async_infer_queue))]
+                async_infer_queue.set_output_buffers(buffers)
+
+            :param buffers: Output buffers for each InferRequest from the pool.
+            :type buffers: List[Dict[Union[int, str, openvino.runtime.ConstOutput], numpy.ndarray]]
+        )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
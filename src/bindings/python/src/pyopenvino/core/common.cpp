@@ -207,6 +207,29 @@ const Containers::TensorIndexMap cast_to_tensor_index_map(const py::dict& inputs
     return result_map;
 }
 
+void set_request_output_buffers(ov::InferRequest& request, const py::dict& buffers) {
+    for (auto&& buffer : buffers) {
+        if (!py::isinstance<py::array>(buffer.second)) {
+            throw py::type_error("Output buffers must be numpy arrays!");
+        }
+        auto array = buffer.second.cast<py::array>();
+        if (!(array.flags() & py::array::writeable)) {
+            throw ov::Exception("Output buffers must be writeable numpy arrays!");
+        }
+        auto tensor = Common::tensor_from_numpy(array, true);
+        // Check if key is compatible, should be port/string/integer
+        if (py::isinstance<ov::Output<const ov::Node>>(buffer.first)) {
+            request.set_tensor(buffer.first.cast<ov::Output<const ov::Node>>(), tensor);
+        } else if (py::isinstance<py::str>(buffer.first)) {
+            request.set_tensor(buffer.first.cast<std::string>(), tensor);
+        } else if (py::isinstance<py::int_>(buffer.first)) {
+            request.set_output_tensor(buffer.first.cast<size_t>(), tensor);
+        } else {
+            throw py::type_error("Incompatible key type for output buffer!");
+        }
+    }
+}
+
 void set_request_tensors(ov::InferRequest& request, const py::dict& inputs) {
     if (!inputs.empty()) {
         for (auto&& input : inputs) {
@@ -243,10 +266,18 @@ uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual) {
     }
 }
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request) {
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool share_outputs) {
     py::dict res;
     for (const auto& out : outputs) {
         ov::Tensor t{request.get_tensor(out)};
+        if (share_outputs && t.get_element_type().bitwidth() >= 8) {
+            // The array is a view of the output tensor, the tensor is kept alive by the array
+            auto dtype = Common::ov_type_to_dtype().at(t.get_element_type());
+            res[py::cast(out)] = py::array(dtype, t.get_shape(), t.get_strides(), t.data(), py::cast(t));
+            continue;
+        }
         switch (t.get_element_type()) {
         case ov::element::Type_t::i8: {
             res[py::cast(out)] = py::array_t<int8_t>(t.get_shape(), t.data<int8_t>());
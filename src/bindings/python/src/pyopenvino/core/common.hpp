@@ -44,9 +44,16 @@ const Containers::TensorIndexMap cast_to_tensor_index_map(const py::dict& inputs
 
 void set_request_tensors(ov::InferRequest& request, const py::dict& inputs);
 
+// Sets numpy arrays as output tensors of the request without copying, the arrays must be kept alive by the caller
+void set_request_output_buffers(ov::InferRequest& request, const py::dict& buffers);
+
 uint32_t get_optimal_number_of_requests(const ov::CompiledModel& actual);
 
-py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs, ov::InferRequest& request);
+// If share_outputs is true, the arrays are views of the output tensors instead of copies,
+// so they are overwritten by the next inference of the request
+py::dict outputs_to_dict(const std::vector<ov::Output<const ov::Node>>& outputs,
+                         ov::InferRequest& request,
+                         bool share_outputs = false);
 
 ov::pass::Serialize::Version convert_to_version(const std::string& version);
 
@@ -18,14 +18,24 @@ PYBIND11_MAKE_OPAQUE(Containers::TensorNameMap);
 
 namespace py = pybind11;
 
-inline py::dict run_sync_infer(InferRequestWrapper& self) {
+inline py::dict run_sync_infer(InferRequestWrapper& self, bool share_outputs) {
     {
         py::gil_scoped_release release;
         *self.m_start_time = Time::now();
         self.m_request.infer();
         *self.m_end_time = Time::now();
     }
-    return Common::outputs_to_dict(self.m_outputs, self.m_request);
+    return Common::outputs_to_dict(self.m_outputs, self.m_request, share_outputs);
+}
+
+void InferRequestWrapper::set_output_buffers(const py::dict& buffers) {
+    Common::set_request_output_buffers(m_request, buffers);
+    if (!*m_output_buffers) {
+        *m_output_buffers = py::dict();
+    }
+    for (auto&& buffer : buffers) {
+        (*m_output_buffers)[buffer.first] = buffer.second;
+    }
 }
 
 void regclass_InferRequest(py::module m) {
@@ -38,6 +48,23 @@ void regclass_InferRequest(py::module m) {
             }),
             py::arg("other"));
 
+    // Python API exclusive function
+    cls.def(
+        "set_output_buffers",
+        [](InferRequestWrapper& self, const py::dict& buffers) {
+            self.set_output_buffers(buffers);
+        },
+        py::arg("buffers"),
+        R"(
+            Sets numpy arrays as output tensors without copying.
+            The request writes the results directly to the arrays, so no memory
+            is allocated for the outputs by following inferences.
+            The arrays are kept alive while the InferRequest exists.
+
+            :param buffers: C-contiguous writeable arrays with the type and shape of the outputs.
+            :type buffers: Dict[Union[int, str, openvino.runtime.ConstOutput], numpy.ndarray]
+        )");
+
     // Python API exclusive function
     cls.def(
         "set_tensors",
@@ -171,11 +198,12 @@ void regclass_InferRequest(py::module m) {
     // Overload for single input, it will throw error if a model has more than one input.
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const ov::Tensor& inputs) {
+        [](InferRequestWrapper& self, const ov::Tensor& inputs, bool share_outputs) {
             self.m_request.set_input_tensor(inputs);
-            return run_sync_infer(self);
+            return run_sync_infer(self, share_outputs);
         },
         py::arg("inputs"),
+        py::arg("share_outputs") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -185,6 +213,9 @@ void regclass_InferRequest(py::module m) {
 
             :param inputs: Data to set on single input tensor.
             :type inputs: openvino.runtime.Tensor
+            :param share_outputs: If `True`, results are views of the output tensors instead of copies.
+                                  They are overwritten by the next inference of this InferRequest.
+            :type share_outputs: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -197,13 +228,14 @@ void regclass_InferRequest(py::module m) {
     // and values are always of type: ov::Tensor.
     cls.def(
         "infer",
-        [](InferRequestWrapper& self, const py::dict& inputs) {
+        [](InferRequestWrapper& self, const py::dict& inputs, bool share_outputs) {
             // Update inputs if there are any
             Common::set_request_tensors(self.m_request, inputs);
             // Call Infer function
-            return run_sync_infer(self);
+            return run_sync_infer(self, share_outputs);
         },
         py::arg("inputs"),
+        py::arg("share_outputs") = false,
         R"(
             Infers specified input(s) in synchronous mode.
             Blocks all methods of InferRequest while request is running.
@@ -213,6 +245,9 @@ void regclass_InferRequest(py::module m) {
 
             :param inputs: Data to set on input tensors.
             :type inputs: Dict[Union[int, str, openvino.runtime.ConstOutput], openvino.runtime.Tensor]
+            :param share_outputs: If `True`, results are views of the output tensors instead of copies.
+                                  They are overwritten by the next inference of this InferRequest.
+            :type share_outputs: bool
             :return: Dictionary of results from output tensors with ports as keys.
             :rtype: Dict[openvino.runtime.ConstOutput, numpy.array]
         )");
@@ -40,6 +40,8 @@ public:
 
         m_start_time = std::make_shared<Time::time_point>(Time::time_point{});
         m_end_time = std::make_shared<Time::time_point>(Time::time_point{});
+        // The dict is created on demand, as the wrapper can be constructed without GIL
+        m_output_buffers = std::make_shared<py::object>();
 
         // Initialize InferRequest with default callback
         if (set_default_callback) {
@@ -69,6 +71,9 @@ public:
         return get_tensors_from(m_outputs);
     }
 
+    // Sets numpy arrays as output tensors without copying and keeps them alive
+    void set_output_buffers(const py::dict& buffers);
+
     double get_latency() {
         auto execTime = std::chrono::duration_cast<ns>(*m_end_time - *m_start_time);
         return static_cast<double>(execTime.count()) * 0.000001;
@@ -86,6 +91,8 @@ public:
     // Times of inference's start and finish
     std::shared_ptr<Time::time_point> m_start_time; // proposal: change to unique_ptr
     std::shared_ptr<Time::time_point> m_end_time;
+    // Numpy arrays set as output tensors, shared by the copies of the wrapper to keep the arrays alive
+    std::shared_ptr<py::object> m_output_buffers;
 
 private:
     inline std::vector<ov::Tensor> get_tensors_from(const std::vector<ov::Output<const ov::Node>>& v) {
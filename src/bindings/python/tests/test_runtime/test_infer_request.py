@@ -981,3 +981,60 @@ def test_convert_infer_request(device):
     with pytest.raises(TypeError) as e:
         deepcopy(res)
     assert "cannot deepcopy 'openvino.runtime.ConstOutput' object." in str(e)
+
+
+def test_infer_share_outputs(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    res = request.infer([arr_1, arr_2], share_outputs=True)
+    result = list(res.values())[0]
+    assert np.array_equal(result, arr_1 + arr_2)
+    # The result is a view of the output tensor, it is overwritten by the next inference
+    assert np.shares_memory(result, request.get_output_tensor().data)
+    request.infer([arr_1, arr_1], share_outputs=True)
+    assert np.array_equal(result, arr_1 + arr_1)
+
+    copied = list(request.infer([arr_2, arr_2]).values())[0]
+    assert not np.shares_memory(copied, request.get_output_tensor().data)
+
+
+def test_set_output_buffers(device):
+    request, arr_1, arr_2 = create_simple_request_and_inputs(device)
+
+    buffer = np.zeros(arr_1.shape, dtype=np.float32)
+    request.set_output_buffers({0: buffer})
+    request.infer([arr_1, arr_2])
+    assert np.array_equal(buffer, arr_1 + arr_2)
+    assert np.shares_memory(buffer, request.get_output_tensor().data)
+
+    with pytest.raises(RuntimeError) as e:
+        request.set_output_buffers({0: np.zeros(arr_1.shape, dtype=np.float32)[:, :1]})
+    assert "must be C contiguous" in str(e.value)
+
+
+def test_infer_queue_set_output_buffers(device):
+    jobs = 3
+    _, arr_1, arr_2 = create_simple_request_and_inputs(device)
+    param_a = ops.parameter(arr_1.shape, np.float32)
+    param_b = ops.parameter(arr_1.shape, np.float32)
+    compiled_model = Core().compile_model(Model(ops.add(param_a, param_b), [param_a, param_b]), device)
+    infer_queue = AsyncInferQueue(compiled_model, jobs)
+
+    buffers = [{0: np.zeros(arr_1.shape, dtype=np.float32)} for _ in range(jobs)]
+    infer_queue.set_output_buffers(buffers)
+    results = [None] * jobs
+
+    def callback(request, job_id):
+        output = request.get_output_tensor().data
+        assert any(np.shares_memory(output, buffer[0]) for buffer in buffers)
+        results[job_id] = np.array(output)
+
+    infer_queue.set_callback(callback)
+    for i in range(jobs):
+        infer_queue.start_async([arr_1 * i, arr_2], i)
+    infer_queue.wait_all()
+    for i in range(jobs):
+        assert np.array_equal(results[i], arr_1 * i + arr_2)
+
+    with pytest.raises(ValueError):
+        infer_queue.set_output_buffers(buffers[:1])
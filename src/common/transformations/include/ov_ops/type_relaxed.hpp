@@ -47,12 +47,7 @@ public:
     /// In case if outputIndex is out of range of known outputs (and this class cannot detect
     /// the real number of outputs for original operation), the number of overridden outputs
     /// is changed according to a given outputIndex value.
-    void set_overridden_output_type(const element::Type& element_type, size_t outputIndex = 0) {
-        if (outputIndex >= m_output_data_types.size()) {
-            m_output_data_types.resize(outputIndex + 1, element::undefined);
-        }
-        m_output_data_types[outputIndex] = element_type;
-    }
+    void set_overridden_output_type(const element::Type& element_type, size_t outputIndex = 0);
 
     /// \return Data type that will be set for input when original shape/type inference function is called.
     /// If index inputIndex hasn't been set before, element::undefined will returned. Undefined means that
@@ -69,12 +64,7 @@ public:
     /// the real number of inputs for original operation), the number of overridden inputs
     /// is changed according to a given inputIndex value. All new entries except one added
     /// at inputIndex position are undefined.
-    void set_origin_input_type(const element::Type& element_type, size_t inputIndex = 0) {
-        if (inputIndex >= m_input_data_types.size()) {
-            m_input_data_types.resize(inputIndex + 1, element::undefined);
-        }
-        m_input_data_types[inputIndex] = element_type;
-    }
+    void set_origin_input_type(const element::Type& element_type, size_t inputIndex = 0);
 
 protected:
     void remember_input_data_types(Node& node, element::TypeVector& old_input_types) {
@@ -4,10 +4,13 @@
 
 #pragma once
 
+#include <map>
 #include <string>
+#include <utility>
 
 #include "ngraph/opsets/opset.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/pass/serialize.hpp"
 
 namespace ov {
@@ -15,11 +18,17 @@ namespace pass {
 
 /**
  * @brief Hash transformation calculates hash value for ov::Model
+ *
+ * The topology is hashed through its deterministic serialized form, the constants contribute only their digests.
+ * The digests may be computed in advance, e.g. in parallel, and passed to the pass.
  */
 class NGRAPH_API Hash : public ov::pass::ModelPass {
 public:
     OPENVINO_RTTI("HashPass");
 
+    /// @brief Digests of the constant data keyed by the data pointer and the size in bytes
+    using ConstantDigests = std::map<std::pair<const void*, size_t>, uint64_t>;
+
     bool run_on_model(const std::shared_ptr<ov::Model>& f) override;
 
     /**
@@ -30,8 +39,26 @@ public:
      */
     Hash(uint64_t& output_hash_value);
 
+    /**
+     * @brief Hash pass constructor
+     *
+     * @param output_hash_value Reference to output value
+     * @param digests Digests of the constants computed with hash_constant for the same model, the constant data
+     * must not change until the pass is run. The constants which are not in the map are hashed by the pass
+     */
+    Hash(uint64_t& output_hash_value, const ConstantDigests& digests);
+
+    /**
+     * @brief Computes the digest of the constant data. Doesn't modify the constant, so it can be called in parallel
+     *
+     * @param constant Constant to hash
+     * @return Digest of the constant data
+     */
+    static uint64_t hash_constant(const ov::op::v0::Constant& constant);
+
 private:
     uint64_t& m_hash;
+    const ConstantDigests* m_digests = nullptr;
 };
 
 }  // namespace pass
@@ -0,0 +1,48 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for definition of abstraction over platform specific shared memory map objects
+ * @file mmap_object.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace ov {
+namespace util {
+
+/**
+ * @brief Read-only view of a file mapped into the process memory. The mapping is released with the object.
+ */
+class MappedMemory {
+public:
+    virtual ~MappedMemory() = default;
+
+    virtual char* data() noexcept = 0;
+    virtual size_t size() const noexcept = 0;
+};
+
+/**
+ * @brief Maps the whole file into the process memory.
+ * @param path Path to the file
+ * @return Reference to the mapped memory
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::string& path);
+
+#ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+/**
+ * @brief Maps the whole file with the wide char name into the process memory.
+ * @param path Path to the file
+ * @return Reference to the mapped memory
+ */
+std::shared_ptr<MappedMemory> load_mmap_object(const std::wstring& path);
+
+#endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+
+}  // namespace util
+}  // namespace ov
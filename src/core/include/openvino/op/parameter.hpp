@@ -49,9 +49,7 @@ public:
     const element::Type& get_element_type() const {
         return m_element_type;
     }
-    void set_element_type(const element::Type& element_type) {
-        m_element_type = element_type;
-    }
+    void set_element_type(const element::Type& element_type);
 
     /// \brief Returns current layout, or empty Layout if it is not set
     Layout get_layout() const;
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <functional>
+
 #include "openvino/core/runtime_attribute.hpp"
 #include "openvino/pass/pass.hpp"
 
@@ -19,6 +21,15 @@ namespace pass {
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_RTTI("ConstantFolding");
+    /// \brief Calls `body(i)` for every i in [0, count) and returns when all the calls are done.
+    /// The calls may be made concurrently from several threads.
+    using ParallelExecutor = std::function<void(size_t count, const std::function<void(size_t)>& body)>;
+
+    ConstantFolding() = default;
+    /// \brief The independent nodes and the large tensors are folded with `executor`, e.g. the
+    /// threading of the plugin which runs the pass. Without an executor the pass folds sequentially.
+    explicit ConstantFolding(ParallelExecutor executor) : m_executor(std::move(executor)) {}
+
     bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 
 protected:
@@ -26,6 +37,15 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Folds the nodes with constant inputs level by level, the nodes of the same level
+    /// are independent and are evaluated in parallel when they produce enough data.
+    /// Only the operations with side effect free evaluation are folded here, the rest of the
+    /// nodes is left for the sequential traversal.
+    bool parallel_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Replaces the outputs of the folded node with the folded values.
+    bool replace_folded_outputs(const std::shared_ptr<Node>& node, const OutputVector& replacements);
+
+    ParallelExecutor m_executor;
 };
 
 /**
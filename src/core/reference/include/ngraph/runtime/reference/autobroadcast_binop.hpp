@@ -10,6 +10,7 @@
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/op/util/attr_types.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape_util.hpp"
 
 namespace ngraph {
@@ -99,9 +100,11 @@ void autobroadcast_binop(const T* arg0,
                          Functor elementwise_functor) {
     switch (broadcast_spec.m_type) {
     case op::AutoBroadcastType::NONE:
-        for (size_t i = 0; i < shape_size(arg0_shape); i++) {
-            out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
-        }
+        parallel_for(shape_size(arg0_shape), elementwise_parallel_grain, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                out[i] = static_cast<U>(elementwise_functor(arg0[i], arg1[i]));
+            }
+        });
         break;
     case op::AutoBroadcastType::NUMPY:
         // We'll be using CoordinateTransform to handle the broadcasting. The general
@@ -157,8 +160,10 @@ void autobroadcast_binop(const T* arg0,
             }
 
             if (axis == 0) {
-                for (size_t i = 0, end = strides0[0]; i < end; ++i)
-                    out[i] = elementwise_functor(arg0[i], arg1[i]);
+                parallel_for(strides0[0], elementwise_parallel_grain, [&](size_t begin, size_t end) {
+                    for (size_t i = begin; i < end; ++i)
+                        out[i] = elementwise_functor(arg0[i], arg1[i]);
+                });
             } else if (strides0[axis] == 1 && value_with_padding_or(arg0_shape, padding0, axis, 1) == 1) {
                 axis = calculate_fixed_axis(axis, strides0);
 
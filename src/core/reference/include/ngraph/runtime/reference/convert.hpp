@@ -6,6 +6,7 @@
 
 #include <cstddef>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/type/float16.hpp"
 
@@ -95,9 +96,11 @@ void lp_convert(const TI* arg, TO* out, size_t count, element::Type_t src_type,
 
 template <typename TI, typename TO>
 typename std::enable_if<!std::is_same<TO, char>::value>::type convert(const TI* arg, TO* out, size_t count) {
-    for (size_t i = 0; i < count; ++i) {
-        out[i] = static_cast<TO>(arg[i]);
-    }
+    parallel_for(count, elementwise_parallel_grain, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            out[i] = static_cast<TO>(arg[i]);
+        }
+    });
 }
 
 template <>
@@ -112,9 +115,11 @@ void convert<float16, int8_t>(const float16* arg, int8_t* out, size_t count);
 // overload to handle ngraph::boolean (it is stored as char)
 template <typename TI, typename TO>
 typename std::enable_if<std::is_same<TO, char>::value>::type convert(const TI* arg, TO* out, size_t count) {
-    for (size_t i = 0; i < count; ++i) {
-        out[i] = static_cast<char>(static_cast<bool>(arg[i]));
-    }
+    parallel_for(count, elementwise_parallel_grain, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            out[i] = static_cast<char>(static_cast<bool>(arg[i]));
+        }
+    });
 }
 }  // namespace reference
 
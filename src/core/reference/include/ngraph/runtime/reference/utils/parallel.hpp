@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+/// \brief Minimal number of items of a simple element-wise loop which are worth a separate thread.
+constexpr size_t elementwise_parallel_grain = 32 * 1024;
+
+/// \brief Calls `body(i)` for every i in [0, count), possibly from several threads, and returns
+///        when all the calls are done.
+using ParallelExecutor = std::function<void(size_t count, const std::function<void(size_t)>& body)>;
+
+/// \brief Allows parallel_for to distribute the work with `executor` on the current thread for
+///        the lifetime of the object.
+///
+/// Core has no threading runtime of its own, so the executor is provided by the caller, e.g. the
+/// constant folding pass gets it from the plugin. Reference kernels are also executed by plugins
+/// from their own worker threads, so they run serially outside of a scope or with an empty executor.
+class ParallelScope {
+public:
+    explicit ParallelScope(const ParallelExecutor& executor);
+    ~ParallelScope();
+
+    ParallelScope(const ParallelScope&) = delete;
+    ParallelScope& operator=(const ParallelScope&) = delete;
+
+private:
+    const ParallelExecutor* m_executor;
+};
+
+/// \brief Splits the range [0, count) into chunks of at least `grain` items and calls
+///        `body(begin, end)` for each of them.
+///
+/// The chunks are distributed with the executor of the innermost ParallelScope,
+/// otherwise and for the nested calls made from `body` the range is processed inline.
+/// The first exception thrown by `body` is rethrown to the caller.
+///
+/// \param count Number of items to process.
+/// \param grain Minimal number of items processed by a single call of `body`.
+/// \param body Functor processing the items [begin, end).
+void parallel_for(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body);
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
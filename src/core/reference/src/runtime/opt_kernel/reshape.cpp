@@ -9,6 +9,7 @@
 
 #include "ngraph/check.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 
 using namespace ngraph;
 
@@ -27,7 +28,9 @@ void reshape_in1(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t begin,
+                 size_t end) {
     size_t size[1];
     size_t in_index[1];
     size_t* map_index[1];
@@ -35,7 +38,7 @@ void reshape_in1(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = begin; in_index[0] < end; ++in_index[0]) {
         memcpy(out, in + *map_index[0] * elem_size, elem_size);
         out += elem_size;
     }
@@ -46,7 +49,9 @@ void reshape_in2(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t begin,
+                 size_t end) {
     size_t size[2];
     size_t in_index[2];
     size_t* map_index[2];
@@ -54,7 +59,7 @@ void reshape_in2(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = begin; in_index[0] < end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             // clang-format off
                 memcpy(out,
@@ -72,7 +77,9 @@ void reshape_in3(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t begin,
+                 size_t end) {
     size_t size[3];
     size_t in_index[3];
     size_t* map_index[3];
@@ -80,7 +87,7 @@ void reshape_in3(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = begin; in_index[0] < end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
                 // clang-format off
@@ -101,7 +108,9 @@ void reshape_in4(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t begin,
+                 size_t end) {
     size_t size[4];
     size_t in_index[4];
     size_t* map_index[4];
@@ -109,7 +118,7 @@ void reshape_in4(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = begin; in_index[0] < end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
                 for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
@@ -133,7 +142,9 @@ void reshape_in5(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t begin,
+                 size_t end) {
     size_t size[5];
     size_t in_index[5];
     size_t* map_index[5];
@@ -141,7 +152,7 @@ void reshape_in5(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = begin; in_index[0] < end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
                 for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
@@ -168,7 +179,9 @@ void reshape_in6(const char* in,
                  const Shape& in_shape,
                  const AxisVector& in_axis_order,
                  const Shape& out_shape,
-                 size_t elem_size) {
+                 size_t elem_size,
+                 size_t begin,
+                 size_t end) {
     size_t size[6];
     size_t in_index[6];
     size_t* map_index[6];
@@ -176,7 +189,7 @@ void reshape_in6(const char* in,
         size[i] = in_shape[in_axis_order[i]];
         map_index[in_axis_order[i]] = &in_index[i];
     }
-    for (in_index[0] = 0; in_index[0] < size[0]; ++in_index[0]) {
+    for (in_index[0] = begin; in_index[0] < end; ++in_index[0]) {
         for (in_index[1] = 0; in_index[1] < size[1]; ++in_index[1]) {
             for (in_index[2] = 0; in_index[2] < size[2]; ++in_index[2]) {
                 for (in_index[3] = 0; in_index[3] < size[3]; ++in_index[3]) {
@@ -200,6 +213,10 @@ void reshape_in6(const char* in,
         }
     }
 }
+
+// the data is copied element by element, so even the moderate tensors are worth splitting
+constexpr size_t min_parallel_bytes = 64 * 1024;
+
 bool no_axis_reordering(const AxisVector& axis_order) {
     auto tmp = axis_order;
     std::sort(begin(tmp), end(tmp));
@@ -218,30 +235,43 @@ void runtime::opt_kernel::reshape(const char* in,
         return;
     }
 
+    using reshape_fn =
+        void (*)(const char*, char*, const Shape&, const AxisVector&, const Shape&, size_t, size_t, size_t);
+    reshape_fn reshape_in = nullptr;
     switch (in_shape.size()) {
     case 0:
         reshape_in0(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
+        return;
     case 1:
-        reshape_in1(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in = reshape_in1;
         break;
     case 2:
-        reshape_in2(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in = reshape_in2;
         break;
     case 3:
-        reshape_in3(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in = reshape_in3;
         break;
     case 4:
-        reshape_in4(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in = reshape_in4;
         break;
     case 5:
-        reshape_in5(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in = reshape_in5;
         break;
     case 6:
-        reshape_in6(in, out, in_shape, in_axis_order, out_shape, elem_size);
+        reshape_in = reshape_in6;
         break;
     default:
         reference::reshape(in, out, in_shape, in_axis_order, out_shape, elem_size);
-        break;
+        return;
     }
+
+    // the outermost output dimension is split between the threads, every part of it is a contiguous block of output
+    const size_t outer_size = in_shape[in_axis_order[0]];
+    if (outer_size == 0)
+        return;
+    const size_t inner_bytes = shape_size(in_shape) / outer_size * elem_size;
+    const size_t grain = std::max<size_t>(1, min_parallel_bytes / std::max<size_t>(inner_bytes, 1));
+    reference::parallel_for(outer_size, grain, [&](size_t begin, size_t end) {
+        reshape_in(in, out + begin * inner_bytes, in_shape, in_axis_order, out_shape, elem_size, begin, end);
+    });
 }
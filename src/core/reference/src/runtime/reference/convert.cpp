@@ -183,14 +183,16 @@ template <typename TI, typename TO>
 void convert_impl(const TI* arg, TO* out, size_t count) {
     auto converter = jit_convert_array::get<TI, TO>();
 
-    if (converter) {
-        jit_convert_array::args_t args = {arg, out, count};
-        converter(&args);
-    } else {
-        for (size_t i = 0; i < count; ++i) {
-            out[i] = static_cast<TO>(arg[i]);
+    parallel_for(count, elementwise_parallel_grain, [&](size_t begin, size_t end) {
+        if (converter) {
+            jit_convert_array::args_t args = {arg + begin, out + begin, end - begin};
+            converter(&args);
+        } else {
+            for (size_t i = begin; i < end; ++i) {
+                out[i] = static_cast<TO>(arg[i]);
+            }
         }
-    }
+    });
 }
 }  // namespace
 
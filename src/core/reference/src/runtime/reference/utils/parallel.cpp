@@ -0,0 +1,75 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph/runtime/reference/utils/parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace ngraph {
+namespace runtime {
+namespace reference {
+namespace {
+// the executor is dropped while the chunks are processed, so the nested parallel_for calls run inline
+thread_local const ParallelExecutor* parallel_executor = nullptr;
+
+// several chunks per thread let the threads which got cheap chunks to pick up the rest of the work
+constexpr size_t chunks_per_thread = 4;
+}  // namespace
+
+ParallelScope::ParallelScope(const ParallelExecutor& executor) : m_executor(parallel_executor) {
+    parallel_executor = executor ? &executor : nullptr;
+}
+
+ParallelScope::~ParallelScope() {
+    parallel_executor = m_executor;
+}
+
+void parallel_for(size_t count, size_t grain, const std::function<void(size_t, size_t)>& body) {
+    if (count == 0)
+        return;
+    grain = std::max<size_t>(grain, 1);
+
+    const size_t max_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    const size_t max_chunks = (count + grain - 1) / grain;
+    const size_t threads_num = std::min(max_threads, max_chunks);
+    const auto executor = parallel_executor;
+    if (!executor || threads_num < 2) {
+        body(0, count);
+        return;
+    }
+
+    const size_t max_chunks_num = threads_num * chunks_per_thread;
+    const size_t chunk = std::max(grain, (count + max_chunks_num - 1) / max_chunks_num);
+    const size_t chunks_num = (count + chunk - 1) / chunk;
+    // not every threading interface passes the exceptions to the caller, so the first one is kept
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    parallel_executor = nullptr;
+    (*executor)(chunks_num, [&](size_t i) {
+        if (failed)
+            return;
+        const size_t begin = i * chunk;
+        try {
+            body(begin, std::min(begin + chunk, count));
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error)
+                error = std::current_exception();
+            failed = true;
+        }
+    });
+    parallel_executor = executor;
+
+    if (error)
+        std::rethrow_exception(error);
+}
+}  // namespace reference
+}  // namespace runtime
+}  // namespace ngraph
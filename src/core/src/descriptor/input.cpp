@@ -9,6 +9,7 @@
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "shared_node_info.hpp"
+#include "validation_tracker.hpp"
 
 ov::descriptor::Input::Input(ov::Node* node, size_t index, Output& output)
     : m_node(node),
@@ -18,6 +19,7 @@ ov::descriptor::Input::Input(ov::Node* node, size_t index, Output& output)
       m_is_relevant_to_value(true) {
     m_src_node = std::shared_ptr<ngraph::Node>(output.get_node());
     output.add_input(this);
+    ValidationTracker::mark(m_node);
 }
 
 ov::descriptor::Input::Input(ov::Node* node, size_t index)
@@ -25,7 +27,9 @@ ov::descriptor::Input::Input(ov::Node* node, size_t index)
       m_index(index),
       m_output(nullptr),
       m_is_relevant_to_shape(false),
-      m_is_relevant_to_value(true) {}
+      m_is_relevant_to_value(true) {
+    ValidationTracker::mark(m_node);
+}
 
 ov::descriptor::Input::~Input() {
     remove_output();
@@ -38,6 +42,7 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<ngraph::Node>(new_output.get_node());
+    ValidationTracker::mark(m_node);
 
     // Output replacement may change the topological order of nodes,
     // so we have to reset cache by setting a flag into shared node info.
@@ -28,6 +28,7 @@
 #include "openvino/pass/manager.hpp"
 #include "shared_node_info.hpp"
 #include "transformations/smart_reshape/smart_reshape.hpp"
+#include "validation_tracker.hpp"
 
 using namespace std;
 
@@ -208,7 +209,12 @@ void ov::Model::prerequirements(bool detect_variables, bool detect_parameters) {
 
 void ov::Model::validate_nodes_and_infer_types() const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "Model::validate_nodes_and_infer_types");
+    ov::validate_nodes_and_infer_types(*this, [](ov::Node*) {
+        return true;
+    });
+}
 
+void ov::validate_nodes_and_infer_types(const Model& model, const std::function<bool(Node*)>& revalidate) {
     struct Counter {
         int cnt_assign = 0;
         int cnt_read_val = 0;
@@ -218,8 +224,11 @@ void ov::Model::validate_nodes_and_infer_types() const {
     std::stringstream unregistered_variables;
     std::unordered_set<const ov::descriptor::Tensor*> tensors;
 
-    for (auto& node : get_ordered_ops()) {
-        node->revalidate_and_infer_types();
+    const auto& parameters = model.get_parameters();
+    const auto& variables = model.get_variables();
+    for (auto& node : model.get_ordered_ops()) {
+        if (revalidate(node.get()))
+            node->revalidate_and_infer_types();
         for (const auto& output : node->outputs()) {
             const auto& tensor = output.get_tensor();
             // Skip results outputs tensors because result_input_tensor == result_output_tensor
@@ -228,12 +237,12 @@ void ov::Model::validate_nodes_and_infer_types() const {
             tensors.insert(&tensor);
         }
         if (op::util::is_parameter(node) &&
-            std::find(m_parameters.begin(), m_parameters.end(), node) == m_parameters.end())
+            std::find(parameters.begin(), parameters.end(), node) == parameters.end())
             unregistered_parameters << node << std::endl;
 
         const auto& variable_op = dynamic_pointer_cast<op::util::VariableExtension>(node);
         if (variable_op &&
-            std::find(m_variables.begin(), m_variables.end(), variable_op->get_variable()) == m_variables.end())
+            std::find(variables.begin(), variables.end(), variable_op->get_variable()) == variables.end())
             unregistered_variables << variable_op->get_variable_id() << std::endl;
 
         if (const auto& assign = std::dynamic_pointer_cast<ngraph::op::AssignBase>(node)) {
@@ -255,7 +264,7 @@ void ov::Model::validate_nodes_and_infer_types() const {
     if (!only_pairs)
         throw ov::Exception("Model is incorrect. Assign and ReadValue operations must be in pairs on the "
                             "network.");
-    for (const auto& output : outputs()) {
+    for (const auto& output : model.outputs()) {
         OPENVINO_ASSERT(ov::layout::utils::is_compatible(ov::layout::get_layout(output), output.get_partial_shape()),
                         "Result '",
                         output,
@@ -17,9 +17,11 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/pattern/matcher.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/descriptor/input.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "shared_node_info.hpp"
+#include "validation_tracker.hpp"
 
 using namespace std;
 
@@ -252,8 +254,12 @@ void ov::Node::set_input_is_relevant_to_value(size_t i, bool relevant) {
 }
 
 void ov::Node::set_output_type(size_t i, const element::Type& element_type, const PartialShape& pshape) {
+    const auto& tensor = get_output_descriptor(i).get_tensor_ptr();
+    // the consumers of the changed output have to be revalidated by pass::Manager
+    if (tensor->get_element_type() != element_type || tensor->get_partial_shape() != pshape)
+        ValidationTracker::mark(this);
     OPENVINO_SUPPRESS_DEPRECATED_START
-    get_output_descriptor(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
+    tensor->set_tensor_type(element_type, pshape);
     OPENVINO_SUPPRESS_DEPRECATED_END
 }
 
@@ -841,9 +847,18 @@ bool ov::Node::constant_fold(OutputVector& output_values, const OutputVector& in
     OPENVINO_SUPPRESS_DEPRECATED_START
     if (evaluate(output_tensors, input_tensors)) {
         for (size_t i = 0; i < output_tensors.size(); ++i) {
-            output_values[i] = make_shared<ngraph::op::Constant>(output_tensors[i].get_element_type(),
-                                                                 output_tensors[i].get_shape(),
-                                                                 output_tensors[i].data());
+            const auto& tensor = output_tensors[i];
+            if (tensor.get_byte_size() == 0) {
+                output_values[i] =
+                    make_shared<ngraph::op::Constant>(tensor.get_element_type(), tensor.get_shape(), tensor.data());
+                continue;
+            }
+            // the constant takes over the output memory, the tensor keeps it alive even if evaluate() made the
+            // output refer to an input tensor, as those are copies owned by the tensors as well
+            auto buffer = make_shared<ngraph::runtime::SharedBuffer<ov::Tensor>>(static_cast<char*>(tensor.data()),
+                                                                                   tensor.get_byte_size(),
+                                                                                   tensor);
+            output_values[i] = make_shared<ngraph::op::Constant>(tensor.get_element_type(), tensor.get_shape(), buffer);
         }
         return true;
     }
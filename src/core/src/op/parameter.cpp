@@ -9,6 +9,7 @@
 #include "itt.hpp"
 #include "layout_utils.hpp"
 #include "ngraph/attribute_visitor.hpp"
+#include "validation_tracker.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -67,6 +68,12 @@ void op::Parameter::set_partial_shape(const PartialShape& partial_shape) {
                     get_layout().to_string(),
                     ". Layout is not compatible with shape");
     m_partial_shape = partial_shape;
+    ov::ValidationTracker::mark(this);
+}
+
+void op::Parameter::set_element_type(const element::Type& element_type) {
+    m_element_type = element_type;
+    ov::ValidationTracker::mark(this);
 }
 
 BWDCMP_RTTI_DEFINITION(ov::AttributeAdapter<ParameterVector>);
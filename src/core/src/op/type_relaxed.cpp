@@ -8,8 +8,27 @@
 #include <memory>
 #include <vector>
 
+#include "validation_tracker.hpp"
+
 namespace ov {
 namespace op {
 TypeRelaxedBase::~TypeRelaxedBase() = default;
+
+void TypeRelaxedBase::set_overridden_output_type(const element::Type& element_type, size_t outputIndex) {
+    if (outputIndex >= m_output_data_types.size()) {
+        m_output_data_types.resize(outputIndex + 1, element::undefined);
+    }
+    m_output_data_types[outputIndex] = element_type;
+    // the types are applied by the next validation of the node
+    ValidationTracker::mark(dynamic_cast<const Node*>(this));
+}
+
+void TypeRelaxedBase::set_origin_input_type(const element::Type& element_type, size_t inputIndex) {
+    if (inputIndex >= m_input_data_types.size()) {
+        m_input_data_types.resize(inputIndex + 1, element::undefined);
+    }
+    m_input_data_types[inputIndex] = element_type;
+    ValidationTracker::mark(dynamic_cast<const Node*>(this));
+}
 }  // namespace op
 }  // namespace ov
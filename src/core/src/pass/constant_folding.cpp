@@ -4,14 +4,24 @@
 
 #include "openvino/pass/constant_folding.hpp"
 
+#include <chrono>
+#include <iomanip>
+#include <iostream>
 #include <openvino/cc/pass/itt.hpp>
+#include <unordered_set>
 
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/util/binary_elementwise_arithmetic.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
+#include "openvino/op/util/unary_elementwise_arithmetic.hpp"
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
+#include "openvino/util/env_util.hpp"
 
 using namespace std;
 
@@ -50,9 +60,61 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+namespace {
+using folding_clock = std::chrono::steady_clock;
+
+// the threads start costs tens of microseconds, so the small constants are folded sequentially
+constexpr size_t min_parallel_folding_bytes = 1 << 20;
+
+bool folding_profile_enabled() {
+    static const bool enabled =
+        ov::util::getenv_bool("NGRAPH_PROFILE_PASS_ENABLE") || ov::util::getenv_bool("OV_PROFILE_PASS_ENABLE");
+    return enabled;
+}
+
+void report_folding_time(const ov::Node& node, folding_clock::duration time) {
+    const auto us = std::chrono::duration_cast<std::chrono::microseconds>(time).count();
+    std::cout << std::setw(7) << us << "us ConstantFolding " << node.get_type_name() << " " << node.get_friendly_name()
+              << "\n";
+}
+
+/**
+ * \brief Check if the node can be folded concurrently with the other nodes.
+ *
+ * evaluate() of the element-wise operations, Convert and Transpose depends only on the input data, while the other
+ * operations may calculate bounds or values of the neighbour nodes during folding.
+ *
+ * \param node  Node to check.
+ *
+ * \return true if all the inputs of the node are constants and it is safe to fold it in parallel.
+ */
+bool is_parallel_foldable(const std::shared_ptr<ov::Node>& node) {
+    if (!ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(node) &&
+        !ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(node) && !ov::is_type<ov::op::v0::Convert>(node) &&
+        !ov::is_type<ov::op::v1::Transpose>(node)) {
+        return false;
+    }
+    if (ov::pass::constant_folding_is_disabled(node))
+        return false;
+    for (const auto& input : node->input_values()) {
+        if (!ov::is_type<ov::op::v0::Constant>(input.get_node()))
+            return false;
+    }
+    for (const auto& output : node->outputs()) {
+        if (output.get_partial_shape().is_dynamic() || output.get_element_type().is_dynamic())
+            return false;
+    }
+    return true;
+}
+}  // namespace
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
+    // the reference kernels may split the large tensors between the threads of the executor
+    ngraph::runtime::reference::ParallelScope parallel_scope(m_executor);
+
     bool rewritten = pre_calculated_values_folding(model);
+    rewritten |= parallel_folding(model);
 
     for (const auto& node : model->get_ordered_ops()) {
         if (rewritten) {
@@ -61,27 +123,12 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
 
         OutputVector replacements(node->get_output_size());
 
+        const auto start = folding_clock::now();
         if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Propagate runtime info attributes to replacement consumer nodes
-                    copy_runtime_info_to_target_inputs(node, replacement);
-
-                    rewritten = true;
-                }
+            if (folding_profile_enabled()) {
+                report_folding_time(*node, folding_clock::now() - start);
             }
+            rewritten |= replace_folded_outputs(node, replacements);
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
@@ -96,6 +143,95 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::parallel_folding(const std::shared_ptr<ov::Model>& model) {
+    std::vector<std::shared_ptr<Node>> level;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (is_parallel_foldable(node))
+            level.push_back(node);
+    }
+
+    bool rewritten = false;
+    while (!level.empty()) {
+        size_t level_bytes = 0;
+        for (const auto& node : level) {
+            for (const auto& output : node->outputs())
+                level_bytes += shape_size(output.get_shape()) * output.get_element_type().size();
+        }
+
+        std::vector<OutputVector> replacements(level.size());
+        std::vector<char> folded(level.size(), false);
+        std::vector<folding_clock::duration> times(level.size());
+        auto fold = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const auto start = folding_clock::now();
+                replacements[i].resize(level[i]->get_output_size());
+                folded[i] = level[i]->constant_fold(replacements[i], level[i]->input_values());
+                times[i] = folding_clock::now() - start;
+            }
+        };
+        if (level.size() > 1 && level_bytes >= min_parallel_folding_bytes) {
+            ngraph::runtime::reference::parallel_for(level.size(), 1, fold);
+        } else {
+            fold(0, level.size());
+        }
+
+        // the consumers of the folded nodes form the next level
+        std::vector<std::shared_ptr<Node>> consumers;
+        std::unordered_set<Node*> visited;
+        for (size_t i = 0; i < level.size(); ++i) {
+            if (!folded[i])
+                continue;
+            if (folding_profile_enabled()) {
+                report_folding_time(*level[i], times[i]);
+            }
+            if (!replace_folded_outputs(level[i], replacements[i]))
+                continue;
+            rewritten = true;
+            for (const auto& replacement : replacements[i]) {
+                for (const auto& input : replacement.get_target_inputs()) {
+                    auto consumer = input.get_node()->shared_from_this();
+                    if (visited.insert(consumer.get()).second)
+                        consumers.push_back(consumer);
+                }
+            }
+        }
+
+        level.clear();
+        for (const auto& consumer : consumers) {
+            consumer->validate_and_infer_types();
+            if (is_parallel_foldable(consumer))
+                level.push_back(consumer);
+        }
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::replace_folded_outputs(const std::shared_ptr<Node>& node,
+                                                       const OutputVector& replacements) {
+    OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                    "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                    node);
+    OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                    "constant_fold_default returned incorrect number of replacements for ",
+                    node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
+
+            node_output.replace(replacement);
+            // Propagate runtime info attributes to replacement consumer nodes
+            copy_runtime_info_to_target_inputs(node, replacement);
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
 void ov::pass::ConstantFolding::copy_runtime_info_to_target_inputs(const std::shared_ptr<Node>& node,
                                                                    const Output<Node>& replacement) {
     for (auto& input : replacement.get_target_inputs()) {
@@ -6,17 +6,23 @@
 
 #include <algorithm>
 #include <deque>
+#include <iomanip>
 #include <iostream>
+#include <ngraph/pattern/op/label.hpp>
+#include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <openvino/cc/pass/itt.hpp>
 #include <regex>
+#include <sstream>
 #include <unordered_set>
 #include <vector>
 
 #include "ngraph/env_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/util/sub_graph_base.hpp"
+#include "openvino/util/env_util.hpp"
 #include "perf_counters.hpp"
+#include "validation_tracker.hpp"
 
 /* GraphRewrite algorithm:
  * GraphRewrite processes an input graph in an topological order(i.e. args before users)
@@ -53,10 +59,112 @@
 namespace ov {
 namespace pass {
 namespace {
+// the callback may change the matched nodes in place, so they are revalidated by pass::Manager
+void mark_matched_nodes(pattern::Matcher& m) {
+    for (const auto& node : m.get_matched_nodes()) {
+        ValidationTracker::mark(node.get());
+    }
+}
+
 PerfCounters& perf_counters_graph_rewrite() {
     static PerfCounters counters;
     return counters;
 }
+
+// Collects the types of the nodes which can be matched by the pattern root. Returns false if the root can match a node
+// of any type, e.g. pattern::any_input() or a pattern with the predicate only.
+bool collect_root_types(const Output<Node>& root, std::vector<NodeTypeInfo>& root_types) {
+    const auto node = root.get_node_shared_ptr();
+    // pattern::op::AnyOutput operation automatically appends for multi output operations inside Matcher, and Label
+    // only narrows the values matched by the wrapped pattern, so the types are defined by their input
+    if (std::dynamic_pointer_cast<pattern::op::AnyOutput>(node) ||
+        std::dynamic_pointer_cast<pattern::op::Label>(node)) {
+        return collect_root_types(node->input_value(0), root_types);
+    }
+    if (auto wrap_type = std::dynamic_pointer_cast<pattern::op::WrapType>(node)) {
+        const auto& wrapped_types = wrap_type->get_wrapped_types();
+        root_types.insert(root_types.end(), wrapped_types.begin(), wrapped_types.end());
+        return true;
+    }
+    if (std::dynamic_pointer_cast<pattern::op::Or>(node)) {
+        for (const auto& input_value : node->input_values()) {
+            if (!collect_root_types(input_value, root_types))
+                return false;
+        }
+        return true;
+    }
+    // True, Any, AnyOf, Skip, Branch, etc. match the nodes by the predicates which can't be dispatched by the type
+    if (std::dynamic_pointer_cast<pattern::op::Pattern>(node)) {
+        return false;
+    }
+    root_types.push_back(node->get_type_info());
+    return true;
+}
+
+/// \brief Dispatches the nodes to the matchers whose pattern roots can match them
+///
+/// The matchers are registered by the types of the pattern roots and the list of the matchers for the node type
+/// including the ones registered for the parent types is built once per type. The matchers whose roots can match a
+/// node of any type are appended to every list, so they don't turn the dispatch into the scan of all matchers.
+class MatcherIndex {
+public:
+    MatcherIndex(const std::vector<std::shared_ptr<MatcherPass>>& matchers, const PassConfig& pass_config) {
+        std::vector<NodeTypeInfo> root_types;
+        for (size_t matcher_index = 0; matcher_index < matchers.size(); ++matcher_index) {
+            // Skip passes that are disabled
+            if (pass_config.is_disabled(matchers[matcher_index]->get_type_info()))
+                continue;
+            m_enabled_matchers++;
+
+            root_types.clear();
+            auto matcher = matchers[matcher_index]->get_matcher();
+            if (!matcher || !collect_root_types(matcher->get_pattern_value(), root_types)) {
+                m_untyped_matchers.push_back(matcher_index);
+                continue;
+            }
+            for (const auto& root_type : root_types) {
+                m_type_to_matchers[root_type].push_back(matcher_index);
+            }
+        }
+    }
+
+    /// \brief Returns the indices of the matchers for the node type in the order of the registration
+    const std::vector<size_t>& get_matchers(const NodeTypeInfo& node_type) {
+        auto resolved = m_resolved.find(&node_type);
+        if (resolved != m_resolved.end())
+            return resolved->second;
+
+        std::vector<size_t> matchers = m_untyped_matchers;
+        for (auto type_info = &node_type; type_info; type_info = type_info->parent) {
+            auto typed = m_type_to_matchers.find(*type_info);
+            if (typed != m_type_to_matchers.end())
+                matchers.insert(matchers.end(), typed->second.begin(), typed->second.end());
+        }
+        std::sort(matchers.begin(), matchers.end());
+        // WrapType root may list both the type and its parent
+        matchers.erase(std::unique(matchers.begin(), matchers.end()), matchers.end());
+        return m_resolved.emplace(&node_type, std::move(matchers)).first->second;
+    }
+
+    size_t get_enabled_matchers_count() const {
+        return m_enabled_matchers;
+    }
+
+    size_t get_untyped_matchers_count() const {
+        return m_untyped_matchers.size();
+    }
+
+private:
+    size_t m_enabled_matchers = 0;
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> m_type_to_matchers;
+    std::vector<size_t> m_untyped_matchers;
+    std::unordered_map<const NodeTypeInfo*, std::vector<size_t>> m_resolved;
+};
+
+struct MatcherStatistics {
+    size_t attempts = 0;
+    size_t hits = 0;
+};
 }  // namespace
 }  // namespace pass
 }  // namespace ov
@@ -88,52 +196,17 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
-    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
-    for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
-        // Skip passes that are disabled
-        if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
-            continue;
-
-        auto matcher = m_matchers[matcher_index]->get_matcher();
-        if (!matcher) {
-            all_roots_has_type = false;
-            break;
-        }
-
-        auto root = matcher->get_pattern_value().get_node_shared_ptr();
-        // pattern::op::AnyOutput operation automatically appends for multi output operations inside
-        // Matcher and to gen actual root node we need to take it's parent.
-        if (auto any_type = std::dynamic_pointer_cast<pattern::op::AnyOutput>(root)) {
-            root = any_type->input_value(0).get_node_shared_ptr();
-        }
-
-        // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
-        if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
-            if (auto any_type = std::dynamic_pointer_cast<pattern::op::WrapType>(p)) {
-                for (const auto& root_type_info : any_type->get_wrapped_types()) {
-                    type_to_matcher[root_type_info].push_back(matcher_index);
-                }
-            } else {
-                all_roots_has_type = false;
-                break;
-            }
-        } else {
-            type_to_matcher[root->get_type_info()].push_back(matcher_index);
-        }
+    static const bool statistics_enabled = ov::util::getenv_bool("OV_PROFILE_MATCHERS_ENABLE");
 
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
-    }
+    MatcherIndex index(m_matchers, *pass_config);
+    std::vector<MatcherStatistics> statistics(statistics_enabled ? m_matchers.size() : 0);
+    size_t processed_nodes = 0;
 
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass, std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic()) {
@@ -147,6 +220,13 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
         bool status = m_pass->apply(node);
+        if (status)
+            ValidationTracker::mark(node.get());
+        if (statistics_enabled) {
+            auto& matcher_statistics = statistics[matcher_index];
+            matcher_statistics.attempts++;
+            matcher_statistics.hits += status ? 1 : 0;
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -162,9 +242,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -178,56 +255,42 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
             size_t sub_graphs_num = sub_graph_node->get_internal_subgraphs_size();
             for (size_t sub_graph_ind = 0; sub_graph_ind < sub_graphs_num; ++sub_graph_ind) {
                 auto sub_graph = sub_graph_node->get_function(static_cast<int>(sub_graph_ind));
-                run_on_model(sub_graph);
+                // the outputs of the node depend on the body, so it is revalidated after the body changes
+                if (run_on_model(sub_graph))
+                    ValidationTracker::mark(sub_graph_node.get());
             }
         }
         // Temporary keep this GraphRewrite property for backward compatibility
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
+        processed_nodes++;
+        for (size_t matcher_index : index.get_matchers(node->get_type_info())) {
+            if (run_matcher_pass(matcher_index, node)) {
+                rewritten = true;
+                break;
             }
         }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
+    }
+
+    if (statistics_enabled) {
+        size_t attempts = 0;
+        for (const auto& matcher_statistics : statistics)
+            attempts += matcher_statistics.attempts;
+        std::stringstream ss;
+        ss << get_name() << ": " << processed_nodes << " nodes, " << index.get_enabled_matchers_count() << " matchers ("
+           << index.get_untyped_matchers_count() << " untyped), " << attempts << " of "
+           << processed_nodes * index.get_enabled_matchers_count() << " matcher calls\n";
+        for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
+            const auto& matcher_statistics = statistics[matcher_index];
+            if (matcher_statistics.attempts == 0)
+                continue;
+            ss << std::setw(10) << matcher_statistics.attempts << " calls " << std::setw(7) << matcher_statistics.hits
+               << " hits " << std::setw(6) << std::fixed << std::setprecision(2)
+               << 100.0 * matcher_statistics.hits / matcher_statistics.attempts << "% "
+               << m_matchers[matcher_index]->get_name() << "\n";
         }
+        std::cout << ss.str();
     }
     return rewritten;
 }
@@ -244,6 +307,8 @@ void ov::pass::GraphRewrite::add_matcher(const std::shared_ptr<pattern::Matcher>
                 NGRAPH_DEBUG << "Matcher " << m->get_name() << " matched " << node;
                 OV_PASS_CALLBACK(m);
                 bool status = callback(*m.get());
+                if (status)
+                    mark_matched_nodes(*m);
                 // explicitly clear Matcher state because it holds pointers to matched nodes
                 m->clear_state();
                 return status;
@@ -302,6 +367,8 @@ void ov::pass::MatcherPass::register_matcher(const std::shared_ptr<ov::pass::pat
             OV_PASS_CALLBACK(m);
             const bool status = callback(*m.get());
             NGRAPH_DEBUG << "Matcher " << m->get_name() << " callback " << (status ? "succeded" : "failed");
+            if (status)
+                mark_matched_nodes(*m);
             // explicitly clear Matcher state because it holds pointers to matched nodes
             m->clear_state();
             return status;
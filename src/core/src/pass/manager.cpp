@@ -22,6 +22,7 @@
 #include "ngraph/util.hpp"
 #include "openvino/util/env_util.hpp"
 #include "perf_counters.hpp"
+#include "validation_tracker.hpp"
 
 using namespace std;
 
@@ -61,6 +62,33 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     ngraph::stopwatch overall_timer;
     overall_timer.start();
     bool function_changed = false;
+
+    // The changes made by GraphRewrite are tracked: the created and reconnected nodes, the matched nodes and the nodes
+    // changed by the type and shape setters, so only they and the nodes downstream of them are revalidated after it.
+    // Any other pass which changed the model is followed by the full validation.
+    ValidationTracker tracker;
+    bool full_validation_required = false;
+    PerfCounters::ValidationStatistics validation;
+    ngraph::stopwatch validation_timer;
+    auto validate = [&](const std::shared_ptr<ModelPass>& validate_pass) {
+        validation_timer.start();
+        if (full_validation_required) {
+            validate_pass->run_on_model(func);
+            tracker.clear();
+            full_validation_required = false;
+            validation.full_runs++;
+            // the topological order is cached by the validation
+            validation.validated_nodes += func->get_ordered_ops().size();
+        } else {
+            const auto validated_nodes = tracker.validate(*func);
+            const auto model_size = func->get_ordered_ops().size();
+            validation.incremental_runs++;
+            validation.validated_nodes += validated_nodes;
+            validation.skipped_nodes += model_size > validated_nodes ? model_size - validated_nodes : 0;
+        }
+        validation_timer.stop();
+        validation.milliseconds += static_cast<double>(validation_timer.get_microseconds()) / 1000;
+    };
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             NGRAPH_DEBUG << "Pass " << pass->get_name() << " is disabled";
@@ -93,11 +121,13 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
 
             if (dynamic_pointer_cast<Validate>(pass)) {
                 if (function_changed) {
-                    function_pass->run_on_model(func);
+                    validate(function_pass);
                     function_changed = false;
                 }
             } else {
                 function_changed = function_pass->run_on_model(func);
+                if (function_changed && !dynamic_pointer_cast<GraphRewrite>(pass))
+                    full_validation_required = true;
             }
         } else if (auto node_pass = dynamic_pointer_cast<ngraph::pass::NodePass>(pass)) {
             if (node_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && func->is_dynamic()) {
@@ -108,6 +138,7 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             for (const shared_ptr<Node>& n : func->get_ops()) {
                 function_changed |= node_pass->run_on_node(n);
             }
+            full_validation_required |= function_changed;
         }
 
         if (m_visualize) {
@@ -129,8 +160,12 @@ void ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
         }
     }
+    pass::perf_counters().add_validation(validation);
     if (profile_enabled) {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
+        cout << "validation done in " << validation.milliseconds << "ms: " << validation.full_runs << " full and "
+             << validation.incremental_runs << " incremental runs, " << validation.validated_nodes
+             << " nodes revalidated, " << validation.skipped_nodes << " skipped\n";
     }
     NGRAPH_SUPPRESS_DEPRECATED_END
 }
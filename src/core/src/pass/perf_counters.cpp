@@ -12,5 +12,19 @@ openvino::itt::handle_t PerfCounters::operator[](::ngraph::Node::type_info_t con
         return it->second;
     return m_counters[&type_inf] = openvino::itt::handle(type_inf.name);
 }
+
+void PerfCounters::add_validation(const ValidationStatistics& statistics) {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_validation.full_runs += statistics.full_runs;
+    m_validation.incremental_runs += statistics.incremental_runs;
+    m_validation.validated_nodes += statistics.validated_nodes;
+    m_validation.skipped_nodes += statistics.skipped_nodes;
+    m_validation.milliseconds += statistics.milliseconds;
+}
+
+PerfCounters::ValidationStatistics PerfCounters::get_validation_statistics() {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_validation;
+}
 }  // namespace pass
 }  // namespace ov
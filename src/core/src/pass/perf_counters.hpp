@@ -18,6 +18,19 @@ public:
 
     openvino::itt::handle_t operator[](::ngraph::Node::type_info_t const& type_inf);
 
+    /// \brief Statistics of the validation which pass::Manager runs after the passes changing the model
+    struct ValidationStatistics {
+        size_t full_runs = 0;
+        size_t incremental_runs = 0;
+        size_t validated_nodes = 0;
+        size_t skipped_nodes = 0;  // nodes which the full validation would have revalidated in addition
+        double milliseconds = 0;
+    };
+
+    void add_validation(const ValidationStatistics& statistics);
+
+    ValidationStatistics get_validation_statistics();
+
 private:
     using key = ::ngraph::Node::type_info_t const*;
     using value = openvino::itt::handle_t;
@@ -25,6 +38,7 @@ private:
 
     std::mutex m_mutex;
     counters_map m_counters;
+    ValidationStatistics m_validation;
 };
 }  // namespace pass
 }  // namespace ov
@@ -4,9 +4,11 @@
 
 #include "openvino/pass/serialize.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <ngraph/variant.hpp>
 #include <openvino/cc/pass/itt.hpp>
@@ -90,6 +92,12 @@ public:
           m_enable_compression(enable_compression),
           m_blob_offset(bin_data.tellp()) {}
 
+    virtual ~ConstantWriter() = default;
+
+    virtual FilePosition write(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) {
+        return write(static_cast<const char*>(buffer->get_ptr()), buffer->size());
+    }
+
     FilePosition write(const char* ptr, size_t size) {
         const FilePosition write_pos = m_binary_output.tellp();
         const auto offset = write_pos - m_blob_offset;
@@ -424,7 +432,7 @@ public:
                            &adapter)) {
             if (name == "value" && translate_type_name(m_node_type_name) == "Const") {
                 const int64_t size = a->get()->size();
-                int64_t offset = m_constant_write_handler.write(static_cast<const char*>(a->get()->get_ptr()), size);
+                int64_t offset = m_constant_write_handler.write(a->get());
 
                 m_xml_node.append_attribute("offset").set_value(offset);
                 m_xml_node.append_attribute("size").set_value(size);
@@ -1007,11 +1015,11 @@ std::string provide_bin_path(const std::string& xmlPath, const std::string& binP
 }
 
 void serializeFunc(std::ostream& xml_file,
-                   std::ostream& bin_file,
+                   ConstantWriter& constant_write_handler,
                    std::shared_ptr<ov::Model> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = f->get_rt_info();
@@ -1032,15 +1040,24 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
     xml_doc.save(xml_file);
     xml_file.flush();
-    bin_file.flush();
 };
 
+void serializeFunc(std::ostream& xml_file,
+                   std::ostream& bin_file,
+                   std::shared_ptr<ov::Model> f,
+                   ov::pass::Serialize::Version ver,
+                   const std::map<std::string, ngraph::OpSet>& custom_opsets,
+                   bool deterministic = false) {
+    ConstantWriter constant_write_handler(bin_file);
+    serializeFunc(xml_file, constant_write_handler, f, ver, custom_opsets, deterministic);
+    bin_file.flush();
+}
+
 }  // namespace
 
 namespace ov {
@@ -1206,29 +1223,171 @@ static uint64_t hash_combine(uint64_t seed, const T& a) {
     return seed ^ (std::hash<T>()(a) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
 }
 
+/// \brief Streaming 64-bit hash with the xxHash64 structure: four independent accumulators over 32-byte stripes,
+/// so the data is processed with the memory bandwidth and the result does not depend on the chunking of the input.
+class StreamingHash {
+    static constexpr uint64_t prime1 = 11400714785074694791ULL;
+    static constexpr uint64_t prime2 = 14029467366897019727ULL;
+    static constexpr uint64_t prime3 = 1609587929392839161ULL;
+    static constexpr uint64_t prime4 = 9650029242287828579ULL;
+    static constexpr uint64_t prime5 = 2870177450012600261ULL;
+    static constexpr size_t stripe_size = 32;
+
+    std::array<uint64_t, 4> m_acc{{prime1 + prime2, prime2, 0, 0 - prime1}};
+    std::array<char, stripe_size> m_stripe{};
+    size_t m_stripe_size = 0;
+    uint64_t m_total_size = 0;
+
+    static uint64_t rotl(uint64_t v, int r) {
+        return (v << r) | (v >> (64 - r));
+    }
+
+    static uint64_t read64(const char* p) {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    static uint64_t round(uint64_t acc, uint64_t input) {
+        acc += input * prime2;
+        acc = rotl(acc, 31);
+        return acc * prime1;
+    }
+
+    static uint64_t merge_round(uint64_t h, uint64_t acc) {
+        h ^= round(0, acc);
+        return h * prime1 + prime4;
+    }
+
+    void consume_stripe(const char* p) {
+        for (size_t i = 0; i < m_acc.size(); i++) {
+            m_acc[i] = round(m_acc[i], read64(p + i * sizeof(uint64_t)));
+        }
+    }
+
+public:
+    void update(const char* data, size_t size) {
+        m_total_size += size;
+        if (m_stripe_size > 0) {
+            const size_t to_copy = std::min(size, stripe_size - m_stripe_size);
+            std::memcpy(m_stripe.data() + m_stripe_size, data, to_copy);
+            m_stripe_size += to_copy;
+            data += to_copy;
+            size -= to_copy;
+            if (m_stripe_size < stripe_size)
+                return;
+            consume_stripe(m_stripe.data());
+            m_stripe_size = 0;
+        }
+        for (; size >= stripe_size; data += stripe_size, size -= stripe_size) {
+            consume_stripe(data);
+        }
+        std::memcpy(m_stripe.data(), data, size);
+        m_stripe_size = size;
+    }
+
+    uint64_t digest() const {
+        uint64_t h;
+        if (m_total_size >= stripe_size) {
+            h = rotl(m_acc[0], 1) + rotl(m_acc[1], 7) + rotl(m_acc[2], 12) + rotl(m_acc[3], 18);
+            for (const auto acc : m_acc) {
+                h = merge_round(h, acc);
+            }
+        } else {
+            h = m_acc[2] + prime5;
+        }
+        h += m_total_size;
+
+        const char* p = m_stripe.data();
+        size_t rest = m_stripe_size;
+        for (; rest >= 8; p += 8, rest -= 8) {
+            h ^= round(0, read64(p));
+            h = rotl(h, 27) * prime1 + prime4;
+        }
+        if (rest >= 4) {
+            uint32_t v;
+            std::memcpy(&v, p, sizeof(v));
+            h ^= static_cast<uint64_t>(v) * prime1;
+            h = rotl(h, 23) * prime2 + prime3;
+            p += 4;
+            rest -= 4;
+        }
+        for (; rest > 0; p++, rest--) {
+            h ^= static_cast<uint64_t>(static_cast<uint8_t>(*p)) * prime5;
+            h = rotl(h, 11) * prime1;
+        }
+
+        h ^= h >> 33;
+        h *= prime2;
+        h ^= h >> 29;
+        h *= prime3;
+        h ^= h >> 32;
+        return h;
+    }
+};
+
 class OstreamHashWrapper final : public std::streambuf {
-    uint64_t m_res = 0;
+    StreamingHash m_hash;
 
 public:
     uint64_t getResult() const {
-        return m_res;
+        return m_hash.digest();
     }
 
     std::streamsize xsputn(const char* s, std::streamsize n) override {
-        auto* intS = (const std::streamsize*)s;
-        std::streamsize n64 = n / static_cast<std::streamsize>(sizeof(std::streamsize));
-        std::streamsize i = 0;
-        // Using 64-bit values executes much faster than char
-        while (i++ < n64) {
-            m_res += *(intS++);
+        m_hash.update(s, static_cast<size_t>(n));
+        return n;
+    }
+
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof())) {
+            const char ch = traits_type::to_char_type(c);
+            m_hash.update(&ch, 1);
         }
+        return traits_type::not_eof(c);
+    }
+};
+
+uint64_t hash_data(const void* data, size_t size) {
+    StreamingHash hash;
+    hash.update(static_cast<const char*>(data), size);
+    return hash.digest();
+}
 
-        std::streamsize rest = n % static_cast<std::streamsize>(sizeof(std::streamsize));
-        for (i = 0; i < rest; i++) {
-            m_res += s[n - rest + i];
+/// \brief Writes the digests of the constants instead of their data, offsets are kept as if the data was written
+class ConstantHashWriter : public ConstantWriter {
+public:
+    ConstantHashWriter(std::ostream& digests, const pass::Hash::ConstantDigests* known_digests)
+        : ConstantWriter(digests, false),
+          m_digests(digests),
+          m_known_digests(known_digests) {}
+
+    FilePosition write(const std::shared_ptr<ngraph::runtime::AlignedBuffer>& buffer) override {
+        const void* data = buffer->get_ptr();
+        const size_t size = buffer->size();
+        uint64_t digest = 0;
+        if (!m_known_digests || !find_digest(data, size, digest)) {
+            digest = hash_data(data, size);
         }
-        return n;
+        m_digests.write(reinterpret_cast<const char*>(&digest), sizeof(digest));
+
+        const FilePosition offset = m_offset;
+        m_offset += static_cast<FilePosition>(buffer->size());
+        return offset;
     }
+
+private:
+    bool find_digest(const void* data, size_t size, uint64_t& digest) const {
+        const auto found = m_known_digests->find({data, size});
+        if (found == m_known_digests->end())
+            return false;
+        digest = found->second;
+        return true;
+    }
+
+    std::ostream& m_digests;
+    const pass::Hash::ConstantDigests* m_known_digests;
+    FilePosition m_offset = 0;
 };
 }  // namespace
 
@@ -1238,9 +1397,10 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
     OstreamHashWrapper binHash;
     std::ostream xml(&xmlHash);
     std::ostream bin(&binHash);
+    ConstantHashWriter constant_write_handler(bin, m_digests);
 
     // Determinism is important for hash calculation
-    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true);
+    serializeFunc(xml, constant_write_handler, f, Serialize::Version::UNSPECIFIED, {}, true);
 
     uint64_t seed = 0;
     seed = hash_combine(seed, xmlHash.getResult());
@@ -1251,6 +1411,14 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
     return false;
 }
 
+uint64_t pass::Hash::hash_constant(const ov::op::v0::Constant& constant) {
+    return hash_data(constant.get_data_ptr(), constant.get_byte_size());
+}
+
 pass::Hash::Hash(uint64_t& output_hash_value) : m_hash(output_hash_value) {}
 
+pass::Hash::Hash(uint64_t& output_hash_value, const ConstantDigests& digests)
+    : m_hash(output_hash_value),
+      m_digests(&digests) {}
+
 }  // namespace ov
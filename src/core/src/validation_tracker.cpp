@@ -0,0 +1,52 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "validation_tracker.hpp"
+
+namespace ov {
+namespace {
+thread_local ValidationTracker* current_tracker = nullptr;
+}  // namespace
+
+ValidationTracker::ValidationTracker() : m_parent(current_tracker) {
+    current_tracker = this;
+}
+
+ValidationTracker::~ValidationTracker() {
+    current_tracker = m_parent;
+}
+
+void ValidationTracker::mark(const Node* node) {
+    auto tracker = current_tracker;
+    if (tracker && node)
+        tracker->m_dirty.insert(node);
+}
+
+void ValidationTracker::clear() {
+    m_dirty.clear();
+}
+
+bool ValidationTracker::empty() const {
+    return m_dirty.empty();
+}
+
+size_t ValidationTracker::validate(const Model& model) {
+    std::unordered_set<const Node*> dirty;
+    std::swap(dirty, m_dirty);
+
+    // the nodes are visited in the topological order, so the producers are checked before the consumers
+    std::unordered_set<const Node*> cone;
+    validate_nodes_and_infer_types(model, [&](Node* node) {
+        bool revalidate = dirty.count(node) != 0;
+        for (size_t i = 0; i < node->get_input_size() && !revalidate; ++i)
+            revalidate = cone.count(node->get_input_node_ptr(i)) != 0;
+        if (revalidate)
+            cone.insert(node);
+        return revalidate;
+    });
+    // the nodes whose outputs were changed by the validation itself are in the cone already
+    m_dirty.clear();
+    return cone.size();
+}
+}  // namespace ov
@@ -0,0 +1,56 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <unordered_set>
+
+#include "openvino/core/model.hpp"
+#include "openvino/core/node.hpp"
+
+namespace ov {
+/// \brief Same as Model::validate_nodes_and_infer_types, but reinfers the types and shapes only of the nodes for
+/// which revalidate returns true. The nodes are visited in the topological order, the model-level checks are done
+/// for all of them.
+void validate_nodes_and_infer_types(const Model& model, const std::function<bool(Node*)>& revalidate);
+
+/// \brief Collects the nodes which need the revalidation while pass::Manager runs the passes on the current thread.
+///
+/// A node is marked when its inputs are created or connected to another output, when a matcher callback which
+/// matched it succeeds and when it is changed in place: its output type is set to a different one, the shape or the
+/// type of a Parameter is set, or the overridden types of a TypeRelaxed operation are set. The types and shapes are
+/// reinferred only for the marked nodes and the nodes downstream of them instead of the whole model.
+///
+/// The marked nodes are never dereferenced, they are only looked up while the nodes of the model are visited, so the
+/// destroyed nodes don't have to be removed from the tracker. A new node which reuses the address of a destroyed one
+/// is revalidated once more at most.
+class ValidationTracker {
+public:
+    /// \brief Makes the tracker current for the calling thread until it is destroyed
+    ValidationTracker();
+    ~ValidationTracker();
+
+    ValidationTracker(const ValidationTracker&) = delete;
+    ValidationTracker& operator=(const ValidationTracker&) = delete;
+
+    /// \brief Marks the node in the current tracker of the calling thread if any
+    static void mark(const Node* node);
+
+    /// \brief Reinfers the types and shapes of the marked nodes of the model and of all nodes downstream of them.
+    /// The nodes downstream are revalidated even if the outputs they consume are unchanged since the shape inference
+    /// may depend on the values and bounds of the inputs.
+    /// \return number of the revalidated nodes
+    size_t validate(const Model& model);
+
+    /// \brief Forgets the marked nodes after the full validation of the model
+    void clear();
+
+    bool empty() const;
+
+private:
+    ValidationTracker* m_parent;
+    std::unordered_set<const Node*> m_dirty;
+};
+}  // namespace ov
@@ -4,6 +4,8 @@
 
 #include "ngraph/pass/constant_folding.hpp"
 
+#include <atomic>
+#include <thread>
 #include <transformations/utils/utils.hpp>
 
 #include "common_test_utils/ngraph_test_utils.hpp"
@@ -3522,3 +3524,62 @@ TEST(constant_folding, evaluate_on_tensor_vector) {
     ASSERT_EQ(data_shape, result_node->get_output_shape(0));
     ASSERT_EQ(add_expected, result_node->cast_vector<int>());
 }
+
+TEST(constant_folding, parallel_folding_of_independent_subgraphs) {
+    // each branch is large enough for the branches to be folded in parallel
+    const Shape shape{256, 1024};
+    const size_t branches = 8;
+    NodeVector results;
+    std::vector<std::vector<float>> expected;
+    for (size_t b = 0; b < branches; ++b) {
+        std::vector<float16> values(shape_size(shape));
+        for (size_t i = 0; i < values.size(); ++i)
+            values[i] = static_cast<float>((i + b) % 128);
+        auto data = make_shared<op::Constant>(element::f16, shape, values);
+        auto convert = make_shared<op::v0::Convert>(data, element::f32);
+        auto order = op::Constant::create(element::i64, Shape{2}, {1, 0});
+        auto transpose = make_shared<op::v1::Transpose>(convert, order);
+        auto scale = op::Constant::create(element::f32, Shape{}, {2});
+        auto multiply = make_shared<op::v1::Multiply>(transpose, scale);
+        multiply->set_friendly_name("branch_" + std::to_string(b));
+        results.push_back(multiply);
+
+        std::vector<float> branch_expected(values.size());
+        for (size_t i = 0; i < shape[0]; ++i)
+            for (size_t j = 0; j < shape[1]; ++j)
+                branch_expected[j * shape[0] + i] = 2 * static_cast<float>(values[i * shape[1] + j]);
+        expected.push_back(branch_expected);
+    }
+    auto model = make_shared<ov::Model>(results, ParameterVector{});
+
+    // the threading is provided by the caller of the pass
+    std::atomic<size_t> executed_calls{0};
+    auto executor = [&](size_t count, const std::function<void(size_t)>& body) {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < count; ++i) {
+            threads.emplace_back([&, i] {
+                body(i);
+                ++executed_calls;
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+    };
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>(executor);
+    pass_manager.run_passes(model);
+
+    if (std::thread::hardware_concurrency() > 1) {
+        ASSERT_GT(executed_calls, 0u);
+    }
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Transpose>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    for (size_t b = 0; b < branches; ++b) {
+        auto result_node = ov::as_type_ptr<op::Constant>(model->get_results().at(b)->get_input_node_shared_ptr(0));
+        ASSERT_TRUE(result_node);
+        ASSERT_EQ(result_node->get_friendly_name(), "branch_" + std::to_string(b));
+        ASSERT_EQ((Shape{shape[1], shape[0]}), result_node->get_output_shape(0));
+        ASSERT_EQ(expected[b], result_node->cast_vector<float>());
+    }
+}
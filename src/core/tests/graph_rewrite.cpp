@@ -8,6 +8,8 @@
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/pass/graph_rewrite.hpp>
 #include <ngraph/pass/manager.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
 
 NGRAPH_SUPPRESS_DEPRECATED_START
 
@@ -442,3 +444,75 @@ TEST(GraphRewriteTest, nodes_use_count) {
     m.register_pass<CheckConsumers>();
     ASSERT_NO_THROW(m.run_passes(f));
 }
+
+class RecordMatchesPass : public ngraph::pass::MatcherPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    RecordMatchesPass(const std::shared_ptr<Node>& pattern, const std::string& name, std::vector<std::string>& matches)
+        : MatcherPass() {
+        ngraph::matcher_pass_callback callback = [name, &matches](pattern::Matcher& m) {
+            matches.push_back(name + ":" + m.get_match_root()->get_type_info().name);
+            return false;
+        };
+
+        auto m = std::make_shared<ngraph::pattern::Matcher>(pattern, name);
+        this->register_matcher(m, callback);
+    }
+};
+
+NGRAPH_RTTI_DEFINITION(RecordMatchesPass, "RecordMatchesPass", 0);
+
+TEST(GraphRewriteTest, MatcherIndexDispatchesUntypedRoots) {
+    auto f = get_function();
+
+    size_t predicate_calls = 0;
+    auto counting_predicate = [&predicate_calls](const Output<Node>&) {
+        predicate_calls++;
+        return true;
+    };
+    auto arithmetic = pattern::wrap_type<op::util::BinaryElementwiseArithmetic>();
+    auto parameter_or_constant =
+        std::make_shared<pattern::op::Or>(OutputVector{pattern::wrap_type<opset3::Parameter>(),
+                                                       pattern::wrap_type<opset3::Constant>()});
+
+    std::vector<std::string> matches;
+    Anchor anchor;
+    anchor.add_matcher<RecordMatchesPass>(pattern::wrap_type<opset3::Divide>(), "divide", matches);
+    anchor.add_matcher<RecordMatchesPass>(pattern::any_input(), "any", matches);
+    anchor.add_matcher<RecordMatchesPass>(std::make_shared<pattern::op::Label>(element::dynamic,
+                                                                               PartialShape::dynamic(),
+                                                                               counting_predicate,
+                                                                               OutputVector{arithmetic}),
+                                          "parent_type",
+                                          matches);
+    anchor.add_matcher<RecordMatchesPass>(parameter_or_constant, "or", matches);
+    anchor.run_on_function(f);
+
+    std::vector<std::string> expected;
+    for (const auto& node : f->get_ordered_ops()) {
+        const std::string type_name = node->get_type_info().name;
+        if (ov::is_type<opset3::Divide>(node))
+            expected.push_back("divide:" + type_name);
+        expected.push_back("any:" + type_name);
+        if (ov::is_type<opset3::Divide>(node))
+            expected.push_back("parent_type:" + type_name);
+        if (ov::is_type<opset3::Parameter>(node) || ov::is_type<opset3::Constant>(node))
+            expected.push_back("or:" + type_name);
+    }
+    ASSERT_EQ(matches, expected);
+    // the predicate of the root is checked only for the nodes whose type can match the wrapped pattern
+    ASSERT_EQ(predicate_calls, 1);
+}
+
+TEST(GraphRewriteTest, MatcherIndexDerivedTypeWithUntypedRoot) {
+    auto f = get_derived_function();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_function(f);
+
+    ASSERT_EQ(count_ops_of_type<opset3::Relu>(f), 1);
+    ASSERT_EQ(order.size(), 4);
+}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -12,6 +13,8 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "util/test_tools.hpp"
 
 using namespace ngraph;
@@ -42,3 +45,171 @@ public:
     }
 };
 }  // namespace
+
+namespace {
+// Replaces Relu by the flattening Reshape, so the shapes downstream change
+class FlattenRelu : public ov::pass::MatcherPass {
+public:
+    FlattenRelu() {
+        auto relu = ov::pass::pattern::wrap_type<ov::opset8::Relu>();
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(relu, "FlattenRelu"),
+                         [](ov::pass::pattern::Matcher& m) {
+                             auto relu = m.get_match_root();
+                             auto pattern = ov::opset8::Constant::create(ov::element::i64, ov::Shape{1}, {-1});
+                             auto reshape =
+                                 std::make_shared<ov::opset8::Reshape>(relu->input_value(0), pattern, false);
+                             ov::replace_node(relu, reshape);
+                             return true;
+                         });
+    }
+};
+
+// Changes the matched Convert in place without revalidating it
+class ConvertToI32 : public ov::pass::MatcherPass {
+public:
+    ConvertToI32() {
+        auto convert = ov::pass::pattern::wrap_type<ov::opset8::Convert>();
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(convert, "ConvertToI32"),
+                         [](ov::pass::pattern::Matcher& m) {
+                             auto convert = std::dynamic_pointer_cast<ov::opset8::Convert>(m.get_match_root());
+                             if (convert->get_destination_type() == ov::element::i32)
+                                 return false;
+                             convert->set_destination_type(ov::element::i32);
+                             return true;
+                         });
+    }
+};
+}  // namespace
+
+TEST(pass_manager, incremental_validation_updates_downstream) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{1, 3, 4, 4});
+    auto relu = std::make_shared<ov::opset8::Relu>(param);
+    auto abs = std::make_shared<ov::opset8::Abs>(relu);
+    auto untouched = std::make_shared<ov::opset8::Abs>(param);
+    auto model = std::make_shared<ov::Model>(
+        ov::ResultVector{std::make_shared<ov::opset8::Result>(abs), std::make_shared<ov::opset8::Result>(untouched)},
+        ov::ParameterVector{param});
+
+    ov::pass::Manager manager;
+    manager.register_pass<FlattenRelu>();
+    manager.run_passes(model);
+
+    EXPECT_EQ(model->output(0).get_partial_shape(), ov::PartialShape({48}));
+    EXPECT_EQ(model->output(1).get_partial_shape(), ov::PartialShape({1, 3, 4, 4}));
+}
+
+TEST(pass_manager, incremental_validation_revalidates_matched_nodes) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{2, 2});
+    auto convert = std::make_shared<ov::opset8::Convert>(param, ov::element::f16);
+    auto abs = std::make_shared<ov::opset8::Abs>(convert);
+    auto result = std::make_shared<ov::opset8::Result>(abs);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    ov::pass::Manager manager;
+    manager.register_pass<ConvertToI32>();
+    manager.run_passes(model);
+
+    EXPECT_EQ(model->output(0).get_element_type(), ov::element::i32);
+}
+
+namespace {
+// Replaces the Constant by another one of the same type and shape, so only the values downstream change
+class ReverseConstant : public ov::pass::MatcherPass {
+public:
+    ReverseConstant() {
+        auto constant = ov::pass::pattern::wrap_type<ov::opset8::Constant>();
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(constant, "ReverseConstant"),
+                         [](ov::pass::pattern::Matcher& m) {
+                             auto constant = std::dynamic_pointer_cast<ov::opset8::Constant>(m.get_match_root());
+                             auto values = constant->cast_vector<int64_t>();
+                             if (values.size() < 2 || values.front() >= values.back())
+                                 return false;
+                             std::reverse(values.begin(), values.end());
+                             auto reversed = ov::opset8::Constant::create(constant->get_element_type(),
+                                                                          constant->get_shape(),
+                                                                          values);
+                             ov::replace_node(constant, reversed);
+                             return true;
+                         });
+    }
+};
+
+// Feeds the Relu from a new Parameter which isn't registered in the model
+class DetachRelu : public ov::pass::MatcherPass {
+public:
+    DetachRelu() {
+        auto relu = ov::pass::pattern::wrap_type<ov::opset8::Relu>();
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(relu, "DetachRelu"),
+                         [](ov::pass::pattern::Matcher& m) {
+                             auto relu = m.get_match_root();
+                             auto param = std::make_shared<ov::opset8::Parameter>(relu->get_input_element_type(0),
+                                                                                  relu->get_input_partial_shape(0));
+                             relu->input(0).replace_source_output(param);
+                             return true;
+                         });
+    }
+};
+}  // namespace
+
+TEST(pass_manager, incremental_validation_propagates_values) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{6});
+    auto pattern = ov::opset8::Constant::create(ov::element::i32, ov::Shape{2}, {2, 3});
+    // the output type and shape of Convert don't change, but the output shape of Reshape does
+    auto convert = std::make_shared<ov::opset8::Convert>(pattern, ov::element::i64);
+    auto reshape = std::make_shared<ov::opset8::Reshape>(param, convert, false);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(reshape)},
+                                             ov::ParameterVector{param});
+
+    ov::pass::Manager manager;
+    manager.register_pass<ReverseConstant>();
+    manager.run_passes(model);
+
+    EXPECT_EQ(model->output(0).get_partial_shape(), ov::PartialShape({3, 2}));
+}
+
+TEST(pass_manager, incremental_validation_checks_model) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{2, 2});
+    auto relu = std::make_shared<ov::opset8::Relu>(param);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(relu)},
+                                             ov::ParameterVector{param});
+
+    ov::pass::Manager manager;
+    manager.register_pass<DetachRelu>();
+    EXPECT_THROW(manager.run_passes(model), ov::Exception);
+}
+
+namespace {
+// Changes the shape of the Parameter feeding the matched Relu in place
+class ResizeReluInput : public ov::pass::MatcherPass {
+public:
+    ResizeReluInput() {
+        auto relu = ov::pass::pattern::wrap_type<ov::opset8::Relu>();
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(relu, "ResizeReluInput"),
+                         [](ov::pass::pattern::Matcher& m) {
+                             auto param = ov::as_type_ptr<ov::opset8::Parameter>(
+                                 m.get_match_root()->get_input_node_shared_ptr(0));
+                             if (!param || param->get_partial_shape() == ov::PartialShape{4, 4})
+                                 return false;
+                             param->set_partial_shape({4, 4});
+                             return true;
+                         });
+    }
+};
+}  // namespace
+
+TEST(pass_manager, incremental_validation_tracks_in_place_changes) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::Shape{2, 2});
+    auto relu = std::make_shared<ov::opset8::Relu>(param);
+    // the Parameter isn't matched, so only the setter marks it and the Abs fed by it
+    auto abs = std::make_shared<ov::opset8::Abs>(param);
+    auto model = std::make_shared<ov::Model>(
+        ov::ResultVector{std::make_shared<ov::opset8::Result>(relu), std::make_shared<ov::opset8::Result>(abs)},
+        ov::ParameterVector{param});
+
+    ov::pass::Manager manager;
+    manager.register_pass<ResizeReluInput>();
+    manager.run_passes(model);
+
+    EXPECT_EQ(model->output(0).get_partial_shape(), ov::PartialShape({4, 4}));
+    EXPECT_EQ(model->output(1).get_partial_shape(), ov::PartialShape({4, 4}));
+}
@@ -3,11 +3,14 @@
 //
 
 #include <numeric>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest.h"
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
+#include "ngraph/runtime/reference/reshape.hpp"
+#include "ngraph/runtime/reference/utils/parallel.hpp"
 #include "ngraph/shape.hpp"
 #include "util/ndarray.hpp"
 
@@ -220,3 +223,37 @@ INSTANTIATE_TEST_SUITE_P(reshape_opt_kernel_ref_impl_fallback,
                                                           {11, 21, 13, 23, 15, 25},
                                                           {12, 22, 14, 24, 16, 26},
                                                       }}));
+
+TEST(reshape_opt_kernel, parallel_transpose) {
+    const Shape in_shape{16, 3, 64, 128};
+    const AxisVector axis_order{2, 0, 3, 1};
+    const Shape out_shape{64, 16, 128, 3};
+    std::vector<ElementValue> input(shape_size(in_shape));
+    std::iota(input.begin(), input.end(), 0);
+
+    std::vector<ElementValue> expected(input.size());
+    runtime::reference::reshape(reinterpret_cast<const char*>(input.data()),
+                                reinterpret_cast<char*>(expected.data()),
+                                in_shape,
+                                axis_order,
+                                out_shape,
+                                sizeof(ElementValue));
+
+    // the outermost output dimension is split between the threads of the executor inside of the scope
+    const runtime::reference::ParallelExecutor executor = [](size_t count, const std::function<void(size_t)>& body) {
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < count; ++i)
+            threads.emplace_back(body, i);
+        for (auto& thread : threads)
+            thread.join();
+    };
+    runtime::reference::ParallelScope parallel_scope(executor);
+    std::vector<ElementValue> output(input.size());
+    runtime::opt_kernel::reshape(reinterpret_cast<const char*>(input.data()),
+                                 reinterpret_cast<char*>(output.data()),
+                                 in_shape,
+                                 axis_order,
+                                 out_shape,
+                                 sizeof(ElementValue));
+    EXPECT_EQ(expected, output);
+}
@@ -6,10 +6,14 @@
 
 #include <xml_parse_utils.h>
 
+#include <cctype>
+#include <cstring>
 #include <ir_deserializer.hpp>
+#include <iterator>
 #include <ngraph/opsets/opset1.hpp>
 #include <openvino/op/util/framework_node.hpp>
 #include <pugixml.hpp>
+#include <string>
 
 #include "openvino/core/validation_util.hpp"
 #include "openvino/opsets/opset.hpp"
@@ -183,6 +187,108 @@ void ParsePreProcess(pugi::xml_node& root,
         }
     }
 }
+std::string read_text(std::istream& stream) {
+    std::string text;
+    const auto begin = stream.tellg();
+    stream.seekg(0, std::ios::end);
+    const auto end = stream.tellg();
+    stream.seekg(begin);
+    if (begin >= 0 && end >= begin) {
+        text.resize(static_cast<size_t>(end - begin));
+        stream.read(&text[0], text.size());
+        text.resize(static_cast<size_t>(stream.gcount()));
+    } else {
+        stream.clear();
+        text.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    }
+    return text;
+}
+
+/**
+ * @brief Finds the top level layers of the IR without building the DOM. Only the markup is recognized, so
+ * any document which can't be split safely (no layers section, DTD with the internal subset) is parsed as a whole
+ * @param xml - the IR text
+ * @param begin - the beginning of the content of the <layers> section
+ * @param end - the end of the content of the <layers> section
+ * @param layers - the <layer> elements of the section
+ * @return true if the layers are found
+ */
+bool split_layers(const std::string& xml, size_t& begin, size_t& end, std::vector<ov::XmlLayerText>& layers) {
+    const auto is_name_end = [](char c) {
+        return std::isspace(static_cast<unsigned char>(c)) || c == '/' || c == '>';
+    };
+    const auto skip_to = [&xml](size_t pos, const char* terminator) {
+        pos = xml.find(terminator, pos);
+        return pos == std::string::npos ? pos : pos + std::strlen(terminator);
+    };
+
+    size_t depth = 0;
+    size_t layer_begin = std::string::npos;
+    bool in_layers = false;
+    size_t pos = 0;
+    while ((pos = xml.find('<', pos)) != std::string::npos) {
+        const size_t tag = pos;
+        if (xml.compare(pos, 2, "<?") == 0) {
+            pos = skip_to(pos, "?>");
+        } else if (xml.compare(pos, 4, "<!--") == 0) {
+            pos = skip_to(pos, "-->");
+        } else if (xml.compare(pos, 9, "<![CDATA[") == 0) {
+            pos = skip_to(pos, "]]>");
+        } else if (xml.compare(pos, 2, "<!") == 0) {
+            pos = xml.find('>', pos);
+            if (pos == std::string::npos || xml.find('[', tag) < pos)
+                return false;
+            pos++;
+        } else {
+            const bool closing = xml.compare(pos, 2, "</") == 0;
+            size_t name_end = pos + (closing ? 2 : 1);
+            while (name_end < xml.size() && !is_name_end(xml[name_end]))
+                name_end++;
+            const std::string name = xml.substr(tag + (closing ? 2 : 1), name_end - tag - (closing ? 2 : 1));
+            // the end of the tag, '>' may be a part of the attribute values
+            pos = name_end;
+            while (pos < xml.size() && xml[pos] != '>') {
+                if (xml[pos] == '"' || xml[pos] == '\'') {
+                    pos = xml.find(xml[pos], pos + 1);
+                    if (pos == std::string::npos)
+                        return false;
+                }
+                pos++;
+            }
+            if (pos >= xml.size())
+                return false;
+            pos++;
+
+            if (closing) {
+                if (depth == 0)
+                    return false;
+                depth--;
+                if (in_layers && depth == 2 && name == "layer") {
+                    layers.push_back({xml.data() + layer_begin, pos - layer_begin, layer_begin});
+                } else if (in_layers && depth == 1 && name == "layers") {
+                    end = tag;
+                    return true;
+                }
+            } else {
+                const bool self_closing = xml[pos - 2] == '/';
+                if (depth == 1 && name == "layers") {
+                    // the empty section is left in the document
+                    if (self_closing)
+                        return false;
+                    in_layers = true;
+                    begin = pos;
+                } else if (in_layers && depth == 2 && name == "layer") {
+                    layer_begin = tag;
+                    if (self_closing)
+                        layers.push_back({xml.data() + tag, pos - tag, tag});
+                }
+                if (!self_closing)
+                    depth++;
+            }
+        }
+    }
+    return false;
+}
 }  // namespace
 
 namespace ov {
@@ -195,14 +301,30 @@ class InputModel::InputModelIRImpl {
     std::unordered_map<std::string, ov::OpSet> m_opsets;
     pugi::xml_node m_root;
     pugi::xml_document m_xml_doc;
+    // The DOM holds everything but the top level layers, they are parsed one by one from the text
+    // while the model is built, so the peak memory is the text and the DOM of a single layer
+    std::string m_xml_text;
+    std::vector<ov::XmlLayerText> m_layers;
 
 public:
     InputModelIRImpl(std::istream& stream,
                      const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights,
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
         : m_weights(weights),
-          m_extensions(extensions) {
-        pugi::xml_parse_result res = m_xml_doc.load(stream);
+          m_extensions(extensions),
+          m_xml_text(read_text(stream)) {
+        size_t begin = 0, end = 0;
+        pugi::xml_parse_result res;
+        if (split_layers(m_xml_text, begin, end, m_layers)) {
+            const auto skeleton = m_xml_text.substr(0, begin) + m_xml_text.substr(end);
+            res = m_xml_doc.load_buffer(skeleton.data(), skeleton.size());
+            if (res.status != pugi::status_ok && static_cast<size_t>(res.offset) >= begin)
+                res.offset += end - begin;
+        } else {
+            m_layers.clear();
+            res = m_xml_doc.load_buffer(m_xml_text.data(), m_xml_text.size());
+            std::string().swap(m_xml_text);
+        }
         if (res.status != pugi::status_ok) {
             IE_THROW() << res.description() << " at offset " << res.offset;
         }
@@ -230,7 +352,13 @@ std::shared_ptr<Function> InputModel::InputModelIRImpl::convert() {
 
     // Load default opsets
     size_t version = XMLParseUtils::GetUIntAttr(m_root, "version", 0);
-    ov::XmlDeserializer visitor(m_root, m_weights, m_opsets, m_extensions, variables, version);
+    ov::XmlDeserializer visitor(m_root,
+                                m_weights,
+                                m_opsets,
+                                m_extensions,
+                                variables,
+                                version,
+                                m_layers.empty() ? nullptr : &m_layers);
     std::shared_ptr<ngraph::Function> function;
     visitor.on_attribute("net", function);
     function->get_rt_info()["version"] = int64_t(version);
@@ -402,6 +402,14 @@ void XmlDeserializer::on_adapter(const std::string& name,
     adapter.set(ngraph_function);
 }
 
+static pugi::xml_node load_layer(pugi::xml_document& doc, const XmlLayerText& text) {
+    pugi::xml_parse_result res = doc.load_buffer(text.data, text.size);
+    if (res.status != pugi::status_ok) {
+        IE_THROW() << res.description() << " at offset " << text.offset + res.offset;
+    }
+    return doc.document_element();
+}
+
 std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     const pugi::xml_node& root,
     const std::shared_ptr<ngraph::runtime::AlignedBuffer>& weights) {
@@ -420,6 +428,7 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     struct node_params {
         pugi::xml_node xml;
         GenericLayerParams params;
+        const XmlLayerText* text;  // the layer is parsed again from the text if it is not in the DOM
     };
 
     std::map<size_t /*layer-id*/, node_params> params;
@@ -431,12 +440,12 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::set<size_t> dfs_used_nodes;
     std::map<size_t /*to-layer-id*/, std::vector<edge>> edges;
     // Read all layers and store their parameters in params map
-    FOREACH_CHILD (node, root.child("layers"), "layer") {
+    auto read_layer = [&](const pugi::xml_node& node, const XmlLayerText* text) {
         auto node_param = parseGenericParams(node);
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             IE_THROW() << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
+        params[node_param.layerId] = {text ? pugi::xml_node() : node, node_param, text};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
@@ -447,6 +456,16 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             order.push_back(node_param.layerId);
             edges[node_param.layerId] = {};
         }
+    };
+    if (m_layers) {
+        for (const auto& text : *m_layers) {
+            pugi::xml_document layer_doc;
+            read_layer(load_layer(layer_doc, text), &text);
+        }
+    } else {
+        FOREACH_CHILD (node, root.child("layers"), "layer") {
+            read_layer(node, nullptr);
+        }
     }
 
     // Read all edges and store them for further usage
@@ -496,7 +515,9 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
             inputs[realInputPortId] = input_node->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
+        // the document of the layer is released as soon as its node is created
+        pugi::xml_document layer_doc;
+        auto node = createNode(inputs, p.text ? load_layer(layer_doc, *p.text) : p.xml, weights, p.params);
         id_to_node[layer_id] = node;
 
         // Check that output shape after OpenVINO node validation the same as in IR
@@ -822,13 +843,17 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
         }
         ngraphNode->set_arguments(inputs);
         XmlDeserializer visitor(node, weights, m_opsets, m_extensions, m_variables, m_version);
+        ngraphNode->visit_attributes(visitor);
 
-        if (ngraphNode->visit_attributes(visitor)) {
-            ngraphNode->constructor_validate_and_infer_types();
+        if (const auto& sub_graph_op = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(ngraphNode)) {
+            // Cloning would copy the bodies, so the operation is validated as it is
+            sub_graph_op->set_output_size(sub_graph_op->get_output_descriptions(0).size());
+            sub_graph_op->constructor_validate_and_infer_types();
+        } else {
+            // To be sure that all default values will be initialized.
+            // The clone is validated by its constructor, so types are inferred only once per node
+            ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
         }
-
-        // To be sure that all default values will be initialized:
-        ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
     }
     if (!ngraphNode && m_extensions.count(ov::op::util::FrameworkNode::get_type_info_static())) {
         ngraphNode = std::make_shared<ov::op::util::FrameworkNode>(inputs);
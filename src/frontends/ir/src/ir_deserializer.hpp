@@ -58,6 +58,16 @@ struct GenericLayerParams {
     }
 };
 
+/**
+ * @brief Text of a top level layer of the IR, the layer is parsed into its own document right before
+ * its node is created, so the DOM of the whole topology is never built
+ */
+struct XmlLayerText {
+    const char* data;
+    size_t size;
+    size_t offset;  // offset of the layer in the IR, reported by the parsing errors
+};
+
 class XmlDeserializer : public ov::AttributeVisitor {
 public:
     explicit XmlDeserializer(const pugi::xml_node& node,
@@ -65,12 +75,14 @@ public:
                              const std::unordered_map<std::string, ov::OpSet>& opsets,
                              const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions,
                              std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& variables,
-                             size_t version)
+                             size_t version,
+                             const std::vector<XmlLayerText>* layers = nullptr)
         : m_node(node),
           m_weights(weights),
           m_opsets(opsets),
           m_extensions(extensions),
           m_variables(variables),
+          m_layers(layers),
           m_version(version) {}
 
     void on_adapter(const std::string& name, ov::ValueAccessor<std::string>& value) override {
@@ -192,6 +204,8 @@ private:
     const std::unordered_map<std::string, ov::OpSet>& m_opsets;
     const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& m_extensions;
     std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>>& m_variables;
+    // layers of the function which are not in the DOM of m_node, nullptr if the layers are read from the DOM
+    const std::vector<XmlLayerText>* m_layers;
 
     ///
     /// store information about parameters/results order during a model creation
@@ -1387,3 +1387,78 @@ TEST_F(IRFrontendTests, DetectionOutput) {
     ASSERT_NO_THROW(model = getWithIRFrontend(testModel));
     ASSERT_TRUE(!!model);
 }
+
+TEST_F(IRFrontendTests, model_is_converted_repeatedly) {
+    std::string testModel = R"V0G0N(
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3,22,22"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="activation" id="1" type="ReLU" version="opset1">
+            <input>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="1"/>
+        <edge from-layer="1" from-port="2" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::istringstream modelStringStream(testModel);
+    std::istream& modelStream = modelStringStream;
+    ov::AnyVector params{&modelStream};
+
+    auto FE = manager.load_by_model(params);
+    ASSERT_TRUE(!!FE);
+    auto inputModel = FE->load(params);
+    ASSERT_TRUE(!!inputModel);
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = FE->convert(inputModel));
+    ASSERT_TRUE(!!model);
+    ASSERT_EQ(3, model->get_ops().size());
+    ASSERT_EQ(ov::PartialShape({1, 3, 22, 22}), model->get_results()[0]->get_output_partial_shape(0));
+
+    // The XML document is kept by the input model, so every conversion creates a new model
+    std::shared_ptr<ov::Model> second_model;
+    ASSERT_NO_THROW(second_model = FE->convert(inputModel));
+    ASSERT_TRUE(!!second_model);
+    ASSERT_NE(model, second_model);
+    ASSERT_EQ(3, second_model->get_ops().size());
+    ASSERT_EQ(ov::PartialShape({1, 3, 22, 22}), second_model->get_results()[0]->get_output_partial_shape(0));
+}
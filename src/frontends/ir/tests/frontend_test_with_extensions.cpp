@@ -2,7 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#if defined(__GLIBC__)
+#    include <malloc.h>
+#endif
+
 #include "frontend_test.hpp"
+#include "openvino/op/op.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/opsets/opset1.hpp"
 
@@ -129,3 +135,93 @@ TEST_F(IRFrontendExtensionTests, custom_ops_test_without_extension) {
     ASSERT_THROW(model = core.read_model(customOpsModel, ov::Tensor()), ov::Exception);
     ASSERT_TRUE(!model);
 }
+
+namespace {
+size_t heap_in_use() {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    const auto info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+// Samples the heap in use when the node is created, so the peak memory of the conversion is observed
+class HeapProbe : public ov::op::Op {
+public:
+    OPENVINO_OP("HeapProbe", "extension");
+
+    HeapProbe() = default;
+    explicit HeapProbe(const ov::Output<ov::Node>& arg) : Op({arg}) {
+        constructor_validate_and_infer_types();
+    }
+
+    void validate_and_infer_types() override {
+        peak = std::max(peak, heap_in_use());
+        set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        return std::make_shared<HeapProbe>(new_args.at(0));
+    }
+
+    bool visit_attributes(ov::AttributeVisitor&) override {
+        return true;
+    }
+
+    static size_t peak;
+};
+
+size_t HeapProbe::peak = 0;
+}  // namespace
+
+TEST_F(IRFrontendExtensionTests, layers_are_parsed_one_by_one) {
+    if (heap_in_use() == 0)
+        GTEST_SKIP() << "The heap usage can't be queried";
+
+    // Every layer has a large runtime info section of unknown attributes, which are skipped by the reader,
+    // so the DOM of the whole document would take several times the size of the text
+    const size_t layers_num = 32, attributes_num = 2000;
+    const std::string port = "<port id=\"0\" precision=\"FP32\"><dim>1</dim><dim>16</dim></port>";
+    std::string rt_info = "<rt_info>";
+    for (size_t i = 0; i < attributes_num; i++)
+        rt_info += "<attribute name=\"unknown_" + std::to_string(i) + "\" version=\"0\" value=\"0\"/>";
+    rt_info += "</rt_info>";
+
+    std::string xml = "<net name=\"Network\" version=\"11\"><layers>";
+    xml += "<layer name=\"input\" type=\"Parameter\" id=\"0\" version=\"opset1\">"
+           "<data element_type=\"f32\" shape=\"1,16\"/><output>" +
+           port + "</output></layer>";
+    for (size_t i = 1; i <= layers_num; i++) {
+        xml += "<layer name=\"probe_" + std::to_string(i) + "\" type=\"HeapProbe\" id=\"" + std::to_string(i) +
+               "\" version=\"extension\">" + rt_info + "<input>" + port + "</input><output>" + port +
+               "</output></layer>";
+    }
+    xml += "<layer name=\"output\" type=\"Result\" id=\"" + std::to_string(layers_num + 1) +
+           "\" version=\"opset1\"><input>" + port + "</input></layer></layers><edges>";
+    for (size_t i = 0; i <= layers_num; i++) {
+        xml += "<edge from-layer=\"" + std::to_string(i) + "\" from-port=\"0\" to-layer=\"" + std::to_string(i + 1) +
+               "\" to-port=\"0\"/>";
+    }
+    xml += "</edges></net>";
+
+    std::istringstream modelStringStream(xml);
+    std::istream& modelStream = modelStringStream;
+    ov::AnyVector params{&modelStream};
+    auto FE = manager.load_by_model(params);
+    ASSERT_TRUE(!!FE);
+    FE->add_extension(std::make_shared<ov::OpExtension<HeapProbe>>());
+
+    HeapProbe::peak = 0;
+    const auto base = heap_in_use();
+    auto inputModel = FE->load(params);
+    ASSERT_TRUE(!!inputModel);
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = FE->convert(inputModel));
+    ASSERT_TRUE(!!model);
+    ASSERT_EQ(layers_num + 2, model->get_ops().size());
+
+    // The input model keeps the text, the DOM of the whole document is never built during the conversion
+    ASSERT_GT(HeapProbe::peak, base);
+    EXPECT_LT(HeapProbe::peak - base, 2 * xml.size());
+}
@@ -51,7 +51,7 @@ std::string TensorExternalData::load_external_data(const std::string& model_dir)
     if (filesize == -1) {
         throw error::invalid_external_data{*this};
     }
-    if (m_offset + m_data_length > filesize) {
+    if (m_offset > static_cast<uint64_t>(filesize) || m_data_length > static_cast<uint64_t>(filesize) - m_offset) {
         throw error::invalid_external_data{*this};
     }
 
@@ -72,6 +72,55 @@ std::string TensorExternalData::load_external_data(const std::string& model_dir)
     return read_data;
 }
 
+std::shared_ptr<MappedDataBuffer> TensorExternalData::load_external_mmap_data(const std::string& model_dir,
+                                                                              const MappedMemoryHandles& cache) const {
+    NGRAPH_SUPPRESS_DEPRECATED_START
+    auto full_path = file_util::path_join(model_dir, m_data_location);
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    file_util::convert_path_win_style(full_path);
+#endif
+    NGRAPH_SUPPRESS_DEPRECATED_END
+
+    std::shared_ptr<ov::util::MappedMemory> mapped_memory;
+    if (cache) {
+        const auto cached = cache->find(full_path);
+        if (cached != cache->end()) {
+            mapped_memory = cached->second;
+        }
+    }
+    if (!mapped_memory) {
+        try {
+#if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+            mapped_memory = ov::util::load_mmap_object(ov::util::string_to_wstring(full_path));
+#else
+            mapped_memory = ov::util::load_mmap_object(full_path);
+#endif
+        } catch (const std::runtime_error&) {
+            throw error::invalid_external_data{*this};
+        }
+        if (cache) {
+            cache->emplace(full_path, mapped_memory);
+        }
+    }
+
+    // the sum of the offset and the length may overflow, so the length is checked against the rest of the file
+    const uint64_t file_size = mapped_memory->size();
+    if (m_offset > file_size || m_data_length > file_size - m_offset) {
+        throw error::invalid_external_data{*this};
+    }
+    const uint64_t data_length = m_data_length > 0 ? m_data_length : file_size - m_offset;
+
+    if (m_sha1_digest.size() > 0) {
+        NGRAPH_WARN << "SHA1 checksum is not supported";
+    }
+
+    // there is nothing to point to at the end of the file or in an empty file, which isn't mapped at all
+    if (data_length == 0) {
+        return std::make_shared<MappedDataBuffer>(nullptr, 0, mapped_memory);
+    }
+    return std::make_shared<MappedDataBuffer>(mapped_memory->data() + m_offset, data_length, mapped_memory);
+}
+
 std::string TensorExternalData::to_string() const {
     std::stringstream s;
     s << "ExternalDataInfo(";
@@ -6,9 +6,20 @@
 
 #include <onnx/onnx_pb.h>
 
+#include <map>
+#include <memory>
+#include <string>
+
+#include "ngraph/runtime/shared_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
+
 namespace ngraph {
 namespace onnx_import {
 namespace detail {
+/// \brief Mappings of the external data files, the tensors stored in one file share one mapping
+using MappedMemoryHandles = std::shared_ptr<std::map<std::string, std::shared_ptr<ov::util::MappedMemory>>>;
+using MappedDataBuffer = ngraph::runtime::SharedBuffer<std::shared_ptr<ov::util::MappedMemory>>;
+
 /// \brief  Helper class used to load tensor data from external files
 class TensorExternalData {
 public:
@@ -23,6 +34,18 @@ public:
     /// \return     External binary data loaded into a std::string
     std::string load_external_data(const std::string& model_dir) const;
 
+    /// \brief      Map external data from tensor passed to constructor
+    ///
+    /// \note       If mapping of the external file fails,
+    ///             the invalid_external_data exception is thrown.
+    ///
+    /// \param      model_dir  Directory of the model the data location is relative to
+    /// \param      cache      Mappings of the already opened files, may be null
+    ///
+    /// \return     Buffer pointing to the tensor data inside of the mapped file
+    std::shared_ptr<MappedDataBuffer> load_external_mmap_data(const std::string& model_dir,
+                                                              const MappedMemoryHandles& cache) const;
+
     /// \brief      Represets parameter of external data as string
     ///
     /// \return     State of TensorExternalData as string representation
@@ -93,6 +93,24 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file) {
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_two_tensors_data_in_the_same_file_share_mapping) {
+    const auto function = onnx_import::import_onnx_model(
+        file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                             SERIALIZED_ZOO,
+                             "onnx/external_data/external_data_two_tensors_data_in_the_same_file.onnx"));
+
+    std::map<std::string, const char*> data;
+    for (const auto& op : function->get_ordered_ops()) {
+        if (const auto constant = ov::as_type_ptr<default_opset::Constant>(op)) {
+            data[constant->get_friendly_name()] = constant->get_data_ptr<char>();
+        }
+    }
+    ASSERT_EQ(data.count("data_a"), 1);
+    ASSERT_EQ(data.count("data_b"), 1);
+    // both constants point into the one mapping of the file, at the offsets of their data
+    EXPECT_EQ(data["data_b"] - data["data_a"], 4096);
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_external_data_exception) {
     try {
         auto function = onnx_import::import_onnx_model(
@@ -143,6 +161,37 @@ NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_data_length) {
     }
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_invalid_offset_equal_to_file_size) {
+    try {
+        auto function = onnx_import::import_onnx_model(
+            file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                                 SERIALIZED_ZOO,
+                                 "onnx/external_data/external_data_offset_equal_to_file_size.onnx"));
+        FAIL() << "Missing external data not detected";
+    } catch (const ngraph_error& error) {
+        EXPECT_PRED_FORMAT2(testing::IsSubstring,
+                            std::string("tensor.data, offset: 16, "
+                                        "data_length: 0)"),
+                            error.what());
+    } catch (...) {
+        FAIL() << "Importing onnx model failed for unexpected reason";
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_empty_tensor) {
+    const auto function =
+        onnx_import::import_onnx_model(file_util::path_join(CommonTestUtils::getExecutableDirectory(),
+                                                            SERIALIZED_ZOO,
+                                                            "onnx/external_data/external_data_empty_tensor.onnx"));
+
+    // the tensor at the end of the data file has no data to point to
+    auto test_case = test::TestCase(function, s_device);
+    test_case.add_input<float>(Shape{2}, {1.f, 2.f});
+    test_case.add_expected_output<float>(Shape{2}, {1.f, 2.f});
+
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, onnx_external_data_sanitize_path) {
     const auto function =
         onnx_import::import_onnx_model(file_util::path_join(CommonTestUtils::getExecutableDirectory(),
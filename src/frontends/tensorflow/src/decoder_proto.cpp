@@ -5,6 +5,7 @@
 #include "decoder_proto.hpp"
 
 #include "attr_value.pb.h"
+#include "graph.pb.h"
 #include "node_def.pb.h"
 #include "openvino/frontend/tensorflow/node_context.hpp"
 #include "openvino/frontend/tensorflow/special_types.hpp"
@@ -30,20 +31,28 @@ const std::map<::tensorflow::DataType, ov::element::Type>& TYPE_MAP() {
     return type_map;
 }
 
-template <typename T>
-void extract_tensor_content(const std::string& tensor_content, ov::Tensor* values) {
-    const auto tensor_content_size = tensor_content.size();
-    FRONT_END_GENERAL_CHECK(tensor_content_size % sizeof(T) == 0,
-                            "Size of tensor_content (",
-                            tensor_content_size,
-                            ") is not a multiple of ",
-                            sizeof(T));
+// Allocator of the tensor whose data is the content of the tensor in the graph, so the tensor shares the data and keeps
+// the graph alive instead of copying the data
+class TensorContentAllocator : public ov::AllocatorImpl {
+public:
+    TensorContentAllocator(const std::string& tensor_content, const std::shared_ptr<::tensorflow::GraphDef>& graph_def)
+        : m_tensor_content(tensor_content),
+          m_graph_def(graph_def) {}
 
-    const T* tensor_values = reinterpret_cast<const T*>(tensor_content.data());
-    FRONT_END_GENERAL_CHECK(values->get_size() == tensor_content_size / sizeof(T),
-                            "Size of tensor is not equal to tensor_content size.");
-    std::copy(tensor_values, tensor_values + tensor_content_size / sizeof(T), values->data<T>());
-}
+    void* allocate(const size_t, const size_t) override {
+        return const_cast<char*>(m_tensor_content.data());
+    }
+
+    void deallocate(void*, const size_t, size_t) override {}
+
+    bool is_equal(const ov::AllocatorImpl& other) const override {
+        return this == &other;
+    }
+
+private:
+    const std::string& m_tensor_content;
+    std::shared_ptr<::tensorflow::GraphDef> m_graph_def;
+};
 
 template <typename T>
 void extract_compressed_tensor_content(const ::tensorflow::TensorProto& tensor_proto,
@@ -86,22 +95,22 @@ void extract_compressed_tensor_content(const ::tensorflow::TensorProto& tensor_p
 }  // namespace
 
 ov::Any DecoderProto::get_attribute(const std::string& name) const {
-    auto attrs = decode_attribute_helper(name);
-    if (attrs.empty()) {
+    const auto attr = decode_attribute_helper(name);
+    if (!attr) {
         return {};
     }
 
-    switch (attrs[0].value_case()) {
+    switch (attr->value_case()) {
     case ::tensorflow::AttrValue::ValueCase::kB:
-        return attrs[0].b();
+        return attr->b();
     case ::tensorflow::AttrValue::ValueCase::kF:
-        return attrs[0].f();
+        return attr->f();
     case ::tensorflow::AttrValue::ValueCase::kS:
-        return attrs[0].s();
+        return attr->s();
     case ::tensorflow::AttrValue::ValueCase::kI:
-        return attrs[0].i();
+        return attr->i();
     case ::tensorflow::AttrValue::ValueCase::kShape: {
-        const auto& tf_shape = attrs[0].shape();
+        const auto& tf_shape = attr->shape();
         if (tf_shape.unknown_rank()) {
             return ov::PartialShape::dynamic();
         }
@@ -113,8 +122,8 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kType: {
-        if (TYPE_MAP().count(attrs[0].type())) {
-            return TYPE_MAP().at(attrs[0].type());
+        if (TYPE_MAP().count(attr->type())) {
+            return TYPE_MAP().at(attr->type());
         } else {
             // for all unsupported types return undefined type
             return ov::element::undefined;
@@ -122,7 +131,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kList: {
-        const auto& list = attrs[0].list();
+        const auto& list = attr->list();
         if (list.i_size())
             return std::vector<int64_t>(list.i().begin(), list.i().end());
 
@@ -166,7 +175,7 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
     }
 
     case ::tensorflow::AttrValue::ValueCase::kTensor: {
-        const auto& tensor_proto = attrs[0].tensor();
+        const auto& tensor_proto = attr->tensor();
         const auto& tf_shape = tensor_proto.tensor_shape();
         ov::PartialShape pshape;
         for (int i = 0; i < tf_shape.dim_size(); i++) {
@@ -178,66 +187,60 @@ ov::Any DecoderProto::get_attribute(const std::string& name) const {
             TYPE_MAP().count(tf_type),
             "Encountered unknown element type " + DataType_Name(tf_type) + " on an empty tensor_proto");
         auto ov_type = TYPE_MAP().at(tf_type);
-        ov::Tensor res(ov_type, pshape.get_shape());
-        auto tensor_content = tensor_proto.tensor_content();
+        const auto& tensor_content = tensor_proto.tensor_content();
         if (!tensor_content.empty() && tensor_proto.has_tensor_shape()) {
             switch (ov_type) {
             case ov::element::u8:
-                extract_tensor_content<uint8_t>(tensor_content, &res);
-                break;
             case ov::element::i8:
-                extract_tensor_content<int8_t>(tensor_content, &res);
-                break;
             case ov::element::i16:
-                extract_tensor_content<int16_t>(tensor_content, &res);
-                break;
             case ov::element::i32:
-                extract_tensor_content<int32_t>(tensor_content, &res);
-                break;
             case ov::element::i64:
-                extract_tensor_content<int64_t>(tensor_content, &res);
-                break;
             case ov::element::f16:
-                extract_tensor_content<float16>(tensor_content, &res);
-                break;
             case ov::element::f32:
-                extract_tensor_content<float>(tensor_content, &res);
-                break;
             case ov::element::f64:
-                extract_tensor_content<double>(tensor_content, &res);
-                break;
             case ov::element::bf16:
-                extract_tensor_content<bfloat16>(tensor_content, &res);
-                break;
-            default:
-                FRONT_END_THROW("Encountered unknown element type " + ov_type.get_type_name());
-            }
-        } else {
-            int64_t val_size = 0;
-            switch (ov_type) {
-            case ov::element::boolean:
-                val_size = tensor_proto.bool_val_size();
-                extract_compressed_tensor_content<bool>(tensor_proto, val_size, &res);
-                break;
-            case ov::element::i32:
-                val_size = tensor_proto.int_val_size();
-                extract_compressed_tensor_content<int32_t>(tensor_proto, val_size, &res);
-                break;
-            case ov::element::i64:
-                val_size = tensor_proto.int64_val_size();
-                extract_compressed_tensor_content<int64_t>(tensor_proto, val_size, &res);
-                break;
-            case ov::element::f32:
-                val_size = tensor_proto.float_val_size();
-                extract_compressed_tensor_content<float>(tensor_proto, val_size, &res);
-                break;
-            case ov::element::f64:
-                val_size = tensor_proto.double_val_size();
-                extract_compressed_tensor_content<double>(tensor_proto, val_size, &res);
                 break;
             default:
                 FRONT_END_THROW("Encountered unknown element type " + ov_type.get_type_name());
             }
+            const auto tensor_content_size = tensor_content.size();
+            FRONT_END_GENERAL_CHECK(tensor_content_size % ov_type.size() == 0,
+                                    "Size of tensor_content (",
+                                    tensor_content_size,
+                                    ") is not a multiple of ",
+                                    ov_type.size());
+            FRONT_END_GENERAL_CHECK(ov::shape_size(pshape.get_shape()) == tensor_content_size / ov_type.size(),
+                                    "Size of tensor is not equal to tensor_content size.");
+            // the tensor references the content owned by the graph, so the constant created from it shares the data
+            auto allocator = std::make_shared<TensorContentAllocator>(tensor_content, m_graph_def);
+            return ov::Tensor(ov_type, pshape.get_shape(), ov::Allocator(allocator));
+        }
+
+        ov::Tensor res(ov_type, pshape.get_shape());
+        int64_t val_size = 0;
+        switch (ov_type) {
+        case ov::element::boolean:
+            val_size = tensor_proto.bool_val_size();
+            extract_compressed_tensor_content<bool>(tensor_proto, val_size, &res);
+            break;
+        case ov::element::i32:
+            val_size = tensor_proto.int_val_size();
+            extract_compressed_tensor_content<int32_t>(tensor_proto, val_size, &res);
+            break;
+        case ov::element::i64:
+            val_size = tensor_proto.int64_val_size();
+            extract_compressed_tensor_content<int64_t>(tensor_proto, val_size, &res);
+            break;
+        case ov::element::f32:
+            val_size = tensor_proto.float_val_size();
+            extract_compressed_tensor_content<float>(tensor_proto, val_size, &res);
+            break;
+        case ov::element::f64:
+            val_size = tensor_proto.double_val_size();
+            extract_compressed_tensor_content<double>(tensor_proto, val_size, &res);
+            break;
+        default:
+            FRONT_END_THROW("Encountered unknown element type " + ov_type.get_type_name());
         }
         return res;
     }
@@ -287,14 +290,10 @@ const std::string& DecoderProto::get_op_name() const {
     return m_node_def->name();
 }
 
-std::vector<::tensorflow::AttrValue> DecoderProto::decode_attribute_helper(const std::string& name) const {
-    auto attr_map = m_node_def->attr();
-    if (attr_map.contains(name)) {
-        auto value = m_node_def->attr().at(name);
-        return {value};
-    } else {
-        return {};
-    }
+const ::tensorflow::AttrValue* DecoderProto::decode_attribute_helper(const std::string& name) const {
+    const auto& attr_map = m_node_def->attr();
+    const auto attr = attr_map.find(name);
+    return attr != attr_map.end() ? &attr->second : nullptr;
 }
 }  // namespace tensorflow
 }  // namespace frontend
@@ -14,7 +14,9 @@
 #include "openvino/frontend/tensorflow/graph_iterator.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
+#include "parallel_translation.hpp"
 #include "pass/transpose_sinking.hpp"
 #include "so_extension.hpp"
 #include "tf_framework_node.hpp"
@@ -63,7 +65,7 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
     const auto& model_inputs = model_tf->get_inputs();
     const auto& model_outputs = model_tf->get_outputs();
     const auto& model_frozen_inputs = model_tf->get_tensor_values();
-    std::map<const std::string, const std::function<ov::OutputVector(const NodeContext&)>> translate_map;
+    TranslateMap translate_map;
 
     const auto& TRANSLATE_OP_MAP = m_op_translators;
     if (no_conversion) {
@@ -101,14 +103,58 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
         ng_op_map[input_name] = {param};
     }
 
+    // register OV node outputs in the map for new operation node
+    auto register_outputs = [&](const std::string& operation_type,
+                                const std::string& operation_name,
+                                const ov::OutputVector& ng_outputs) {
+        for (const auto& output : ng_outputs) {
+            if (auto result = std::dynamic_pointer_cast<ov::opset8::Result>(output.get_node_shared_ptr())) {
+                // do not add RetVal type operation to ng_op_map
+                results.push_back(result);
+            } else {
+                auto param = std::dynamic_pointer_cast<ov::opset8::Parameter>(output.get_node_shared_ptr());
+                // avoid duplicating Parameter nodes if they are already in the Parameters vector
+                if (param && operation_type != "Identity" &&
+                    std::find(params.begin(), params.end(), param) == params.end()) {
+                    params.push_back(param);
+                }
+                ng_op_map[operation_name].push_back(output);
+            }
+        }
+    };
+
+    // convert the regions of the graph on several threads if it is requested
+    std::vector<ov::OutputVector> parallel_outputs;
+    const auto num_threads = ov::util::getenv_int("OV_TF_FRONTEND_CONVERSION_THREADS", 1);
+    if (num_threads > 1) {
+        try {
+            parallel_outputs = translate_operations_parallel(operation_places,
+                                                             ng_op_map,
+                                                             translate_map,
+                                                             static_cast<size_t>(num_threads));
+        } catch (const std::exception& ex) {
+            // the serial conversion reports the error or creates FrameworkNode for the failed operations
+            OPENVINO_DEBUG << "TensorFlow Frontend: parallel conversion failed, converting serially: " << ex.what();
+        }
+        if (m_telemetry) {
+            m_telemetry->send_event("parallel_conversion", parallel_outputs.empty() ? "fallback" : "succeeded");
+        }
+    }
+    const bool converted_in_parallel = !parallel_outputs.empty();
+
     // create the OV ops from TensorFlow ops
-    for (const auto& operation_place : operation_places) {
+    for (size_t op_idx = 0; op_idx < operation_places.size(); ++op_idx) {
+        const auto& operation_place = operation_places[op_idx];
         auto operation_decoder = operation_place->get_decoder();
         auto operation_name = operation_place->get_names()[0];
         // output for parameter nodes has been already generated
         if (ng_op_map.count(operation_name)) {
             continue;
         }
+        if (converted_in_parallel) {
+            register_outputs(operation_decoder->get_op_type(), operation_name, parallel_outputs[op_idx]);
+            continue;
+        }
 
         // prepare a list of OV node inputs for each node
         ov::OutputVector ng_inputs;
@@ -165,44 +211,8 @@ void FrontEnd::translate_graph(const ov::frontend::InputModel::Ptr& model,
         }
 
         // generate OV node output vector for the current operation node
-        ov::OutputVector ng_outputs;
-        try {
-            FRONT_END_OP_CONVERSION_CHECK(translate_map.count(operation_decoder->get_op_type()),
-                                          "No translator found for " + operation_decoder->get_op_type() + " node.");
-            auto op_fun = &(translate_map[operation_decoder->get_op_type()]);
-            // NodeContext node_context(ng_inputs, operation_decoder, model_inputs);
-            // TODO: Check why NodeContextNew doesn't have ngOutputVector ng_inputs input in constructor
-            NodeContext node_context(operation_decoder, ng_inputs);
-            // generate OV node output vector using translator for given operation type
-            ng_outputs = (*op_fun)(node_context);
-        } catch (...) {
-            if (fail_fast) {
-                // re-throw any exception
-                throw;
-            } else {
-                auto ng_node = std::make_shared<FrameworkNode>(operation_decoder,
-                                                               ng_inputs,
-                                                               operation_place->get_output_ports().size());
-                set_node_name(operation_name, ng_node);
-                ng_outputs = ng_node->outputs();
-            }
-        }
-
-        // register OV node outputs in the map for new operation node
-        for (const auto& output : ng_outputs) {
-            if (auto result = std::dynamic_pointer_cast<ov::opset8::Result>(output.get_node_shared_ptr())) {
-                // do not add RetVal type operation to ng_op_map
-                results.push_back(result);
-            } else {
-                auto param = std::dynamic_pointer_cast<ov::opset8::Parameter>(output.get_node_shared_ptr());
-                // avoid duplicating Parameter nodes if they are already in the Parameters vector
-                if (param && operation_decoder->get_op_type() != "Identity" &&
-                    std::find(params.begin(), params.end(), param) == params.end()) {
-                    params.push_back(param);
-                }
-                ng_op_map[operation_name].push_back(output);
-            }
-        }
+        auto ng_outputs = translate_operation(operation_place, ng_inputs, translate_map, fail_fast);
+        register_outputs(operation_decoder->get_op_type(), operation_name, ng_outputs);
     }
 
     // create Result nodes for all model outputs
@@ -25,6 +25,8 @@ class GraphIteratorProto : public GraphIterator {
 public:
     template <typename T>
     GraphIteratorProto(const std::basic_string<T>& path) : m_graph_def(std::make_shared<::tensorflow::GraphDef>()) {
+        // the stream is parsed by chunks, so the file is not held in memory next to the parsed message which owns
+        // the tensor content shared by the constants
         std::ifstream pb_stream(path, std::ios::in | std::ifstream::binary);
 
         FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file does not exist");
@@ -55,7 +57,7 @@ public:
 
     /// Return NodeContext for the current node that iterator points to
     std::shared_ptr<DecoderBase> get_decoder() const override {
-        return std::make_shared<DecoderProto>(m_nodes[node_index]);
+        return std::make_shared<DecoderProto>(m_nodes[node_index], m_graph_def);
     }
 };
 
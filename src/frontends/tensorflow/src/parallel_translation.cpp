@@ -0,0 +1,363 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "parallel_translation.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <exception>
+#include <ie_parallel.hpp>
+#include <limits>
+#include <set>
+#include <unordered_map>
+
+#include "openvino/core/validation_util.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "tf_framework_node.hpp"
+
+using namespace ov::frontend::tensorflow;
+
+namespace {
+constexpr size_t no_index = std::numeric_limits<size_t>::max();
+
+// the translators read values of the small integer inputs like axes and shapes only,
+// the proxies for the larger tensors are not folded to avoid the costly bounds evaluation
+constexpr size_t max_folded_proxy_size = 64;
+
+struct InputSource {
+    // name of ng_op_map entry or of the producing operation
+    std::string name;
+    size_t port;
+    // index of the producing operation or no_index for ng_op_map entry
+    size_t producer;
+};
+
+struct Region {
+    std::vector<size_t> operations;
+    std::set<size_t> producers;
+    // producer outputs and the proxies presenting them in the region, keyed by the input source
+    std::map<std::pair<std::string, size_t>, std::pair<ov::Output<ov::Node>, ov::Output<ov::Node>>> proxies;
+};
+
+// outputs that are registered in ng_op_map for the operation, Result nodes are not among them
+ov::Output<ov::Node> get_registered_output(const ov::OutputVector& outputs, size_t port) {
+    ov::OutputVector registered_outputs;
+    for (const auto& output : outputs) {
+        if (!ov::is_type<ov::opset8::Result>(output.get_node())) {
+            registered_outputs.push_back(output);
+        }
+    }
+    FRONT_END_GENERAL_CHECK(registered_outputs.size() > port, "Input created with pruning must have one output");
+    return registered_outputs[port];
+}
+
+ov::Output<ov::Node> create_proxy(const ov::Output<ov::Node>& output) {
+    if (const auto& constant = ov::as_type_ptr<ov::opset8::Constant>(output.get_node_shared_ptr())) {
+        return std::make_shared<ov::opset8::Constant>(*constant);
+    }
+    const auto& element_type = output.get_element_type();
+    const auto& partial_shape = output.get_partial_shape();
+    if (element_type.is_integral_number() && partial_shape.is_static() &&
+        ov::shape_size(partial_shape.to_shape()) <= max_folded_proxy_size) {
+        if (const auto& constant = ov::get_constant_from_source(output)) {
+            return constant;
+        }
+    }
+    return std::make_shared<ov::opset8::Parameter>(element_type, partial_shape);
+}
+
+// infers types of the nodes and their consumers again in the topological order
+void revalidate_consumers(const std::vector<ov::Input<ov::Node>>& inputs) {
+    std::unordered_map<ov::Node*, size_t> pending_inputs;
+    std::vector<ov::Node*> nodes_to_visit;
+    for (const auto& input : inputs) {
+        nodes_to_visit.push_back(input.get_node());
+    }
+    while (!nodes_to_visit.empty()) {
+        auto node = nodes_to_visit.back();
+        nodes_to_visit.pop_back();
+        if (!pending_inputs.emplace(node, 0).second) {
+            continue;
+        }
+        for (const auto& output : node->outputs()) {
+            for (const auto& input : output.get_target_inputs()) {
+                nodes_to_visit.push_back(input.get_node());
+            }
+        }
+    }
+
+    std::deque<ov::Node*> ready_nodes;
+    for (auto& node : pending_inputs) {
+        for (const auto& input_value : node.first->input_values()) {
+            node.second += pending_inputs.count(input_value.get_node());
+        }
+        if (node.second == 0) {
+            ready_nodes.push_back(node.first);
+        }
+    }
+    while (!ready_nodes.empty()) {
+        auto node = ready_nodes.front();
+        ready_nodes.pop_front();
+        node->validate_and_infer_types();
+        for (const auto& output : node->outputs()) {
+            for (const auto& input : output.get_target_inputs()) {
+                if (--pending_inputs.at(input.get_node()) == 0) {
+                    ready_nodes.push_back(input.get_node());
+                }
+            }
+        }
+    }
+}
+}  // namespace
+
+ov::OutputVector ov::frontend::tensorflow::translate_operation(const std::shared_ptr<OpPlace>& operation_place,
+                                                               const ov::OutputVector& ng_inputs,
+                                                               const TranslateMap& translate_map,
+                                                               bool fail_fast) {
+    auto operation_decoder = operation_place->get_decoder();
+    try {
+        auto translator_it = translate_map.find(operation_decoder->get_op_type());
+        FRONT_END_OP_CONVERSION_CHECK(translator_it != translate_map.end(),
+                                      "No translator found for " + operation_decoder->get_op_type() + " node.");
+        NodeContext node_context(operation_decoder, ng_inputs);
+        // generate OV node output vector using translator for given operation type
+        return translator_it->second(node_context);
+    } catch (...) {
+        if (fail_fast) {
+            // re-throw any exception
+            throw;
+        }
+        auto ng_node = std::make_shared<FrameworkNode>(operation_decoder,
+                                                       ng_inputs,
+                                                       operation_place->get_output_ports().size());
+        set_node_name(operation_place->get_names()[0], ng_node);
+        return ng_node->outputs();
+    }
+}
+
+std::vector<ov::OutputVector> ov::frontend::tensorflow::translate_operations_parallel(
+    const std::vector<std::shared_ptr<OpPlace>>& operation_places,
+    const OpMap& ng_op_map,
+    const TranslateMap& translate_map,
+    size_t num_threads) {
+    const auto num_operations = operation_places.size();
+    std::vector<ov::OutputVector> op_outputs(num_operations);
+    std::vector<std::vector<InputSource>> op_inputs(num_operations);
+    std::vector<size_t> op_regions(num_operations, no_index);
+    std::vector<bool> is_const(num_operations, false);
+    std::vector<size_t> first_consumers(num_operations, no_index);
+    std::vector<size_t> last_consumers(num_operations, no_index);
+    std::vector<size_t> consumers_count(num_operations, 0);
+    std::unordered_map<std::string, size_t> op_indices;
+    std::vector<Region> regions;
+
+    // resolve the inputs in the same order as the serial conversion does and partition the operations
+    for (size_t op_idx = 0; op_idx < num_operations; ++op_idx) {
+        const auto& operation_decoder = operation_places[op_idx]->get_decoder();
+        const auto operation_name = operation_places[op_idx]->get_names()[0];
+        if (ng_op_map.count(operation_name)) {
+            continue;
+        }
+        op_indices[operation_name] = op_idx;
+        // Constants are converted before the regions and have no inputs
+        if (operation_decoder->get_op_type() == "Const") {
+            is_const[op_idx] = true;
+            continue;
+        }
+
+        auto& inputs = op_inputs[op_idx];
+        for (size_t input_port_idx = 0; input_port_idx < operation_decoder->get_input_size(); ++input_port_idx) {
+            std::string producer_name;
+            size_t producer_port_idx;
+            operation_decoder->get_input_node(input_port_idx, producer_name, producer_port_idx);
+            if (is_conditional_edge(producer_name)) {
+                continue;
+            }
+
+            const auto input_name = std::to_string(input_port_idx) + ":" + operation_name;
+            const auto producer_port_name = producer_name + ":" + std::to_string(producer_port_idx);
+            if (ng_op_map.count(input_name)) {
+                FRONT_END_GENERAL_CHECK(ng_op_map.at(input_name).size() == 1,
+                                        "Input created with pruning must have one output");
+                inputs.push_back({input_name, 0, no_index});
+            } else if (ng_op_map.count(producer_port_name)) {
+                FRONT_END_GENERAL_CHECK(ng_op_map.at(producer_port_name).size() == 1,
+                                        "Input created with pruning must have one output");
+                inputs.push_back({producer_port_name, 0, no_index});
+            } else if (ng_op_map.count(producer_name)) {
+                FRONT_END_GENERAL_CHECK(ng_op_map.at(producer_name).size() > producer_port_idx,
+                                        "Input created with pruning must have one output");
+                inputs.push_back({producer_name, producer_port_idx, no_index});
+            } else {
+                FRONT_END_GENERAL_CHECK(op_indices.count(producer_name),
+                                        "No input is found for node \"" + operation_name + "\" by port " +
+                                            std::to_string(producer_port_idx));
+                const auto producer = op_indices.at(producer_name);
+                inputs.push_back({producer_name, producer_port_idx, producer});
+                if (last_consumers[producer] != op_idx) {
+                    last_consumers[producer] = op_idx;
+                    ++consumers_count[producer];
+                }
+                if (first_consumers[producer] == no_index) {
+                    first_consumers[producer] = op_idx;
+                }
+            }
+        }
+
+        // continue the region if all producers belong to it and the operation is the first consumer of one of
+        // them, the other consumers start own regions. Only the first operation of the region depends on the
+        // other regions, so the dependencies between the regions are acyclic
+        size_t region_idx = no_index;
+        bool continues_region = false;
+        bool same_region = true;
+        for (const auto& input : inputs) {
+            if (input.producer == no_index || is_const[input.producer]) {
+                continue;
+            }
+            if (region_idx == no_index) {
+                region_idx = op_regions[input.producer];
+            }
+            same_region = same_region && region_idx == op_regions[input.producer];
+            continues_region = continues_region || first_consumers[input.producer] == op_idx;
+        }
+        continues_region = continues_region && same_region;
+        if (!continues_region) {
+            region_idx = regions.size();
+            regions.emplace_back();
+        }
+        op_regions[op_idx] = region_idx;
+        regions[region_idx].operations.push_back(op_idx);
+    }
+
+    // a Constant with a single consumer is used directly, the other producers are presented by the proxies
+    auto is_shared_input = [&](const InputSource& input, size_t region_idx) {
+        if (input.producer == no_index) {
+            return true;
+        }
+        if (is_const[input.producer]) {
+            return consumers_count[input.producer] > 1;
+        }
+        return op_regions[input.producer] != region_idx;
+    };
+    // the regions are created after their producers, so the producer levels are known when the region is visited
+    std::vector<std::vector<size_t>> levels;
+    std::vector<size_t> region_levels(regions.size(), 0);
+    for (size_t region_idx = 0; region_idx < regions.size(); ++region_idx) {
+        auto& region = regions[region_idx];
+        for (const auto op_idx : region.operations) {
+            for (const auto& input : op_inputs[op_idx]) {
+                if (!is_shared_input(input, region_idx)) {
+                    continue;
+                }
+                region.proxies[{input.name, input.port}] = {};
+                if (input.producer != no_index && !is_const[input.producer]) {
+                    region.producers.insert(op_regions[input.producer]);
+                }
+            }
+        }
+        for (const auto producer_region : region.producers) {
+            region_levels[region_idx] = std::max(region_levels[region_idx], region_levels[producer_region] + 1);
+        }
+        if (levels.size() <= region_levels[region_idx]) {
+            levels.resize(region_levels[region_idx] + 1);
+        }
+        levels[region_levels[region_idx]].push_back(region_idx);
+    }
+
+    // the failed translations are not replaced with FrameworkNode, since the proxies may hide the inputs the
+    // translators need, the caller converts the model serially instead
+    for (size_t op_idx = 0; op_idx < num_operations; ++op_idx) {
+        if (is_const[op_idx]) {
+            op_outputs[op_idx] = translate_operation(operation_places[op_idx], {}, translate_map, true);
+        }
+    }
+
+    auto get_producer_output = [&](const std::string& name, size_t port) {
+        const auto op_it = op_indices.find(name);
+        if (op_it != op_indices.end()) {
+            return get_registered_output(op_outputs[op_it->second], port);
+        }
+        return ng_op_map.at(name).at(port);
+    };
+    // called when the producer regions are converted and stitched
+    auto create_proxies = [&](Region& region) {
+        for (auto& proxy : region.proxies) {
+            const auto& output = get_producer_output(proxy.first.first, proxy.first.second);
+            proxy.second = {output, create_proxy(output)};
+        }
+    };
+    auto translate_region = [&](size_t region_idx) {
+        const auto& region = regions[region_idx];
+        for (const auto op_idx : region.operations) {
+            ov::OutputVector ng_inputs;
+            for (const auto& input : op_inputs[op_idx]) {
+                if (is_shared_input(input, region_idx)) {
+                    ng_inputs.push_back(region.proxies.at({input.name, input.port}).second);
+                } else {
+                    ng_inputs.push_back(get_registered_output(op_outputs[input.producer], input.port));
+                }
+            }
+            op_outputs[op_idx] = translate_operation(operation_places[op_idx], ng_inputs, translate_map, true);
+        }
+    };
+    // called when no region is translated, connects the region to the producer outputs instead of the proxies
+    auto stitch_region = [&](size_t region_idx) {
+        auto& region = regions[region_idx];
+        std::unordered_map<ov::Node*, ov::Output<ov::Node>> replacements;
+        std::vector<ov::Input<ov::Node>> inputs_to_revalidate;
+        for (auto& proxy : region.proxies) {
+            const auto& output = proxy.second.first;
+            const auto& proxy_output = proxy.second.second;
+            // the consumers of integer Parameter proxy may infer more precise shapes from the values and bounds
+            // of the producer, the other proxies give the consumers the same types as the producers do
+            const bool revalidate = ov::is_type<ov::opset8::Parameter>(proxy_output.get_node()) &&
+                                    proxy_output.get_element_type().is_integral_number();
+            for (auto& input : proxy_output.get_target_inputs()) {
+                input.replace_source_output(output);
+                if (revalidate) {
+                    inputs_to_revalidate.push_back(input);
+                }
+            }
+            replacements[proxy_output.get_node()] = output;
+        }
+        revalidate_consumers(inputs_to_revalidate);
+        for (const auto op_idx : region.operations) {
+            for (auto& output : op_outputs[op_idx]) {
+                const auto replacement_it = replacements.find(output.get_node());
+                if (replacement_it != replacements.end()) {
+                    output = replacement_it->second;
+                }
+            }
+        }
+        region.proxies.clear();
+    };
+
+    // the regions of one level depend only on the regions of the previous levels, so they are translated in
+    // parallel and stitched when all of them are translated
+    for (const auto& level : levels) {
+        for (const auto region_idx : level) {
+            create_proxies(regions[region_idx]);
+        }
+        const auto level_threads = std::min(num_threads, level.size());
+        std::vector<std::exception_ptr> errors(level.size());
+        InferenceEngine::parallel_for(level_threads, [&](size_t thread_idx) {
+            for (size_t idx = thread_idx; idx < level.size(); idx += level_threads) {
+                try {
+                    translate_region(level[idx]);
+                } catch (...) {
+                    errors[idx] = std::current_exception();
+                }
+            }
+        });
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        for (const auto region_idx : level) {
+            stitch_region(region_idx);
+        }
+    }
+    return op_outputs;
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "openvino/frontend/tensorflow/node_context.hpp"
+#include "place.hpp"
+#include "utils.hpp"
+
+namespace ov {
+namespace frontend {
+namespace tensorflow {
+
+using TranslateMap = std::map<const std::string, const std::function<ov::OutputVector(const NodeContext&)>>;
+
+/// \brief Converts the operation using the translator for its type. If the conversion fails and fail_fast is not
+/// set, FrameworkNode is created for the operation.
+ov::OutputVector translate_operation(const std::shared_ptr<OpPlace>& operation_place,
+                                     const ov::OutputVector& ng_inputs,
+                                     const TranslateMap& translate_map,
+                                     bool fail_fast);
+
+/// \brief Converts the operations on several threads.
+///
+/// The operations are partitioned into regions, each region is a chain of operations that continues the
+/// first consumer of its producers. The regions are grouped into levels by the longest chain of the regions
+/// they depend on, the regions of one level are converted in parallel with the runtime threading. The outputs
+/// produced outside of the region are presented to its translators with proxy nodes: a copy of Constant, a
+/// folded Constant for the small integer tensors that the translators read values of, and Parameter
+/// otherwise. The proxies are replaced with the producer outputs when the level is converted, so the threads
+/// never modify nodes of the other regions. The translators of the operations must be reentrant.
+///
+/// A translator may fail on a proxy which hides the input values it needs, so the translator exceptions are
+/// always rethrown and the caller is expected to convert the model serially.
+///
+/// \param operation_places Topologically sorted operations
+/// \param ng_op_map Outputs of the model inputs, operations which names are in the map are not converted
+/// \param translate_map Translators for the operation types
+/// \param num_threads Maximum number of regions converted at once
+/// \return Converted outputs for every operation in operation_places
+std::vector<ov::OutputVector> translate_operations_parallel(
+    const std::vector<std::shared_ptr<OpPlace>>& operation_places,
+    const OpMap& ng_op_map,
+    const TranslateMap& translate_map,
+    size_t num_threads);
+
+}  // namespace tensorflow
+}  // namespace frontend
+}  // namespace ov
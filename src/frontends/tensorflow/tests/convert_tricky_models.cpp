@@ -3,8 +3,12 @@
 //
 
 #include <openvino/frontend/exception.hpp>
+#include <openvino/frontend/extension/telemetry.hpp>
 #include <openvino/frontend/manager.hpp>
+#include <openvino/op/util/framework_node.hpp>
+#include <openvino/opsets/opset8.hpp>
 
+#include "common_test_utils/ngraph_test_utils.hpp"
 #include "test_common.hpp"
 #include "tf_utils.hpp"
 #include "utils.hpp"
@@ -37,3 +41,93 @@ TEST(FrontEndConvertModelTest, test_undefined_input_shape) {
         }
     }
 }
+
+TEST(FrontEndConvertModelTest, test_tensor_content_constant) {
+    shared_ptr<Model> model;
+    {
+        FrontEndManager fem;
+        FrontEnd::Ptr frontEnd;
+        InputModel::Ptr inputModel;
+        ASSERT_NO_THROW(frontEnd = fem.load_by_framework(TF_FE));
+        ASSERT_NE(frontEnd, nullptr);
+        auto model_filename = FrontEndTestUtils::make_model_path(string(TEST_TENSORFLOW_MODELS_DIRNAME) +
+                                                                 string("constant_content/constant_content.pb"));
+        ASSERT_NO_THROW(inputModel = frontEnd->load(model_filename));
+        ASSERT_NE(inputModel, nullptr);
+        ASSERT_NO_THROW(model = frontEnd->convert(inputModel));
+        ASSERT_NE(model, nullptr);
+    }
+
+    // the constant shares the tensor content of the model, so the data has to outlive the input model
+    size_t constants = 0;
+    for (auto& node : model->get_ordered_ops()) {
+        if (auto constant = as_type_ptr<opset8::Constant>(node)) {
+            ASSERT_EQ(constant->get_shape(), (Shape{2, 2}));
+            ASSERT_EQ(constant->cast_vector<float>(), (vector<float>{1, 2, 3, 4}));
+            constants++;
+        }
+    }
+    ASSERT_EQ(constants, 1);
+}
+
+namespace {
+// converts the model and collects the labels of the parallel conversion telemetry events
+shared_ptr<Model> convert_with_events(const string& model_path, bool partially, vector<string>& events) {
+    FrontEndManager fem;
+    auto frontEnd = fem.load_by_framework(TF_FE);
+    auto on_event = [&events](const string& category, const string& action, const string& label, int value) {
+        if (action == "parallel_conversion") {
+            events.push_back(label);
+        }
+    };
+    auto on_error = [](const string& category, const string& message) {};
+    frontEnd->add_extension(make_shared<TelemetryExtension>("mock", on_event, on_error, on_error));
+    auto model_filename = FrontEndTestUtils::make_model_path(string(TEST_TENSORFLOW_MODELS_DIRNAME) + model_path);
+    auto input_model = frontEnd->load(model_filename);
+    return partially ? frontEnd->convert_partially(input_model) : frontEnd->convert(input_model);
+}
+}  // namespace
+
+TEST(FrontEndConvertModelTest, test_parallel_conversion) {
+    const string model_path = "independent_branches/independent_branches.pb";
+    vector<string> events;
+    shared_ptr<Model> model_ref, model;
+    ASSERT_NO_THROW(model_ref = convert_with_events(model_path, false, events));
+    ASSERT_TRUE(events.empty());
+
+    // the branches of the model are converted on different threads and connected back in the serial order
+    FrontEndTestUtils::set_test_env("OV_TF_FRONTEND_CONVERSION_THREADS", "4");
+    EXPECT_NO_THROW(model = convert_with_events(model_path, false, events));
+    FrontEndTestUtils::unset_test_env("OV_TF_FRONTEND_CONVERSION_THREADS");
+    ASSERT_NE(model, nullptr);
+    ASSERT_EQ(events, vector<string>{"succeeded"});
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::TENSOR_NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES)
+                        .enable(FunctionsComparator::PRECISIONS);
+    const auto res = fc.compare(model, model_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
+
+TEST(FrontEndConvertModelTest, test_parallel_conversion_fallback) {
+    const string model_path = "relu_unsupported/relu_unsupported.pb";
+    vector<string> events;
+    shared_ptr<Model> model_ref, model;
+    ASSERT_NO_THROW(model_ref = convert_with_events(model_path, true, events));
+
+    // the unsupported operation fails the parallel conversion, the serial one replaces it with FrameworkNode
+    FrontEndTestUtils::set_test_env("OV_TF_FRONTEND_CONVERSION_THREADS", "4");
+    EXPECT_NO_THROW(model = convert_with_events(model_path, true, events));
+    FrontEndTestUtils::unset_test_env("OV_TF_FRONTEND_CONVERSION_THREADS");
+    ASSERT_NE(model, nullptr);
+    ASSERT_EQ(events, vector<string>{"fallback"});
+
+    size_t framework_nodes = 0;
+    for (const auto& node : model->get_ordered_ops()) {
+        framework_nodes += ov::is_type<ov::op::util::FrameworkNode>(node);
+    }
+    ASSERT_EQ(framework_nodes, 1);
+    const auto res = FunctionsComparator::with_default().compare(model, model_ref);
+    ASSERT_TRUE(res.valid) << res.message;
+}
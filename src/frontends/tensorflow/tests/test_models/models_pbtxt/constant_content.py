@@ -0,0 +1,16 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+
+import numpy as np
+import tensorflow.compat.v1 as tf
+
+tf.reset_default_graph()
+
+with tf.Session() as sess:
+    x = tf.placeholder(dtype=tf.float32, shape=[2, 2], name='x')
+    w = tf.constant(np.array([[1, 2], [3, 4]], dtype=np.float32), name='w')
+    tf.add(x, w, name="add")
+
+    tf.global_variables_initializer()
+    tf.io.write_graph(sess.graph, '.', 'constant_content.pbtxt', as_text=True)
@@ -0,0 +1,18 @@
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+
+import tensorflow.compat.v1 as tf
+
+tf.reset_default_graph()
+
+with tf.Session() as sess:
+    x = tf.placeholder(dtype=tf.float32, shape=[2, 3], name='x')
+    scale = tf.constant(2.0, dtype=tf.float32, name='scale')
+    mul = tf.multiply(tf.nn.relu(x, name='relu'), scale, name='mul')
+    add = tf.add(tf.sigmoid(x, name='sigmoid'), scale, name='add')
+    reshape = tf.reshape(tf.tanh(x, name='tanh'), tf.shape(x, name='shape'), name='reshape')
+    tf.concat([mul, add, reshape], axis=1, name='concat')
+
+    tf.global_variables_initializer()
+    tf.io.write_graph(sess.graph, '.', 'independent_branches.pbtxt', as_text=True)
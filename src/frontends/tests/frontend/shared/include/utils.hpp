@@ -49,6 +49,14 @@ inline int set_test_env(const char* name, const char* value) {
 #endif
 }
 
+inline int unset_test_env(const char* name) {
+#ifdef _WIN32
+    return _putenv_s(name, "");
+#elif defined(__linux) || defined(__APPLE__)
+    return unsetenv(name);
+#endif
+}
+
 inline void setupTestEnv() {
     NGRAPH_SUPPRESS_DEPRECATED_START
     // we cannot use ov::util since implementation from that library statically
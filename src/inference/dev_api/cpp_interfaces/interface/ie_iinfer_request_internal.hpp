@@ -13,6 +13,7 @@
 #include "ie_compound_blob.h"
 #include "ie_input_info.hpp"
 #include "ie_preprocess_data.hpp"
+#include "openvino/core/any.hpp"
 #include "openvino/core/node_output.hpp"
 #include "so_ptr.hpp"
 
@@ -196,6 +197,19 @@ public:
      */
     virtual void SetCallback(Callback callback);
 
+    /**
+     * @brief Sets properties of the infer request, e.g. ov::hint::request_priority
+     * @param properties - map of pairs: (property name, property value)
+     */
+    virtual void SetProperties(const ov::AnyMap& properties);
+
+    /**
+     * @brief Gets the infer request property
+     * @param name - property name
+     * @return Property value
+     */
+    virtual ov::Any GetProperty(const std::string& name) const;
+
     /**
      * @brief      Check that @p blob is valid. Throws an exception if it's not.
      *
@@ -92,6 +92,48 @@ DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
  */
 DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Enables concurrent execution of independent graph branches inside one CPU stream (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_INTER_OP_PARALLEL);
+
+/**
+ * @brief Places the intermediate tensors of dynamic CPU graphs in one arena by the memory plans cached per input shapes
+ * (YES/NO, NO by default)
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_DYNAMIC_MEMORY_ARENA);
+
+/**
+ * @brief Defines the scope of the CPU runtime parameters cache:
+ * STREAM - each stream owns its cache (default), NETWORK - the streams of a network share one thread safe cache,
+ * PROCESS - all the networks with the same cache capacity share one thread safe cache.
+ * The counters of the cache are read by the CPU_RUNTIME_CACHE_STATISTICS property of the compiled model
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_SHARING);
+DECLARE_CONFIG_VALUE(STREAM);
+DECLARE_CONFIG_VALUE(NETWORK);
+DECLARE_CONFIG_VALUE(PROCESS);
+
+/**
+ * @brief Defines the scope of the CPU constant weights sharing:
+ * NETWORK - the streams of a network share the weights (default), PROCESS - identical weights of all the networks
+ * of the process which use this scope are stored once.
+ * The counters of the process store are read by the CPU_WEIGHTS_SHARING_STATISTICS property of the compiled model
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_WEIGHTS_CACHE_SHARING);
+
+/**
+ * @brief Latency budget (in ms) of a request executed via the Auto-Batching, "0" (default) keeps the fixed timeout.
+ * When set, the collected requests are flushed as soon as waiting for the full batch would break the budget of the
+ * oldest one; several batches may be in flight and the partial batches run on the smaller batch variants of the network
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(AUTO_BATCH_LATENCY_BUDGET);
+
 /**
  * @brief This key should be used to force disable export while loading network even if global cache dir is defined
  *        Used by HETERO plugin to disable automatic caching of subnetworks (set value to YES)
@@ -108,6 +150,15 @@ DECLARE_CONFIG_KEY(CONFIG_DEVICE_ID);
  * @brief enable hyper thread
  */
 DECLARE_CONFIG_KEY(ENABLE_HYPER_THREAD);
+
+/**
+ * @brief Number of polls of the empty task queues before an idle CPU streams executor thread falls asleep
+ * (non negative integer, 100 by default). Every poll yields the CPU, so 100 polls keep the thread awake for the
+ * gap between the back to back inferences (tens of microseconds) and the next task is picked up without the wake up.
+ * Zero makes the threads sleep right away, the dispatch costs about the same as with the mutex guarded queue then,
+ * see CPUStreamsExecutorTests.DISABLED_benchmarkDispatch
+ */
+DECLARE_CONFIG_KEY(CPU_STREAMS_SPIN_COUNT);
 }  // namespace PluginConfigInternalParams
 
 }  // namespace InferenceEngine
@@ -121,4 +172,33 @@ namespace ov {
  */
 static constexpr Property<std::vector<PropertyName>, PropertyMutability::RO> caching_properties{"CACHING_PROPERTIES"};
 
+/**
+ * @brief Read-only property to get hit, miss and eviction counters of the CPU runtime parameters cache used by the
+ * compiled model. The counters are accumulated over all the caches of the model streams; a cache shared with other
+ * models is reported as a whole. The property is internal, so it is not listed in ov::supported_properties
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the NUMA placement of the CPU compiled model memory (intermediate tensors and
+ * constants of all the streams, the scratchpads and the shared weights cache are not counted). The values are numbers
+ * of resident bytes per "node_<id>" key, the pages which are not resident yet are reported as "not_resident". The map
+ * is empty if the placement can't be queried. The property is internal, so it is not listed in ov::supported_properties
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_memory_numa_statistics{
+    "CPU_MEMORY_NUMA_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the counters of the CPU weights store shared by the process: "hits", "misses",
+ * "saved_bytes" (the bytes not allocated thanks to the hits) and "stored_bytes" (the bytes of the alive weights).
+ * The store is reported as a whole, the map is empty if the compiled model doesn't share its weights with the process.
+ * The property is internal, so it is not listed in ov::supported_properties
+ * @ingroup ie_dev_api_plugin_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_weights_sharing_statistics{
+    "CPU_WEIGHTS_SHARING_STATISTICS"};
+
 }  // namespace ov
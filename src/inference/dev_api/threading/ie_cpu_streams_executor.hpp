@@ -9,8 +9,10 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "threading/ie_istreams_executor.hpp"
 
@@ -20,7 +22,8 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        It uses custom threads to pull tasks from the per stream lock-free queues, the idle streams steal
+ *        the tasks from the queues of the busy ones and poll the queues for a while before falling asleep.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -48,6 +51,36 @@ public:
 
     int GetNumaNodeId() override;
 
+    /**
+     * @brief Runs the task on a stream bound to the NUMA node.
+     *        If no stream of the executor uses the node the task is executed by any stream like run() does
+     * @param task A task to start
+     * @param numaNodeId An id of the NUMA node
+     */
+    void RunOnNumaNode(Task task, int numaNodeId);
+
+    /**
+     * @brief Runs the task ordered by its priority and deadline. The tasks of a higher priority are started first,
+     *        the tasks of the same priority are started in the order of their deadlines (earliest deadline first).
+     *        The tasks started by run() and RunOnNumaNode() go after all the tasks of non negative priority
+     *        and before the tasks of negative priority
+     * @param task A task to start
+     * @param priority A priority of the task, zero and positive values go before the run() tasks, negative ones go
+     *        after them
+     * @param deadline A deadline of the task, the time point maximum means no deadline
+     * @param numaNodeId An id of the NUMA node the task has to be executed on, negative values mean any node
+     */
+    void RunWithPriority(Task task,
+                         int priority,
+                         std::chrono::steady_clock::time_point deadline,
+                         int numaNodeId = -1);
+
+    /**
+     * @brief Returns NUMA nodes used by the executor streams
+     * @return A vector of NUMA nodes ids
+     */
+    std::vector<int> GetUsedNumaNodes() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -104,6 +104,8 @@ public:
         int _threads_per_stream_small = 0;  //!< Threads per stream in small cores
         int _small_core_offset = 0;         //!< Calculate small core start offset when binding cpu cores
         bool _enable_hyper_thread = true;   //!< enable hyper thread
+        int _spinCount = 100;               //!< Number of polls of the empty task queues before an idle stream thread
+                                            //!< falls asleep, zero makes the threads sleep right away
         enum StreamMode { DEFAULT, AGGRESSIVE, LESSAGGRESSIVE };
         enum PreferredCoreType {
             ANY,
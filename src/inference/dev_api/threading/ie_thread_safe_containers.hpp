@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <type_traits>
@@ -138,4 +139,105 @@ protected:
     bool _capacity = false;
 };
 #endif
+
+/**
+ * @brief Bounded multi-producer multi-consumer queue which doesn't use locks.
+ *        Every cell carries a sequence number telling whether it is ready to be written or read on the current lap,
+ *        so producers and consumers only contend on the position counters
+ * @tparam T A type of the queue elements, it should be default constructible and movable
+ */
+template <typename T>
+class LockFreeBoundedQueue {
+public:
+    /**
+     * @brief Constructor
+     * @param capacity A maximum number of elements, rounded up to the power of two
+     */
+    explicit LockFreeBoundedQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity)
+            size <<= 1;
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i)
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+    }
+
+    LockFreeBoundedQueue(const LockFreeBoundedQueue&) = delete;
+    LockFreeBoundedQueue& operator=(const LockFreeBoundedQueue&) = delete;
+
+    /**
+     * @brief Pushes the element if the queue is not full
+     * @param value An element, it is moved from only if it was pushed
+     * @return true if the element was pushed
+     */
+    bool try_push(T&& value) {
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            const auto sequence = cell._sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell._value = std::move(value);
+                    cell._sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // the cell still keeps the element of the previous lap
+                return false;
+            } else {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Pops the element if the queue is not empty
+     * @param value A popped element
+     * @return true if the element was popped
+     */
+    bool try_pop(T& value) {
+        auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            auto& cell = _cells[pos & _mask];
+            const auto sequence = cell._sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell._value);
+                    cell._value = T{};
+                    cell._sequence.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Checks if the queue is empty. The result is approximate if the queue is concurrently modified
+     */
+    bool empty() const {
+        return _enqueuePos.load(std::memory_order_acquire) == _dequeuePos.load(std::memory_order_acquire);
+    }
+
+protected:
+    struct Cell {
+        std::atomic<std::size_t> _sequence{0};
+        T _value;
+    };
+    // the counters are kept on the separate cache lines, so producers don't invalidate the line read by consumers
+    static constexpr std::size_t cacheLineSize = 64;
+    std::unique_ptr<Cell[]> _cells;
+    std::size_t _mask = 0;
+    char _pad0[cacheLineSize];
+    std::atomic<std::size_t> _enqueuePos{0};
+    char _pad1[cacheLineSize];
+    std::atomic<std::size_t> _dequeuePos{0};
+    char _pad2[cacheLineSize];
+};
 }  // namespace InferenceEngine
@@ -34,5 +34,13 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key for enabling of the pipelined execution of the subgraphs.
+ * The value is the number of the infer requests which can be in flight in the subgraphs at once, each of them gets
+ * a slot with own subgraph infer requests and intermediate blobs, so the subsequent requests overlap across the
+ * devices. 0 (default) means the subgraphs of each infer request are executed by its own subgraph infer requests.
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_DEPTH);
+
 }  // namespace HeteroConfigParams
 }  // namespace InferenceEngine
@@ -16,6 +16,7 @@
 #include "openvino/core/node_output.hpp"
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/profiling_info.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/tensor.hpp"
 #include "openvino/runtime/variable_state.hpp"
 
@@ -274,6 +275,46 @@ public:
      */
     std::vector<ProfilingInfo> get_profiling_info() const;
 
+    /**
+     * @brief Sets properties for the infer request, e.g. ov::hint::request_priority.
+     * @note Not all plugins support the infer request properties.
+     *       Calling the method while the request is running leads to throwning the ov::Busy exception.
+     *
+     * @param properties Map of pairs: (property name, property value).
+     */
+    void set_property(const AnyMap& properties);
+
+    /**
+     * @brief Sets properties for the infer request.
+     *
+     * @tparam Properties Should be the pack of `std::pair<std::string, ov::Any>` types.
+     * @param properties Optional pack of pairs: (property name, property value).
+     */
+    template <typename... Properties>
+    util::EnableIfAllStringAny<void, Properties...> set_property(Properties&&... properties) {
+        set_property(AnyMap{std::forward<Properties>(properties)...});
+    }
+
+    /**
+     * @brief Gets properties of the infer request.
+     *
+     * @param name Property key, can be found in openvino/runtime/properties.hpp.
+     * @return Property value.
+     */
+    Any get_property(const std::string& name) const;
+
+    /**
+     * @brief Gets properties of the infer request.
+     *
+     * @tparam T Type of a returned value.
+     * @param property  Property  object.
+     * @return Value of property.
+     */
+    template <typename T, PropertyMutability mutability>
+    T get_property(const ov::Property<T, mutability>& property) const {
+        return get_property(property.name()).template as<T>();
+    }
+
     /**
      * @brief Starts inference of specified input(s) in asynchronous mode.
      * @note It returns immediately. Inference starts also immediately.
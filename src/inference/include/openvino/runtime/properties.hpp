@@ -228,6 +228,13 @@ static constexpr Property<std::string, PropertyMutability::RO> model_name{"NETWO
 static constexpr Property<uint32_t, PropertyMutability::RO> optimal_number_of_infer_requests{
     "OPTIMAL_NUMBER_OF_INFER_REQUESTS"};
 
+/**
+ * @brief Read-only property to get the time in microseconds which the infer request waited for execution after its
+ * last InferRequest::start_async
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> request_queue_wait_time{"REQUEST_QUEUE_WAIT_TIME"};
+
 /**
  * @brief Namespace with hint properties
  */
@@ -287,6 +294,21 @@ inline std::istream& operator>>(std::istream& is, Priority& priority) {
  */
 static constexpr Property<Priority> model_priority{"MODEL_PRIORITY"};
 
+/**
+ * @brief High-level OpenVINO infer request priority hint
+ * Defines which of the infer requests of a compiled model waiting for execution should be started first
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<Priority> request_priority{"REQUEST_PRIORITY"};
+
+/**
+ * @brief High-level OpenVINO infer request deadline hint in milliseconds counted from InferRequest::start_async
+ * The waiting infer requests of the same priority are started in the order of their deadlines, a request which is not
+ * started before its deadline is cancelled. 0 (default) means no deadline
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t> request_deadline{"REQUEST_DEADLINE"};
+
 /**
  * @brief Enum to define possible performance mode hints
  * @ingroup ov_runtime_cpp_prop_api
@@ -16,8 +16,10 @@
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/variant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/fix_rt_info.hpp"
 #include "transformations/hash.hpp"
@@ -41,6 +43,19 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
+static void collectConstants(const std::shared_ptr<const ov::Model>& model,
+                             std::vector<std::shared_ptr<ov::op::v0::Constant>>& constants) {
+    for (const auto& op : model->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op)) {
+            constants.push_back(constant);
+        } else if (auto subgraph = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(op)) {
+            for (size_t i = 0; i < subgraph->get_internal_subgraphs_size(); i++) {
+                collectConstants(subgraph->get_function(static_cast<int>(i)), constants);
+            }
+        }
+    }
+}
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -72,9 +87,31 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     uint64_t seed = 0;
     // 1. Calculate hash on function
     CNNNetwork net(network);
+
+    // Digests of the weights are computed in parallel once per buffer shared by the constants,
+    // the Hash pass below only hashes the topology and picks the ready digests up
+    ov::pass::Hash::ConstantDigests digests;
+    {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::IE_LT, "NetworkCompilationContext::computeHash - Constants");
+        std::vector<std::shared_ptr<ov::op::v0::Constant>> constants;
+        collectConstants(net.getFunction(), constants);
+        std::vector<std::shared_ptr<ov::op::v0::Constant>> unique;
+        for (const auto& constant : constants) {
+            if (digests.emplace(std::make_pair(constant->get_data_ptr(), constant->get_byte_size()), 0).second)
+                unique.push_back(constant);
+        }
+        std::vector<uint64_t> values(unique.size());
+        parallel_for(unique.size(), [&](size_t i) {
+            values[i] = ov::pass::Hash::hash_constant(*unique[i]);
+        });
+        for (size_t i = 0; i < unique.size(); i++) {
+            digests[{unique[i]->get_data_ptr(), unique[i]->get_byte_size()}] = values[i];
+        }
+    }
+
     ov::pass::Manager m;
     m.register_pass<ngraph::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
+    m.register_pass<ov::pass::Hash>(seed, digests);
     m.run_passes(net.getFunction());
 
     // 2. Compute hash on serialized data and options
@@ -83,11 +120,16 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     }
 
     // 3. Add runtime information which may not be serialized
+    std::stringstream strm;
     for (const auto& op : network.getFunction()->get_ordered_ops()) {
         const auto& rt = op->get_rt_info();
         for (const auto& rtMapData : rt) {
             seed = hash_combine(seed, rtMapData.first);
-            std::stringstream strm;
+            if (rtMapData.second.is<std::string>()) {
+                seed = hash_combine(seed, rtMapData.second.as<std::string>());
+                continue;
+            }
+            strm.str(std::string());
             rtMapData.second.print(strm);
             seed = hash_combine(seed, strm.str());
         }
@@ -421,6 +421,14 @@ void InferRequest::cancel() {
     OV_INFER_REQ_CALL_STATEMENT(_impl->Cancel();)
 }
 
+void InferRequest::set_property(const AnyMap& properties) {
+    OV_INFER_REQ_CALL_STATEMENT({ _impl->SetProperties(properties); })
+}
+
+Any InferRequest::get_property(const std::string& name) const {
+    OV_INFER_REQ_CALL_STATEMENT({ return _impl->GetProperty(name); })
+}
+
 std::vector<ProfilingInfo> InferRequest::get_profiling_info() const {
     OV_INFER_REQ_CALL_STATEMENT({
         auto ieInfos = _impl->GetPerformanceCounts();
@@ -453,6 +453,14 @@ void IInferRequestInternal::SetCallback(Callback callback) {
     _callback = std::move(callback);
 }
 
+void IInferRequestInternal::SetProperties(const ov::AnyMap&) {
+    IE_THROW(NotImplemented);
+}
+
+ov::Any IInferRequestInternal::GetProperty(const std::string&) const {
+    IE_THROW(NotImplemented);
+}
+
 void IInferRequestInternal::execDataPreprocessing(InferenceEngine::BlobMap& preprocessedBlobs, bool serial) {
     for (auto& input : preprocessedBlobs) {
         // If there is a pre-process entry for an input then it must be pre-processed
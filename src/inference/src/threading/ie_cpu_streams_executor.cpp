@@ -4,10 +4,12 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <climits>
 #include <condition_variable>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <openvino/itt.hpp>
@@ -22,11 +24,29 @@
 #include "threading/ie_executor_manager.hpp"
 #include "threading/ie_thread_affinity.hpp"
 #include "threading/ie_thread_local.hpp"
+#include "threading/ie_thread_safe_containers.hpp"
 
 using namespace openvino;
 
 namespace InferenceEngine {
 struct CPUStreamsExecutor::Impl {
+    using TaskQueue = LockFreeBoundedQueue<Task>;
+    static constexpr std::size_t queueCapacity = 1024;
+
+    struct PrioritizedTask {
+        Task _task;
+        int _priority;
+        std::chrono::steady_clock::time_point _deadline;
+        std::size_t _order;
+    };
+
+    struct PrioritizedTasks {
+        // the heap is guarded by the executor mutex
+        std::vector<PrioritizedTask> _heap;
+        // the tasks of non negative priority, the streams check them before every pop without the mutex
+        std::atomic<std::size_t> _urgentSize{0};
+    };
+
     struct Stream {
 #if IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO
         struct Observer : public custom::task_scheduler_observer {
@@ -275,35 +295,182 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        for (auto&& numaNodeId : _usedNumaNodes) {
+            _numaTaskQueues.emplace(numaNodeId, std::unique_ptr<TaskQueue>(new TaskQueue(queueCapacity)));
+            _numaOverflowQueues[numaNodeId];
+            _numaPrioritizedTasks[numaNodeId];
+        }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _streamTaskQueues.emplace_back(new TaskQueue(queueCapacity));
+        }
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
+                auto& stream = *(_streams.local());
+                while (!_isStopped.load(std::memory_order_acquire)) {
                     Task task;
-                    {
+                    // the queues are polled for a while before the thread falls asleep,
+                    // so the tasks which come in a row are picked up without the wake up latency
+                    bool found = Pop(task, streamId, stream._numaNodeId);
+                    for (int spin = 0; !found && spin < _config._spinCount; ++spin) {
+                        std::this_thread::yield();
+                        found = Pop(task, streamId, stream._numaNodeId);
+                    }
+                    if (!found) {
                         std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        _parkedThreads.fetch_add(1);
+                        // pairs with the fence of the producers, either the producer sees the parked thread
+                        // or the thread sees the pushed task
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        while (!HasTasks(stream._numaNodeId) && !_isStopped.load(std::memory_order_acquire)) {
+                            _queueCondVar.wait(lock);
+                            // the woken up thread is not counted as waking up anymore, even if it goes back to sleep
+                            if (_wakingThreads.load(std::memory_order_relaxed) > 0)
+                                _wakingThreads.fetch_sub(1, std::memory_order_relaxed);
                         }
+                        _parkedThreads.fetch_sub(1);
+                        continue;
                     }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
-                    }
+                    Execute(task, stream);
                 }
             });
         }
     }
 
+    bool Pop(Task& task, int streamId, int numaNodeId) {
+        if (PopPrioritized(task, numaNodeId, true))
+            return true;
+        // the tasks which didn't fit into the full queues were submitted before the ones which are in the queues
+        // now, so they are drained first and don't starve while the producers keep the queues busy
+        if (_overflowSize.load(std::memory_order_acquire) != 0) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for (auto queue : {&_numaOverflowQueues.at(numaNodeId), &_overflowQueue}) {
+                if (!queue->empty()) {
+                    task = std::move(queue->front());
+                    queue->pop();
+                    _overflowSize.fetch_sub(1, std::memory_order_release);
+                    return true;
+                }
+            }
+        }
+        // tasks bound to the stream NUMA node can't be taken by other streams, so they go first
+        auto& numaTaskQueue = _numaTaskQueues.at(numaNodeId);
+        if (numaTaskQueue->try_pop(task) || _streamTaskQueues[streamId]->try_pop(task))
+            return true;
+        // the neighbour streams are tried first, they are likely to share the NUMA node
+        const auto streams = static_cast<int>(_streamTaskQueues.size());
+        for (int i = 1; i < streams; ++i) {
+            if (_streamTaskQueues[(streamId + i) % streams]->try_pop(task))
+                return true;
+        }
+        return PopPrioritized(task, numaNodeId, false);
+    }
+
+    // the task which has to be started first is on the top of the heap
+    static bool IsStartedAfter(const PrioritizedTask& lhs, const PrioritizedTask& rhs) {
+        if (lhs._priority != rhs._priority)
+            return lhs._priority < rhs._priority;
+        if (lhs._deadline != rhs._deadline)
+            return lhs._deadline > rhs._deadline;
+        return lhs._order > rhs._order;
+    }
+
+    // pops the task of non negative priority if it's urgent, it goes before the run() tasks, and any task otherwise
+    bool PopPrioritized(Task& task, int numaNodeId, bool urgent) {
+        auto& numaPrioritizedTasks = _numaPrioritizedTasks.at(numaNodeId);
+        if (urgent ? _prioritizedTasks._urgentSize.load(std::memory_order_acquire) == 0 &&
+                         numaPrioritizedTasks._urgentSize.load(std::memory_order_acquire) == 0
+                   : _prioritizedSize.load(std::memory_order_acquire) == 0)
+            return false;
+        std::lock_guard<std::mutex> lock(_mutex);
+        PrioritizedTasks* tasks = nullptr;
+        for (auto candidate : {&_prioritizedTasks, &numaPrioritizedTasks}) {
+            if (!candidate->_heap.empty() &&
+                (tasks == nullptr || IsStartedAfter(tasks->_heap.front(), candidate->_heap.front())))
+                tasks = candidate;
+        }
+        if (tasks == nullptr || (urgent && tasks->_heap.front()._priority < 0))
+            return false;
+        auto& heap = tasks->_heap;
+        std::pop_heap(heap.begin(), heap.end(), IsStartedAfter);
+        task = std::move(heap.back()._task);
+        if (heap.back()._priority >= 0)
+            tasks->_urgentSize.fetch_sub(1, std::memory_order_release);
+        heap.pop_back();
+        _prioritizedSize.fetch_sub(1, std::memory_order_release);
+        return true;
+    }
+
+    bool HasTasks(int numaNodeId) const {
+        if (!_numaTaskQueues.at(numaNodeId)->empty() || !_overflowQueue.empty() ||
+            !_numaOverflowQueues.at(numaNodeId).empty() || !_prioritizedTasks._heap.empty() ||
+            !_numaPrioritizedTasks.at(numaNodeId)._heap.empty())
+            return true;
+        return std::any_of(_streamTaskQueues.begin(), _streamTaskQueues.end(), [](const std::unique_ptr<TaskQueue>& queue) {
+            return !queue->empty();
+        });
+    }
+
+    void Push(Task task, TaskQueue& queue, std::queue<Task>& overflowQueue, bool wakeAll) {
+        if (!queue.try_push(std::move(task))) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            overflowQueue.emplace(std::move(task));
+            _overflowSize.fetch_add(1, std::memory_order_release);
+        }
+        WakeUp(wakeAll);
+    }
+
+    void WakeUp(bool wakeAll) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        // the threads which are already notified pick up the task as well, so the burst of tasks doesn't cost
+        // a notification per task
+        if (_parkedThreads.load(std::memory_order_relaxed) <= _wakingThreads.load(std::memory_order_relaxed))
+            return;
+        {
+            // the mutex is taken, so the thread which is going to sleep either waits already or sees the task
+            std::lock_guard<std::mutex> lock(_mutex);
+            const auto parkedThreads = _parkedThreads.load(std::memory_order_relaxed);
+            if (parkedThreads <= _wakingThreads.load(std::memory_order_relaxed))
+                return;
+            _wakingThreads.store(wakeAll ? parkedThreads : _wakingThreads.load(std::memory_order_relaxed) + 1,
+                                 std::memory_order_relaxed);
+        }
+        if (wakeAll) {
+            _queueCondVar.notify_all();
+        } else {
+            _queueCondVar.notify_one();
+        }
+    }
+
     void Enqueue(Task task) {
+        // the tasks are spread over the streams, the idle streams steal them from the busy ones
+        const auto streamId = _nextStreamId.fetch_add(1, std::memory_order_relaxed) % _streamTaskQueues.size();
+        Push(std::move(task), *_streamTaskQueues[streamId], _overflowQueue, false);
+    }
+
+    void Enqueue(Task task, int numaNodeId) {
+        auto numaTaskQueue = _numaTaskQueues.find(numaNodeId);
+        if (numaTaskQueue == _numaTaskQueues.end()) {
+            Enqueue(std::move(task));
+            return;
+        }
+        // the woken up stream may belong to another NUMA node, so all of them are notified
+        Push(std::move(task), *numaTaskQueue->second, _numaOverflowQueues.at(numaNodeId), true);
+    }
+
+    void Enqueue(Task task, int priority, std::chrono::steady_clock::time_point deadline, int numaNodeId) {
+        auto numaPrioritizedTasks = _numaPrioritizedTasks.find(numaNodeId);
+        auto& tasks = numaPrioritizedTasks == _numaPrioritizedTasks.end() ? _prioritizedTasks
+                                                                         : numaPrioritizedTasks->second;
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            tasks._heap.push_back({std::move(task), priority, deadline, _prioritizedOrder++});
+            std::push_heap(tasks._heap.begin(), tasks._heap.end(), IsStartedAfter);
+            if (priority >= 0)
+                tasks._urgentSize.fetch_add(1, std::memory_order_release);
+            _prioritizedSize.fetch_add(1, std::memory_order_release);
         }
-        _queueCondVar.notify_one();
+        WakeUp(&tasks != &_prioritizedTasks);
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -340,10 +507,25 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
+    // the queues are created before the stream threads are started and are not changed later
+    std::vector<std::unique_ptr<TaskQueue>> _streamTaskQueues;
+    std::map<int, std::unique_ptr<TaskQueue>> _numaTaskQueues;
+    std::atomic<std::size_t> _nextStreamId{0};
+    // the mutex guards the queues of the tasks which didn't fit into the lock-free ones and the sleep of the threads
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    std::queue<Task> _overflowQueue;
+    std::map<int, std::queue<Task>> _numaOverflowQueues;
+    std::atomic<std::size_t> _overflowSize{0};
+    // the tasks ordered by priority and deadline, they are guarded by the mutex as well
+    PrioritizedTasks _prioritizedTasks;
+    std::map<int, PrioritizedTasks> _numaPrioritizedTasks;
+    std::size_t _prioritizedOrder = 0;
+    std::atomic<std::size_t> _prioritizedSize{0};
+    std::atomic<int> _parkedThreads{0};
+    // the parked threads which are notified and haven't woken up yet, changed under the mutex
+    std::atomic<int> _wakingThreads{0};
+    std::atomic<bool> _isStopped{false};
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -373,7 +555,7 @@ CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) :
 CPUStreamsExecutor::~CPUStreamsExecutor() {
     {
         std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
+        _impl->_isStopped.store(true, std::memory_order_release);
     }
     _impl->_queueCondVar.notify_all();
     for (auto& thread : _impl->_threads) {
@@ -395,4 +577,27 @@ void CPUStreamsExecutor::run(Task task) {
     }
 }
 
+void CPUStreamsExecutor::RunOnNumaNode(Task task, int numaNodeId) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), numaNodeId);
+    }
+}
+
+void CPUStreamsExecutor::RunWithPriority(Task task,
+                                         int priority,
+                                         std::chrono::steady_clock::time_point deadline,
+                                         int numaNodeId) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), priority, deadline, numaNodeId);
+    }
+}
+
+std::vector<int> CPUStreamsExecutor::GetUsedNumaNodes() const {
+    return _impl->_usedNumaNodes;
+}
+
 }  // namespace InferenceEngine
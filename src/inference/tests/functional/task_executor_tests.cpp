@@ -2,7 +2,15 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <future>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <string>
 
 #include <gtest/gtest.h>
 
@@ -11,6 +19,7 @@
 #include <threading/ie_immediate_executor.hpp>
 #include <ie_system_conf.h>
 #include <thread>
+#include <vector>
 
 using namespace ::testing;
 using namespace std;
@@ -238,5 +247,199 @@ static auto AsyncExecutors = ::testing::Values(
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
 
+TEST(CPUStreamsExecutorTests, runOnNumaNodeUsesStreamOfTheNode) {
+    auto streams = std::max(2, static_cast<int>(getAvailableNUMANodes().size()));
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", streams});
+    for (auto numaNodeId : executor->GetUsedNumaNodes()) {
+        std::promise<int> promise;
+        auto future = promise.get_future();
+        executor->RunOnNumaNode([&] {
+            promise.set_value(executor->GetNumaNodeId());
+        }, numaNodeId);
+        ASSERT_EQ(numaNodeId, future.get());
+    }
+}
+
+TEST(CPUStreamsExecutorTests, runOnUnusedNumaNodeUsesAnyStream) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 2});
+    auto usedNumaNodes = executor->GetUsedNumaNodes();
+    auto unusedNumaNodeId = *std::max_element(usedNumaNodes.begin(), usedNumaNodes.end()) + 1;
+    std::promise<void> promise;
+    auto future = promise.get_future();
+    executor->RunOnNumaNode([&] {
+        promise.set_value();
+    }, unusedNumaNodeId);
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(10)));
+}
+
+TEST(CPUStreamsExecutorTests, runsAllTasksOfManyProducers) {
+    // the tasks don't fit into the queues of the streams, so the overflow path is checked too
+    constexpr int producers = 4;
+    constexpr int tasksPerProducer = 5000;
+    for (auto spinCount : {0, 100}) {
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", 4};
+        config._spinCount = spinCount;
+        auto executor = std::make_shared<CPUStreamsExecutor>(config);
+        std::atomic<int> executed{0};
+        std::promise<void> promise;
+        auto future = promise.get_future();
+        std::vector<std::thread> threads;
+        for (int i = 0; i < producers; ++i) {
+            threads.emplace_back([&] {
+                for (int j = 0; j < tasksPerProducer; ++j) {
+                    executor->run([&] {
+                        if (++executed == producers * tasksPerProducer)
+                            promise.set_value();
+                    });
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(30)));
+        ASSERT_EQ(producers * tasksPerProducer, executed.load());
+    }
+}
 
+namespace {
+// the dispatch of the streams executor before the lock-free queues: one queue guarded by the mutex
+class MutexQueueExecutor : public ITaskExecutor {
+public:
+    explicit MutexQueueExecutor(int threads) {
+        for (int i = 0; i < threads; ++i) {
+            _threads.emplace_back([this] {
+                while (true) {
+                    Task task;
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        _condVar.wait(lock, [&] {
+                            return _isStopped || !_tasks.empty();
+                        });
+                        if (_tasks.empty())
+                            return;
+                        task = std::move(_tasks.front());
+                        _tasks.pop();
+                    }
+                    task();
+                }
+            });
+        }
+    }
 
+    ~MutexQueueExecutor() override {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _isStopped = true;
+        }
+        _condVar.notify_all();
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    void run(Task task) override {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _tasks.push(std::move(task));
+        }
+        _condVar.notify_one();
+    }
+
+private:
+    std::mutex _mutex;
+    std::condition_variable _condVar;
+    std::queue<Task> _tasks;
+    bool _isStopped = false;
+    std::vector<std::thread> _threads;
+};
+}  // namespace
+
+// run with --gtest_also_run_disabled_tests to compare the dispatch of the empty tasks with the mutex guarded queue
+TEST(CPUStreamsExecutorTests, DISABLED_benchmarkDispatch) {
+    constexpr int streams = 4;
+    constexpr int producers = 4;
+    constexpr int tasksPerProducer = 50000;
+    constexpr int roundTrips = 20000;
+    auto benchmark = [&](const std::string& name, const ITaskExecutor::Ptr& executor) {
+        std::atomic<int> executed{0};
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (int i = 0; i < producers; ++i) {
+            threads.emplace_back([&] {
+                for (int j = 0; j < tasksPerProducer; ++j) {
+                    executor->run([&] {
+                        ++executed;
+                    });
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        while (executed.load() != producers * tasksPerProducer) {
+            std::this_thread::yield();
+        }
+        const auto throughputEnd = std::chrono::steady_clock::now();
+        // the latency of the task submitted to the idle executor
+        for (int i = 0; i < roundTrips; ++i) {
+            std::promise<void> promise;
+            executor->run([&] {
+                promise.set_value();
+            });
+            promise.get_future().wait();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        std::cout << name << ": " << producers * tasksPerProducer << " tasks of " << producers << " producers "
+                  << std::chrono::duration<double, std::milli>(throughputEnd - start).count() << " ms, round trip "
+                  << std::chrono::duration<double, std::micro>(end - throughputEnd).count() / roundTrips << " us"
+                  << std::endl;
+    };
+
+    benchmark("mutex guarded queue", std::make_shared<MutexQueueExecutor>(streams));
+    for (auto spinCount : {0, 100}) {
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams};
+        config._spinCount = spinCount;
+        benchmark("streams executor, spin count " + std::to_string(spinCount),
+                  std::make_shared<CPUStreamsExecutor>(config));
+    }
+}
+
+TEST(CPUStreamsExecutorTests, runsTasksByPriorityAndDeadline) {
+    auto executor = std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1});
+    // the only stream is busy while the tasks are queued, so all of them are ordered at once
+    std::promise<void> started;
+    std::promise<void> unblock;
+    auto unblocked = unblock.get_future().share();
+    executor->run([&started, unblocked] {
+        started.set_value();
+        unblocked.wait();
+    });
+    started.get_future().wait();
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    std::promise<void> promise;
+    auto future = promise.get_future();
+    auto task = [&](std::string name) {
+        return [&, name] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(name);
+            if (order.size() == 6)
+                promise.set_value();
+        };
+    };
+    const auto now = std::chrono::steady_clock::now();
+    const auto noDeadline = std::chrono::steady_clock::time_point::max();
+    executor->RunWithPriority(task("low"), -1, now + std::chrono::milliseconds(1), -1);
+    executor->run(task("fifo"));
+    executor->RunWithPriority(task("medium_late"), 0, now + std::chrono::seconds(20), -1);
+    executor->RunWithPriority(task("medium"), 0, noDeadline, -1);
+    executor->RunWithPriority(task("medium_early"), 0, now + std::chrono::seconds(10), -1);
+    executor->RunWithPriority(task("high"), 1, noDeadline, -1);
+    unblock.set_value();
+
+    ASSERT_EQ(std::future_status::ready, future.wait_for(std::chrono::seconds(30)));
+    const std::vector<std::string> expected{"high", "medium_early", "medium_late", "medium", "fifo", "low"};
+    ASSERT_EQ(expected, order);
+}
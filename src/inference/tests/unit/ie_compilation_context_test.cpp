@@ -403,6 +403,43 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentWeights) {
+    auto replaceMulConstant = [](CNNNetwork& cnnNet, int8_t value) {
+        for (const auto& op : cnnNet.getFunction()->get_ops()) {
+            if (op->get_friendly_name() == "mul_constant") {
+                auto constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {value});
+                constant->set_friendly_name("mul_constant");
+                constant->get_output_tensor(0).set_names({"mul_constant"});
+                ngraph::replace_node(op, constant);
+                break;
+            }
+        }
+    };
+    auto net1 = createNetwork();
+    auto net2 = createNetwork();
+    auto hash1 = NetworkCompilationContext::computeHash(net1, {});
+    ASSERT_EQ(hash1, NetworkCompilationContext::computeHash(net2, {}));
+
+    replaceMulConstant(net2, 4);
+    auto hash2 = NetworkCompilationContext::computeHash(net2, {});
+    ASSERT_NE(hash1, hash2);
+
+    replaceMulConstant(net1, 4);
+    ASSERT_EQ(hash2, NetworkCompilationContext::computeHash(net1, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithWeightsChangedInPlace) {
+    auto net = createNetwork();
+    auto hash1 = NetworkCompilationContext::computeHash(net, {});
+    for (const auto& op : net.getFunction()->get_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(op)) {
+            auto data = static_cast<int8_t*>(constant->get_data_ptr_nc());
+            data[0] = static_cast<int8_t>(data[0] + 1);
+        }
+    }
+    ASSERT_NE(hash1, NetworkCompilationContext::computeHash(net, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -30,6 +30,13 @@ using namespace InferenceEngine;
 std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
                                                  CONFIG_KEY(AUTO_BATCH_TIMEOUT),
                                                  CONFIG_KEY(CACHE_DIR)};
+// the keys that are accepted, but not reported in the SUPPORTED_CONFIG_KEYS
+std::vector<std::string> internal_configKeys = {CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_BUDGET)};
+
+static bool isSupportedConfigKey(const std::string& name) {
+    return supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name) ||
+           internal_configKeys.end() != std::find(internal_configKeys.begin(), internal_configKeys.end(), name);
+}
 
 template <Precision::ePrecision precision>
 Blob::Ptr create_shared_blob_on_top_of_batched_blob(Blob::Ptr batched_blob,
@@ -335,13 +342,29 @@ void AutoBatchInferRequest::CopyInputsIfNeeded() {
     for (const auto& it : _networkInputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(GetBlob(name), _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), true);
+        CopyBlobIfNeeded(GetBlob(name),
+                         _myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         true,
+                         _batchId,
+                         _batchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyInputsIfNeeded(InferenceEngine::SoIInferRequestInternal& req,
+                                               size_t batchId,
+                                               size_t batchSize) {
+    for (const auto& it : _networkInputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(GetBlob(name), req->GetBlob(name), true, batchId, batchSize);
     }
 }
 
 void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
                                              InferenceEngine::Blob::Ptr dst,
-                                             bool bInput) {
+                                             bool bInput,
+                                             size_t batchId,
+                                             size_t batchSize) {
     auto bufferDst = dst->buffer();
     auto ptrDst = bufferDst.as<char*>();
     auto bufferSrc = src->cbuffer();
@@ -349,13 +372,13 @@ void AutoBatchInferRequest::CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
     ptrdiff_t szDst = dst->byteSize();
     ptrdiff_t szSrc = src->byteSize();
     if (bInput) {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szDst / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szDst / batchSize : 0;
         if ((ptrDst + offset) == ptrSrc)
             return;
         else
             memcpy(ptrDst + offset, ptrSrc, szSrc);
     } else {
-        ptrdiff_t offset = szSrc != szDst ? _batchId * szSrc / _batchSize : 0;
+        ptrdiff_t offset = szSrc != szDst ? batchId * szSrc / batchSize : 0;
         if ((ptrSrc + offset) == ptrDst)
             return;
         else
@@ -367,7 +390,21 @@ void AutoBatchInferRequest::CopyOutputsIfNeeded() {
     for (const auto& it : _networkOutputs) {
         auto& name = it.first;
         // this request is already in BUSY state, so using the internal functions safely
-        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name), GetBlob(name), false);
+        CopyBlobIfNeeded(_myBatchedRequestWrapper._inferRequestBatched->GetBlob(name),
+                         GetBlob(name),
+                         false,
+                         _batchId,
+                         _batchSize);
+    }
+}
+
+void AutoBatchInferRequest::CopyOutputsIfNeeded(InferenceEngine::SoIInferRequestInternal& req,
+                                                size_t batchId,
+                                                size_t batchSize) {
+    for (const auto& it : _networkOutputs) {
+        auto& name = it.first;
+        // this request is already in BUSY state, so using the internal functions safely
+        CopyBlobIfNeeded(req->GetBlob(name), GetBlob(name), false, batchId, batchSize);
     }
 }
 
@@ -386,7 +423,17 @@ AutoBatchAsyncInferRequest::AutoBatchAsyncInferRequest(
             std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
             t.first = _this;
             t.second = std::move(task);
+            _this->_inferRequest->_arrivalTime = std::chrono::steady_clock::now();
             workerInferRequest._tasks.push(t);
+            if (workerInferRequest._continuousBatching) {
+                // the worker tracks the deadline of every collected request, so it is woken up on each arrival
+                // (the mutex guarantees the worker either sees the new task or is already waiting for the notification)
+                {
+                    std::lock_guard<std::mutex> lock(workerInferRequest._mutex);
+                }
+                workerInferRequest._cond.notify_one();
+                return;
+            }
             // it is ok to call size() here as the queue only grows (and the bulk removal happens under the mutex)
             const int sz = static_cast<int>(workerInferRequest._tasks.size());
             if (sz == workerInferRequest._batchSize) {
@@ -413,6 +460,8 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> AutoBatchAsyn
     CheckState();
     if (AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
         return _inferRequest->_myBatchedRequestWrapper._inferRequestBatched->GetPerformanceCounts();
+    else if (AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED == _inferRequest->_wasBatchedRequestUsed)
+        return _inferRequest->_partialBatchRequest->GetPerformanceCounts();
     else
         return _inferRequestWithoutBatch->GetPerformanceCounts();
 }
@@ -432,7 +481,8 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
     const DeviceInformation& networkDevice,
     const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
     const std::set<std::string>& batchedInputs,
-    const std::set<std::string>& batchedOutputs)
+    const std::set<std::string>& batchedOutputs,
+    const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& partialBatchNetworks)
     : InferenceEngine::ExecutableNetworkThreadSafeDefault(nullptr,
                                                           std::make_shared<InferenceEngine::ImmediateExecutor>()),
       _network{networkWithBatch},
@@ -442,14 +492,22 @@ AutoBatchExecutableNetwork::AutoBatchExecutableNetwork(
       _batchedOutputs(batchedOutputs) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
     _device = networkDevice;
+    _partialBatchNetworks = partialBatchNetworks;
     auto time_out = config.find(CONFIG_KEY(AUTO_BATCH_TIMEOUT));
     IE_ASSERT(time_out != config.end());
     _timeOut = ParseTimeoutValue(time_out->second.as<std::string>());
+    auto latency_budget = config.find(CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_BUDGET));
+    if (latency_budget != config.end())
+        _latencyBudget = ParseTimeoutValue(latency_budget->second.as<std::string>());
 }
 
 AutoBatchExecutableNetwork::~AutoBatchExecutableNetwork() {
     _terminate = true;
     for (auto w : _workerRequests) {
+        {
+            std::lock_guard<std::mutex> lock(w->_mutex);
+        }
+        w->_cond.notify_one();
         w->_thread.join();
     }
     _workerRequests.clear();
@@ -504,10 +562,13 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
         workerRequestPtr->_inferRequestBatched = {_network->CreateInferRequest(), _network._so};
         workerRequestPtr->_batchSize = _device.batchForDevice;
         workerRequestPtr->_completionTasks.resize(workerRequestPtr->_batchSize);
+        workerRequestPtr->_continuousBatching = _latencyBudget > 0;
         workerRequestPtr->_inferRequestBatched->SetCallback(
             [workerRequestPtr, this](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exceptionPtr = exceptionPtr;
+                if (workerRequestPtr->_continuousBatching)
+                    UpdateBatchLatency(workerRequestPtr->_startTime, true);
                 IE_ASSERT(workerRequestPtr->_completionTasks.size() == (size_t)workerRequestPtr->_batchSize);
                 // notify the individual requests on the completion
                 for (int c = 0; c < workerRequestPtr->_batchSize; c++) {
@@ -518,6 +579,10 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            if (workerRequestPtr->_continuousBatching) {
+                RunContinuousBatching(*workerRequestPtr);
+                return;
+            }
             while (1) {
                 std::cv_status status;
                 {
@@ -531,15 +596,11 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batchSize) {
-                        std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
+                        std::vector<TaskWithRequest> tasks(sz);
                         for (int n = 0; n < sz; n++) {
-                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            workerRequestPtr->_completionTasks[n] = std::move(t.second);
-                            t.first->_inferRequest->CopyInputsIfNeeded();
-                            t.first->_inferRequest->_wasBatchedRequestUsed =
-                                AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+                            IE_ASSERT(workerRequestPtr->_tasks.try_pop(tasks[n]));
                         }
-                        workerRequestPtr->_inferRequestBatched->StartAsync();
+                        StartBatch(*workerRequestPtr, tasks);
                     } else if ((status == std::cv_status::timeout) && sz) {
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task> t;
@@ -572,6 +633,148 @@ std::pair<AutoBatchExecutableNetwork::WorkerInferRequest&, int> AutoBatchExecuta
     return {*_workerRequests.back(), static_cast<int>(batch_id)};
 }
 
+void AutoBatchExecutableNetwork::StartBatch(WorkerInferRequest& workerRequest, std::vector<TaskWithRequest>& tasks) {
+    for (size_t n = 0; n < tasks.size(); n++) {
+        workerRequest._completionTasks[n] = std::move(tasks[n].second);
+        tasks[n].first->_inferRequest->CopyInputsIfNeeded();
+        tasks[n].first->_inferRequest->_wasBatchedRequestUsed = AutoBatchInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+    }
+    workerRequest._startTime = std::chrono::steady_clock::now();
+    workerRequest._inferRequestBatched->StartAsync();
+}
+
+void AutoBatchExecutableNetwork::RunContinuousBatching(WorkerInferRequest& workerRequest) {
+    // the requests collected so far, in the order of arrival (only this thread pops the tasks of the worker)
+    std::vector<TaskWithRequest> pending;
+    pending.reserve(workerRequest._batchSize);
+    auto hasNewTasks = [&] {
+        return _terminate || workerRequest._tasks.size() != 0;
+    };
+    while (!_terminate) {
+        {
+            std::unique_lock<std::mutex> lock(workerRequest._mutex);
+            if (pending.empty())
+                workerRequest._cond.wait(lock, hasNewTasks);
+            else
+                workerRequest._cond.wait_until(lock, GetFlushDeadline(pending.front()), hasNewTasks);
+        }
+        if (_terminate)
+            break;
+        TaskWithRequest t;
+        while (workerRequest._tasks.try_pop(t))
+            pending.push_back(std::move(t));
+        if (pending.empty())
+            continue;
+
+        if (static_cast<int>(pending.size()) == workerRequest._batchSize) {
+            StartBatch(workerRequest, pending);
+            pending.clear();
+        } else if (std::chrono::steady_clock::now() >= GetFlushDeadline(pending.front())) {
+            // waiting for the full batch would break the latency budget of the oldest request
+            StartPartialBatches(workerRequest, pending);
+            pending.clear();
+        }
+    }
+}
+
+void AutoBatchExecutableNetwork::StartPartialBatches(WorkerInferRequest& workerRequest,
+                                                     std::vector<TaskWithRequest>& tasks) {
+    size_t offset = 0;
+    // the largest variants first, so the partial batch is split into as few requests as possible
+    for (auto it = _partialBatchNetworks.rbegin(); it != _partialBatchNetworks.rend(); ++it) {
+        const int batchSize = it->first;
+        while (tasks.size() - offset >= static_cast<size_t>(batchSize)) {
+            auto partialRequest = GetPartialBatchRequest(workerRequest, batchSize);
+            for (int n = 0; n < batchSize; n++) {
+                auto& task = tasks[offset + n];
+                task.first->_inferRequest->CopyInputsIfNeeded(partialRequest->_inferRequest, n, batchSize);
+                task.first->_inferRequest->_wasBatchedRequestUsed =
+                    AutoBatchInferRequest::eExecutionFlavor::PARTIAL_BATCH_EXECUTED;
+                task.first->_inferRequest->_partialBatchRequest = partialRequest->_inferRequest;
+                partialRequest->_tasks.push_back(std::move(task));
+            }
+            offset += batchSize;
+            partialRequest->_startTime = std::chrono::steady_clock::now();
+            partialRequest->_inferRequest->StartAsync();
+        }
+    }
+    // the rest is executed with the batch1 requests
+    for (; offset < tasks.size(); offset++) {
+        auto t = std::move(tasks[offset]);
+        t.first->_inferRequestWithoutBatch->SetCallback([t](std::exception_ptr p) {
+            if (p)
+                t.first->_inferRequest->_exceptionPtr = p;
+            t.second();
+        });
+        t.first->_inferRequest->_wasBatchedRequestUsed = AutoBatchInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+        t.first->_inferRequest->SetBlobsToAnotherRequest(t.first->_inferRequestWithoutBatch);
+        t.first->_inferRequestWithoutBatch->StartAsync();
+    }
+}
+
+AutoBatchExecutableNetwork::PartialBatchRequest::Ptr AutoBatchExecutableNetwork::GetPartialBatchRequest(
+    WorkerInferRequest& workerRequest,
+    int batchSize) {
+    std::lock_guard<std::mutex> lock(workerRequest._partialBatchRequestsMutex);
+    for (auto& partialRequest : workerRequest._partialBatchRequests) {
+        if (!partialRequest->_busy && partialRequest->_batchSize == batchSize) {
+            partialRequest->_busy = true;
+            return partialRequest;
+        }
+    }
+    // several partial batches of the same size may be in flight, so the requests are created on demand
+    auto partialRequest = std::make_shared<PartialBatchRequest>();
+    const auto& network = _partialBatchNetworks.at(batchSize);
+    partialRequest->_inferRequest = {network->CreateInferRequest(), network._so};
+    partialRequest->_batchSize = batchSize;
+    partialRequest->_busy = true;
+    auto partialRequestPtr = partialRequest.get();
+    auto workerRequestPtr = &workerRequest;
+    partialRequest->_inferRequest->SetCallback(
+        [partialRequestPtr, workerRequestPtr, this](std::exception_ptr exceptionPtr) {
+            UpdateBatchLatency(partialRequestPtr->_startTime, false);
+            auto tasks = std::move(partialRequestPtr->_tasks);
+            partialRequestPtr->_tasks.clear();
+            for (size_t n = 0; n < tasks.size(); n++) {
+                auto& inferRequest = tasks[n].first->_inferRequest;
+                if (exceptionPtr)
+                    inferRequest->_exceptionPtr = exceptionPtr;
+                else
+                    inferRequest->CopyOutputsIfNeeded(partialRequestPtr->_inferRequest,
+                                                      n,
+                                                      partialRequestPtr->_batchSize);
+            }
+            // notify the individual requests on the completion
+            for (auto& task : tasks)
+                task.second();
+            std::lock_guard<std::mutex> lock(workerRequestPtr->_partialBatchRequestsMutex);
+            partialRequestPtr->_busy = false;
+        });
+    workerRequest._partialBatchRequests.push_back(partialRequest);
+    return partialRequest;
+}
+
+std::chrono::steady_clock::time_point AutoBatchExecutableNetwork::GetFlushDeadline(
+    const TaskWithRequest& oldest) const {
+    // the full batch has to be started early enough to complete within the budget of the oldest request
+    const auto budget = std::chrono::microseconds(static_cast<int64_t>(_latencyBudget) * 1000 - _batchLatency);
+    const auto timeout = std::chrono::microseconds(static_cast<int64_t>(_timeOut) * 1000);
+    return oldest.first->_inferRequest->_arrivalTime + std::min(budget, timeout);
+}
+
+void AutoBatchExecutableNetwork::UpdateBatchLatency(std::chrono::steady_clock::time_point startTime, bool fullBatch) {
+    const int64_t latency =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+    const int64_t estimate = _batchLatency;
+    if (fullBatch) {
+        // moving average, the first measurement is taken as is
+        _batchLatency = estimate ? (3 * estimate + latency) / 4 : latency;
+    } else if (latency > estimate) {
+        // the full batch is not expected to be faster than a partial one
+        _batchLatency = latency;
+    }
+}
+
 InferenceEngine::IInferRequestInternal::Ptr AutoBatchExecutableNetwork::CreateInferRequest() {
     if (!_network) {
         auto res = _networkWithoutBatch->CreateInferRequest();
@@ -715,9 +918,8 @@ DeviceInformation AutoBatchInferencePlugin::ParseMetaDevice(const std::string& d
     // check that no irrelevant config-keys left
     for (auto k : config) {
         const auto& name = k.first;
-        auto found_in_supported_cfg = std::find(supported_configKeys.begin(), supported_configKeys.end(), k.first);
         auto found_in_device_cfg = metaDevice.config.find(k.first);
-        if (found_in_device_cfg == metaDevice.config.end() && found_in_supported_cfg == supported_configKeys.end()) {
+        if (found_in_device_cfg == metaDevice.config.end() && !isSupportedConfigKey(k.first)) {
             IE_THROW() << "Unsupported config key: " << name;
         }
     }
@@ -741,7 +943,7 @@ RemoteContext::Ptr AutoBatchInferencePlugin::CreateContext(const InferenceEngine
 
 Parameter AutoBatchInferencePlugin::GetConfig(const std::string& name,
                                               const std::map<std::string, Parameter>& options) const {
-    if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name)) {
+    if (isSupportedConfigKey(name)) {
         auto it = _config.find(name);
         if (it == _config.end()) {
             IE_THROW() << "Value for " << name << " is not set";
@@ -757,18 +959,17 @@ void AutoBatchInferencePlugin::CheckConfig(const std::map<std::string, std::stri
     for (auto&& kvp : config) {
         const auto name = kvp.first;
         const auto val = kvp.second;
-        if (supported_configKeys.end() == std::find(supported_configKeys.begin(), supported_configKeys.end(), name))
+        if (!isSupportedConfigKey(name))
             IE_THROW() << "Unsupported config key: " << name;
         if (name == CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG)) {
             ParseBatchDevice(val);
-        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT)) {
+        } else if (name == CONFIG_KEY(AUTO_BATCH_TIMEOUT) || name == CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_BUDGET)) {
             try {
                 auto t = std::stoi(val);
                 if (t < 0)
                     IE_THROW(ParameterMismatch);
             } catch (const std::exception&) {
-                IE_THROW(ParameterMismatch)
-                    << " Expecting unsigned int value for " << CONFIG_KEY(AUTO_BATCH_TIMEOUT) << " got " << val;
+                IE_THROW(ParameterMismatch) << " Expecting unsigned int value for " << name << " got " << val;
             }
         }
     }
@@ -787,6 +988,7 @@ IE_DEFINE_PLUGIN_CREATE_FUNCTION(AutoBatchInferencePlugin, version)
 AutoBatchInferencePlugin::AutoBatchInferencePlugin() {
     _pluginName = "BATCH";
     _config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = "1000";  // default value, in ms
+    _config[CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_BUDGET)] = "0";  // continuous batching is disabled by default
 }
 
 InferenceEngine::Parameter AutoBatchInferencePlugin::GetMetric(
@@ -952,31 +1154,49 @@ InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadN
     // auto-batch settings
     std::unordered_map<std::string, InferenceEngine::Parameter> networkConfig;
     for (auto c : fullConfig) {
-        if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), c.first))
+        if (isSupportedConfigKey(c.first))
             networkConfig.insert(c);
     }
 
+    auto loadNetworkWithBatch = [&](int batch) {
+        CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
+        ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
+        for (const auto& input : batched_inputs)
+            shapes[input][0] = batch;
+        reshaped.reshape(shapes);
+        return ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
+                   : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+    };
+
     InferenceEngine::SoExecutableNetworkInternal executableNetworkWithBatch;
     if (metaDevice.batchForDevice > 1 && batched_inputs.size()) {
         try {
-            CNNNetwork reshaped(InferenceEngine::details::cloneNetwork(network));
-            ICNNNetwork::InputShapes shapes = reshaped.getInputShapes();
-            for (const auto& input : batched_inputs)
-                shapes[input][0] = metaDevice.batchForDevice;
-            reshaped.reshape(shapes);
-            executableNetworkWithBatch = ctx ? core->LoadNetwork(reshaped, ctx, deviceConfigNoAutoBatch)
-                                             : core->LoadNetwork(reshaped, deviceName, deviceConfigNoAutoBatch);
+            executableNetworkWithBatch = loadNetworkWithBatch(metaDevice.batchForDevice);
         } catch (...) {
             metaDevice.batchForDevice = 1;
         }
     }
 
+    // with the continuous batching the partial batches are executed with the smaller batch variants of the network
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> partialBatchNetworks;
+    const auto& latencyBudget = fullConfig.find(CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_BUDGET));
+    if (executableNetworkWithBatch && latencyBudget != fullConfig.end() && std::stoi(latencyBudget->second) > 0) {
+        for (int batch = metaDevice.batchForDevice / 2; batch > 1; batch /= 2) {
+            try {
+                partialBatchNetworks[batch] = loadNetworkWithBatch(batch);
+            } catch (...) {
+                // the partial batches that can not be covered by the variants fall back to the batch1 requests
+            }
+        }
+    }
+
     return std::make_shared<AutoBatchExecutableNetwork>(executableNetworkWithBatch,
                                                         executableNetworkWithoutBatch,
                                                         metaDevice,
                                                         networkConfig,
                                                         batched_inputs,
-                                                        batched_outputs);
+                                                        batched_outputs,
+                                                        partialBatchNetworks);
 }
 
 InferenceEngine::IExecutableNetworkInternal::Ptr AutoBatchInferencePlugin::LoadExeNetworkImpl(
@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <map>
 #include <mutex>
 #include <string>
@@ -33,16 +34,30 @@ class AutoBatchAsyncInferRequest;
 class AutoBatchExecutableNetwork : public InferenceEngine::ExecutableNetworkThreadSafeDefault {
 public:
     using Ptr = std::shared_ptr<AutoBatchExecutableNetwork>;
+    using TaskWithRequest = std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>;
+    // request of the smaller batch variant of the network that executes a partial batch (continuous batching)
+    struct PartialBatchRequest {
+        using Ptr = std::shared_ptr<PartialBatchRequest>;
+        InferenceEngine::SoIInferRequestInternal _inferRequest;
+        int _batchSize;
+        bool _busy = false;
+        std::vector<TaskWithRequest> _tasks;
+        std::chrono::steady_clock::time_point _startTime;
+    };
     struct WorkerInferRequest {
         using Ptr = std::shared_ptr<WorkerInferRequest>;
         InferenceEngine::SoIInferRequestInternal _inferRequestBatched;
         int _batchSize;
-        InferenceEngine::ThreadSafeQueueWithSize<std::pair<AutoBatchAsyncInferRequest*, InferenceEngine::Task>> _tasks;
+        InferenceEngine::ThreadSafeQueueWithSize<TaskWithRequest> _tasks;
         std::vector<InferenceEngine::Task> _completionTasks;
         std::thread _thread;
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exceptionPtr;
+        bool _continuousBatching = false;
+        std::chrono::steady_clock::time_point _startTime;
+        std::vector<PartialBatchRequest::Ptr> _partialBatchRequests;
+        std::mutex _partialBatchRequestsMutex;
     };
 
     explicit AutoBatchExecutableNetwork(
@@ -51,7 +66,8 @@ public:
         const DeviceInformation& networkDevices,
         const std::unordered_map<std::string, InferenceEngine::Parameter>& config,
         const std::set<std::string>& batchedIntputs,
-        const std::set<std::string>& batchedOutputs);
+        const std::set<std::string>& batchedOutputs,
+        const std::map<int, InferenceEngine::SoExecutableNetworkInternal>& partialBatchNetworks = {});
 
     void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
     InferenceEngine::Parameter GetConfig(const std::string& name) const override;
@@ -75,6 +91,13 @@ protected:
     InferenceEngine::SoExecutableNetworkInternal _networkWithoutBatch;
 
     std::pair<WorkerInferRequest&, int> GetWorkerInferRequest();
+    void StartBatch(WorkerInferRequest& workerRequest, std::vector<TaskWithRequest>& tasks);
+    // continuous batching
+    void RunContinuousBatching(WorkerInferRequest& workerRequest);
+    void StartPartialBatches(WorkerInferRequest& workerRequest, std::vector<TaskWithRequest>& tasks);
+    PartialBatchRequest::Ptr GetPartialBatchRequest(WorkerInferRequest& workerRequest, int batchSize);
+    std::chrono::steady_clock::time_point GetFlushDeadline(const TaskWithRequest& oldest) const;
+    void UpdateBatchLatency(std::chrono::steady_clock::time_point startTime, bool fullBatch);
     std::vector<WorkerInferRequest::Ptr> _workerRequests;
     std::mutex _workerRequestsMutex;
 
@@ -82,6 +105,11 @@ protected:
     bool _needPerfCounters = false;
     std::atomic_size_t _numRequestsCreated = {0};
     std::atomic_int _timeOut = {0};  // in ms
+    int _latencyBudget = 0;          // in ms, enables the continuous batching
+    // running estimate of the full batch execution time (in us), updated without synchronization as it is a hint
+    std::atomic<int64_t> _batchLatency = {0};
+    // the smaller batch variants of the network (by the batch size) to execute the partial batches
+    std::map<int, InferenceEngine::SoExecutableNetworkInternal> _partialBatchNetworks;
 
     const std::set<std::string> _batchedInputs;
     const std::set<std::string> _batchedOutputs;
@@ -109,16 +137,27 @@ public:
     void SetBlobsToAnotherRequest(InferenceEngine::SoIInferRequestInternal& req);
     void CopyInputsIfNeeded();
     void CopyOutputsIfNeeded();
+    // copies the data to/from the slot batchId of the request with the batchSize (e.g. the partial batch request)
+    void CopyInputsIfNeeded(InferenceEngine::SoIInferRequestInternal& req, size_t batchId, size_t batchSize);
+    void CopyOutputsIfNeeded(InferenceEngine::SoIInferRequestInternal& req, size_t batchId, size_t batchSize);
     AutoBatchExecutableNetwork::WorkerInferRequest& _myBatchedRequestWrapper;
     std::exception_ptr _exceptionPtr;
     enum eExecutionFlavor : uint8_t {
         NOT_EXECUTED,
         BATCH_EXECUTED,
-        TIMEOUT_EXECUTED
+        TIMEOUT_EXECUTED,
+        PARTIAL_BATCH_EXECUTED
     } _wasBatchedRequestUsed = eExecutionFlavor::NOT_EXECUTED;
+    std::chrono::steady_clock::time_point _arrivalTime;
+    // the request of the partial batch which executed this one last time, for the performance counters
+    InferenceEngine::SoIInferRequestInternal _partialBatchRequest;
 
 protected:
-    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src, InferenceEngine::Blob::Ptr dst, bool bInput);
+    void CopyBlobIfNeeded(InferenceEngine::Blob::CPtr src,
+                          InferenceEngine::Blob::Ptr dst,
+                          bool bInput,
+                          size_t batchId,
+                          size_t batchSize);
     void ShareBlobsWithBatchRequest(const std::set<std::string>& batchedIntputs,
                                     const std::set<std::string>& batchedOutputs);
     size_t _batchId;
@@ -16,6 +16,10 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     : AsyncInferRequestThreadSafeDefault(request, taskExecutor, callbackExecutor),
       _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
     _pipeline.clear();
+    if (_heteroInferRequest->_slots) {
+        CreateSlotsPipeline();
+        return;
+    }
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
             explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
@@ -44,6 +48,73 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
     }
 }
 
+void HeteroAsyncInferRequest::CreateSlotsPipeline() {
+    auto heteroInferRequest = _heteroInferRequest;
+    // waits for a free slot and binds the request blobs to it
+    struct SlotExecutor : ITaskExecutor {
+        explicit SlotExecutor(HeteroInferRequest::Ptr inferRequest) : _inferRequest(std::move(inferRequest)) {}
+        void run(Task task) override {
+            auto inferRequest = _inferRequest;
+            _inferRequest->_slots->Acquire([inferRequest, task](const HeteroInferRequest::Ptr& slot) {
+                inferRequest->_slot = slot;
+                task();
+            });
+        }
+        HeteroInferRequest::Ptr _inferRequest;
+    };
+    _pipeline.emplace_back(std::make_shared<SlotExecutor>(heteroInferRequest), [heteroInferRequest] {
+        try {
+            heteroInferRequest->BindSlot(heteroInferRequest->_slot);
+        } catch (...) {
+            heteroInferRequest->ReleaseSlot(false);
+            throw;
+        }
+    });
+
+    // runs the subgraph by the infer request of the acquired slot
+    struct SlotRequestExecutor : ITaskExecutor {
+        SlotRequestExecutor(HeteroInferRequest::Ptr inferRequest, std::size_t requestId)
+            : _inferRequest(std::move(inferRequest)),
+              _requestId(requestId) {}
+        void run(Task task) override {
+            _task = std::move(task);
+            _exceptionPtr = nullptr;
+            try {
+                auto& request = _inferRequest->_slot->_inferRequests[_requestId]._request;
+                request->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
+                    _exceptionPtr = exceptionPtr;
+                    auto capturedTask = std::move(_task);
+                    capturedTask();
+                });
+                request->StartAsync();
+            } catch (...) {
+                _exceptionPtr = std::current_exception();
+                auto capturedTask = std::move(_task);
+                capturedTask();
+            }
+        };
+        HeteroInferRequest::Ptr _inferRequest;
+        std::size_t _requestId;
+        std::exception_ptr _exceptionPtr;
+        Task _task;
+    };
+    const auto requestsCount = heteroInferRequest->_slots->GetSubRequestsCount();
+    for (std::size_t requestId = 0; requestId < requestsCount; ++requestId) {
+        auto requestExecutor = std::make_shared<SlotRequestExecutor>(heteroInferRequest, requestId);
+        const bool lastRequest = requestId + 1 == requestsCount;
+        _pipeline.emplace_back(requestExecutor, [requestExecutor, lastRequest] {
+            // the slot is released as soon as it isn't needed, so the next request starts its first subgraph
+            if (nullptr != requestExecutor->_exceptionPtr) {
+                requestExecutor->_inferRequest->ReleaseSlot(false);
+                std::rethrow_exception(requestExecutor->_exceptionPtr);
+            }
+            if (lastRequest) {
+                requestExecutor->_inferRequest->ReleaseSlot(true);
+            }
+        });
+    }
+}
+
 StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     auto waitStatus = StatusCode::OK;
     try {
@@ -23,6 +23,8 @@ public:
     InferenceEngine::Blob::Ptr GetBlob(const std::string& name) override;
 
 private:
+    void CreateSlotsPipeline();
+
     HeteroInferRequest::Ptr _heteroInferRequest;
 };
 
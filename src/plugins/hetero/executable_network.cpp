@@ -805,19 +805,30 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     const std::vector<std::shared_ptr<const ov::Node>>& outputs) {
     if (!this->_plugin || !_plugin->IsNewAPI())
         return nullptr;
-    HeteroInferRequest::SubRequestsList inferRequests;
-    int index = 0;
-    for (auto&& subnetwork : _networks) {
-        HeteroInferRequest::SubRequestDesc desc;
-        desc._network = subnetwork._network;
-        desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
-        inferRequests.push_back(desc);
+    if (Engine::GetPipelineDepth(_config) > 0) {
+        auto slots = GetInferRequestSlots([&] {
+            return std::make_shared<HeteroInferRequest>(inputs, outputs, CreateSubRequestsList(), _blobNameMap);
+        });
+        return std::make_shared<HeteroInferRequest>(inputs, outputs, slots, IsPerfCountEnabled());
     }
-    return std::make_shared<HeteroInferRequest>(inputs, outputs, inferRequests, _blobNameMap);
+    return std::make_shared<HeteroInferRequest>(inputs, outputs, CreateSubRequestsList(), _blobNameMap);
 }
 
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(InputsDataMap networkInputs,
                                                                            OutputsDataMap networkOutputs) {
+    if (Engine::GetPipelineDepth(_config) > 0) {
+        auto slots = GetInferRequestSlots([&] {
+            return std::make_shared<HeteroInferRequest>(networkInputs,
+                                                        networkOutputs,
+                                                        CreateSubRequestsList(),
+                                                        _blobNameMap);
+        });
+        return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, slots, IsPerfCountEnabled());
+    }
+    return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, CreateSubRequestsList(), _blobNameMap);
+}
+
+HeteroInferRequest::SubRequestsList HeteroExecutableNetwork::CreateSubRequestsList() const {
     HeteroInferRequest::SubRequestsList inferRequests;
     int index = 0;
     for (auto&& subnetwork : _networks) {
@@ -826,7 +837,37 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(Input
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
         inferRequests.push_back(desc);
     }
-    return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, inferRequests, _blobNameMap);
+    return inferRequests;
+}
+
+bool HeteroExecutableNetwork::IsPerfCountEnabled() const {
+    auto it = _config.find(CONFIG_KEY(PERF_COUNT));
+    return it != _config.end() && it->second == CONFIG_VALUE(YES);
+}
+
+HeteroInferRequestSlots::Ptr HeteroExecutableNetwork::GetInferRequestSlots(
+    const std::function<HeteroInferRequest::Ptr()>& createSlot) {
+    std::lock_guard<std::mutex> lock{_slotsMutex};
+    if (!_slots) {
+        // the request blobs are bound to the slots as is, so they can't be reshaped
+        auto isDynamic = [](const ov::PartialShape& shape) {
+            return shape.is_dynamic();
+        };
+        for (auto&& parameter : _parameters) {
+            if (isDynamic(parameter->get_output_partial_shape(0)))
+                IE_THROW() << "The pipelined execution supports only static shapes";
+        }
+        for (auto&& result : _results) {
+            if (isDynamic(result->get_input_partial_shape(0)))
+                IE_THROW() << "The pipelined execution supports only static shapes";
+        }
+        std::vector<HeteroInferRequest::Ptr> slots;
+        for (unsigned int i = 0; i < Engine::GetPipelineDepth(_config); ++i) {
+            slots.push_back(createSlot());
+        }
+        _slots = std::make_shared<HeteroInferRequestSlots>(std::move(slots));
+    }
+    return _slots;
 }
 
 IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequest() {
@@ -845,6 +886,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string&
         } else {
             result = std::string{};
         }
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_DEPTH)) {
+        result = Engine::GetPipelineDepth(_config);
     } else if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) || name == CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)) {
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
@@ -930,6 +973,7 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
         std::vector<std::string> heteroConfigKeys = {"TARGET_FALLBACK",
                                                      ov::device::priorities.name(),
                                                      HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                     HETERO_CONFIG_KEY(PIPELINE_DEPTH),
                                                      CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
 
         {
@@ -956,6 +1000,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
             value = std::max(value,
                              desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
         }
+        // each slot of the pipeline needs a request in flight to keep the devices busy
+        value = std::max(value, Engine::GetPipelineDepth(_config));
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (name == ov::execution_devices) {
         std::vector<std::string> exeDevices;
@@ -11,8 +11,10 @@
 #include <ie_common.h>
 
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
@@ -65,6 +67,9 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork& network);
     void InitNgraph(const InferenceEngine::CNNNetwork& network);
+    HeteroInferRequest::SubRequestsList CreateSubRequestsList() const;
+    bool IsPerfCountEnabled() const;
+    HeteroInferRequestSlots::Ptr GetInferRequestSlots(const std::function<HeteroInferRequest::Ptr()>& createSlot);
 
     struct NetworkDesc {
         std::string _device;
@@ -77,6 +82,8 @@ private:
     std::string _name;
     std::map<std::string, std::string> _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    std::mutex _slotsMutex;
+    HeteroInferRequestSlots::Ptr _slots;
 };
 
 }  // namespace HeteroPlugin
@@ -7,9 +7,11 @@
 #include <ie_blob.h>
 #include <ie_layouts.h>
 
+#include <blob_factory.hpp>
 #include <cassert>
 #include <description_buffer.hpp>
 #include <ie_algorithm.hpp>
+#include <future>
 #include <map>
 #include <string>
 
@@ -39,6 +41,41 @@ HeteroInferRequest::HeteroInferRequest(
     CreateInferRequest(subgraphInputToOutputBlobNames);
 }
 
+HeteroInferRequest::HeteroInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& inputs,
+                                       const std::vector<std::shared_ptr<const ov::Node>>& outputs,
+                                       const HeteroInferRequestSlots::Ptr& slots,
+                                       bool perfCount)
+    : IInferRequestInternal(inputs, outputs),
+      _slots(slots),
+      _perfCount(perfCount) {
+    AllocateBlobs();
+}
+
+HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                                       InferenceEngine::OutputsDataMap networkOutputs,
+                                       const HeteroInferRequestSlots::Ptr& slots,
+                                       bool perfCount)
+    : IInferRequestInternal(networkInputs, networkOutputs),
+      _slots(slots),
+      _perfCount(perfCount) {
+    AllocateBlobs();
+}
+
+void HeteroInferRequest::AllocateBlobs() {
+    // the blobs are bound to the slot requests as is, so they get the layouts of the subgraph requests
+    auto allocate = [&](const std::string& name) {
+        auto blob = make_blob_with_precision(_slots->Front()->GetBlob(name)->getTensorDesc());
+        blob->allocate();
+        return blob;
+    };
+    for (auto&& input : _networkInputs) {
+        _inputs[input.first] = allocate(input.first);
+    }
+    for (auto&& output : _networkOutputs) {
+        _outputs[output.first] = allocate(output.first);
+    }
+}
+
 void HeteroInferRequest::CreateInferRequest(
     const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames) {
     if (_networkOutputs.empty() || _networkInputs.empty()) {
@@ -86,6 +123,10 @@ void HeteroInferRequest::CreateInferRequest(
 }
 
 void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob) {
+    if (_slots) {
+        IInferRequestInternal::SetBlob(name, blob);
+        return;
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -94,6 +135,9 @@ void HeteroInferRequest::SetBlob(const std::string& name, const InferenceEngine:
 }
 
 InferenceEngine::Blob::Ptr HeteroInferRequest::GetBlob(const std::string& name) {
+    if (_slots) {
+        return IInferRequestInternal::GetBlob(name);
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -103,6 +147,9 @@ InferenceEngine::Blob::Ptr HeteroInferRequest::GetBlob(const std::string& name)
 }
 
 void HeteroInferRequest::SetBlob(const std::string& name, const Blob::Ptr& blob, const PreProcessInfo& info) {
+    if (_slots) {
+        IE_THROW(NotImplemented) << "The pre-processing is not supported by the pipelined execution";
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -111,6 +158,9 @@ void HeteroInferRequest::SetBlob(const std::string& name, const Blob::Ptr& blob,
 }
 
 const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const std::string& name) const {
+    if (_slots) {
+        return IInferRequestInternal::GetPreProcess(name);
+    }
     auto itRequest = _subRequestFromBlobName.find(name);
     if (itRequest == _subRequestFromBlobName.end()) {
         IE_THROW() << "There is no infer requests binded to blob with name: " << name;
@@ -119,6 +169,22 @@ const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const s
 }
 
 void HeteroInferRequest::InferImpl() {
+    if (_slots) {
+        std::promise<Ptr> acquired;
+        _slots->Acquire([&acquired](const Ptr& slot) {
+            acquired.set_value(slot);
+        });
+        auto slot = acquired.get_future().get();
+        try {
+            BindSlot(slot);
+            slot->InferImpl();
+        } catch (...) {
+            ReleaseSlot(false);
+            throw;
+        }
+        ReleaseSlot(true);
+        return;
+    }
     for (auto&& desc : _inferRequests) {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
         auto& r = desc._request;
@@ -127,7 +193,30 @@ void HeteroInferRequest::InferImpl() {
     }
 }
 
+void HeteroInferRequest::BindSlot(const Ptr& slot) {
+    _slot = slot;
+    for (auto&& input : _inputs) {
+        slot->SetBlob(input.first, input.second);
+    }
+    for (auto&& output : _outputs) {
+        slot->SetBlob(output.first, output.second);
+    }
+}
+
+void HeteroInferRequest::ReleaseSlot(bool executed) {
+    auto slot = std::move(_slot);
+    if (slot) {
+        if (executed && _perfCount) {
+            _perfCounters = slot->GetPerformanceCounts();
+        }
+        _slots->Release(slot);
+    }
+}
+
 std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> HeteroInferRequest::QueryState() {
+    if (_slots) {
+        IE_THROW(NotImplemented) << "The states are not supported by the pipelined execution";
+    }
     memoryStates = {};
     for (auto&& desc : _inferRequests) {
         auto& r = desc._request;
@@ -140,6 +229,10 @@ std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> HeteroInfe
 }
 
 std::map<std::string, InferenceEngineProfileInfo> HeteroInferRequest::GetPerformanceCounts() const {
+    if (_slots) {
+        // the counters of the slot which executed the last inference, copied before the slot was released
+        return _perfCounters;
+    }
     std::map<std::string, InferenceEngineProfileInfo> perfMap;
     for (size_t i = 0; i < _inferRequests.size(); i++) {
         auto perfMapRequest = _inferRequests[i]._request->GetPerformanceCounts();
@@ -149,3 +242,35 @@ std::map<std::string, InferenceEngineProfileInfo> HeteroInferRequest::GetPerform
     }
     return perfMap;
 }
+
+HeteroInferRequestSlots::HeteroInferRequestSlots(std::vector<HeteroInferRequest::Ptr> slots)
+    : _slots(std::move(slots)),
+      _free(_slots.begin(), _slots.end()) {}
+
+void HeteroInferRequestSlots::Acquire(Acquired acquired) {
+    HeteroInferRequest::Ptr slot;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_free.empty()) {
+            _waiting.push_back(std::move(acquired));
+            return;
+        }
+        slot = std::move(_free.front());
+        _free.pop_front();
+    }
+    acquired(slot);
+}
+
+void HeteroInferRequestSlots::Release(const HeteroInferRequest::Ptr& slot) {
+    Acquired acquired;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_waiting.empty()) {
+            _free.push_back(slot);
+            return;
+        }
+        acquired = std::move(_waiting.front());
+        _waiting.pop_front();
+    }
+    acquired(slot);
+}
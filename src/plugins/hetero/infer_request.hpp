@@ -8,8 +8,11 @@
 
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <openvino/itt.hpp>
 #include <string>
 #include <unordered_map>
@@ -17,6 +20,8 @@
 
 namespace HeteroPlugin {
 
+class HeteroInferRequestSlots;
+
 class HeteroInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
@@ -38,6 +43,21 @@ public:
                        const SubRequestsList& inferRequests,
                        const std::unordered_map<std::string, std::string>& blobNameMap);
 
+    /**
+     * @brief Creates the infer request of the pipelined execution, it owns only the network input and output blobs
+     * and runs the subgraphs by the infer requests of a slot. The performance counters are copied from the slot
+     * before it's released if perfCount is set, since the slot may already run another request when they are read
+     */
+    HeteroInferRequest(const std::vector<std::shared_ptr<const ov::Node>>& networkInputs,
+                       const std::vector<std::shared_ptr<const ov::Node>>& networkOutputs,
+                       const std::shared_ptr<HeteroInferRequestSlots>& slots,
+                       bool perfCount);
+
+    HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
+                       InferenceEngine::OutputsDataMap networkOutputs,
+                       const std::shared_ptr<HeteroInferRequestSlots>& slots,
+                       bool perfCount);
+
     void InferImpl() override;
 
     void SetBlob(const std::string& name, const InferenceEngine::Blob::Ptr& blob) override;
@@ -54,13 +74,65 @@ public:
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GetPerformanceCounts() const override;
 
+    /**
+     * @brief Binds the network input and output blobs of the pipelined request to the slot infer requests
+     */
+    void BindSlot(const Ptr& slot);
+
+    /**
+     * @brief Returns the slot to the pipeline after the last subgraph of the request is executed or has failed
+     * @param executed Whether all the subgraphs of the request are executed, so the slot has its performance counters
+     */
+    void ReleaseSlot(bool executed);
+
     SubRequestsList _inferRequests;
     std::map<std::string, InferenceEngine::Blob::Ptr> _blobs;
     std::map<std::string, InferenceEngine::SoIInferRequestInternal> _subRequestFromBlobName;
+    std::shared_ptr<HeteroInferRequestSlots> _slots;
+    Ptr _slot;
 
 private:
     void CreateInferRequest(const std::unordered_map<std::string, std::string>& subgraphInputToOutputBlobNames);
+    void AllocateBlobs();
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
+    bool _perfCount = false;
+    std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> _perfCounters;
+};
+
+/**
+ * @brief Ring of the subgraph infer requests sets of the pipelined execution.
+ *
+ * Each slot is a HeteroInferRequest with own subgraph infer requests and intermediate blobs bound once on creation,
+ * so the requests in flight never wait for each other's intermediate data and nothing is copied between the subgraphs
+ * except what the devices do themselves. The requests which find no free slot are queued in the start order.
+ */
+class HeteroInferRequestSlots {
+public:
+    using Ptr = std::shared_ptr<HeteroInferRequestSlots>;
+    using Acquired = std::function<void(const HeteroInferRequest::Ptr&)>;
+
+    explicit HeteroInferRequestSlots(std::vector<HeteroInferRequest::Ptr> slots);
+
+    /**
+     * @brief Calls `acquired` with a free slot right away or from the thread which releases the next slot
+     */
+    void Acquire(Acquired acquired);
+
+    void Release(const HeteroInferRequest::Ptr& slot);
+
+    const HeteroInferRequest::Ptr& Front() const {
+        return _slots.front();
+    }
+
+    size_t GetSubRequestsCount() const {
+        return Front()->_inferRequests.size();
+    }
+
+private:
+    std::vector<HeteroInferRequest::Ptr> _slots;
+    std::mutex _mutex;
+    std::deque<HeteroInferRequest::Ptr> _free;
+    std::deque<Acquired> _waiting;
 };
 
 }  // namespace HeteroPlugin
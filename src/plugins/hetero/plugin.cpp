@@ -27,6 +27,7 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINE_DEPTH)] = "0";
 }
 
 namespace {
@@ -40,6 +41,7 @@ Engine::Configs mergeConfigs(Engine::Configs config, const Engine::Configs& loca
 
 const std::vector<std::string>& getSupportedConfigKeys() {
     static const std::vector<std::string> supported_configKeys = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                                  HETERO_CONFIG_KEY(PIPELINE_DEPTH),
                                                                   "TARGET_FALLBACK",
                                                                   ov::device::priorities.name(),
                                                                   CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)};
@@ -84,6 +86,10 @@ Engine::DeviceMetaInformationMap Engine::GetDevicePlugins(const std::string& tar
         DeviceIDParser deviceParser(deviceWithID);
         std::string deviceName = deviceParser.getDeviceName();
         Configs tconfig = mergeConfigs(_config, localConfig);
+        // the subgraphs of the pipeline are executed concurrently, so a device can't mux them into a single queue
+        if (GetPipelineDepth(tconfig) > 0) {
+            tconfig[KEY_EXCLUSIVE_ASYNC_REQUESTS] = NO;
+        }
 
         // set device ID if any
         std::string deviceIDLocal = deviceParser.getDeviceID();
@@ -105,14 +111,32 @@ Engine::DeviceMetaInformationMap Engine::GetDevicePlugins(const std::string& tar
     return metaDevices;
 }
 
+unsigned int Engine::GetPipelineDepth(const Configs& config) {
+    auto it = config.find(HETERO_CONFIG_KEY(PIPELINE_DEPTH));
+    if (it == config.end()) {
+        return 0;
+    }
+    int depth = -1;
+    try {
+        depth = std::stoi(it->second);
+    } catch (const std::exception&) {
+    }
+    if (depth < 0) {
+        IE_THROW() << "Wrong value for property key " << HETERO_CONFIG_KEY(PIPELINE_DEPTH) << ": " << it->second
+                   << ". Expected non-negative integer";
+    }
+    return static_cast<unsigned int>(depth);
+}
+
 void Engine::SetConfig(const Configs& configs) {
     for (auto&& kvp : configs) {
         const auto& name = kvp.first;
         const auto& supported_configKeys = getSupportedConfigKeys();
-        if (supported_configKeys.end() != std::find(supported_configKeys.begin(), supported_configKeys.end(), name))
-            _config[name] = kvp.second;
-        else
+        if (supported_configKeys.end() == std::find(supported_configKeys.begin(), supported_configKeys.end(), name))
             IE_THROW() << "Unsupported config key: " << name;
+        if (name == HETERO_CONFIG_KEY(PIPELINE_DEPTH))
+            GetPipelineDepth({kvp});
+        _config[name] = kvp.second;
     }
 }
 
@@ -219,6 +243,8 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return {dump};
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_DEPTH)) {
+        return {GetPipelineDepth(_config)};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities.name()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
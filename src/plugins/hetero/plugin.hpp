@@ -46,6 +46,8 @@ public:
 
     DeviceMetaInformationMap GetDevicePlugins(const std::string& targetFallback, const Configs& localConfig) const;
 
+    static unsigned int GetPipelineDepth(const Configs& config);
+
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string& deviceName) const;
     std::string DeviceArchitecture(const std::string& targetFallback) const;
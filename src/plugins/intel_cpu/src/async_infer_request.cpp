@@ -5,13 +5,115 @@
 #include "async_infer_request.h"
 #include <memory>
 
+namespace {
+
+// Passes the tasks to the infer request, so it decides how they are scheduled
+class RequestTaskExecutor : public InferenceEngine::ITaskExecutor {
+public:
+    explicit RequestTaskExecutor(std::function<void(InferenceEngine::Task)> schedule)
+        : _schedule(std::move(schedule)) {}
+
+    void run(InferenceEngine::Task task) override {
+        _schedule(std::move(task));
+    }
+
+private:
+    std::function<void(InferenceEngine::Task)> _schedule;
+};
+
+}   // namespace
+
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                     const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
                                                     const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
-    static_cast<InferRequestBase*>(inferRequest.get())->SetAsyncRequest(this);
+    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+      _streamsExecutor(std::dynamic_pointer_cast<InferenceEngine::CPUStreamsExecutor>(taskExecutor)) {
+    auto request = static_cast<InferRequestBase*>(inferRequest.get());
+    request->SetAsyncRequest(this);
+
+    if (_streamsExecutor)
+        _numaNodeId = request->getNumaNodeId();
+    _pipeline = {{std::make_shared<RequestTaskExecutor>([this](InferenceEngine::Task task) {
+                      Schedule(std::move(task));
+                  }),
+                  [this, request] {
+                      Start(request);
+                  }}};
 }
 
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
     StopAndWait();
 }
+
+void ov::intel_cpu::AsyncInferRequest::Schedule(InferenceEngine::Task task) {
+    _scheduleTime = std::chrono::steady_clock::now();
+    if (!_streamsExecutor) {
+        _requestExecutor->run(std::move(task));
+        return;
+    }
+
+    // the requests without the hints keep the executor FIFO order
+    if (_priority == ov::hint::Priority::MEDIUM && _deadline.count() == 0) {
+        if (_numaNodeId >= 0) {
+            _streamsExecutor->RunOnNumaNode(std::move(task), _numaNodeId);
+        } else {
+            _streamsExecutor->run(std::move(task));
+        }
+        return;
+    }
+
+    const int priority = _priority == ov::hint::Priority::HIGH ? 1 : _priority == ov::hint::Priority::LOW ? -1 : 0;
+    const auto deadline = _deadline.count() != 0 ? _scheduleTime + _deadline
+                                                 : std::chrono::steady_clock::time_point::max();
+    _streamsExecutor->RunWithPriority(std::move(task), priority, deadline, _numaNodeId);
+}
+
+void ov::intel_cpu::AsyncInferRequest::Start(InferRequestBase* request) {
+    const auto now = std::chrono::steady_clock::now();
+    const auto waitTime = now - _scheduleTime;
+    _queueWaitTime = std::chrono::duration_cast<std::chrono::microseconds>(waitTime).count();
+    // the request which missed its deadline is not executed at all, so it doesn't delay the others
+    if (_deadline.count() != 0 && waitTime > _deadline)
+        IE_THROW(InferCancelled) << "The infer request missed its deadline of " << _deadline.count()
+                                 << " ms, it waited for the execution for "
+                                 << std::chrono::duration_cast<std::chrono::milliseconds>(waitTime).count() << " ms";
+    request->InferImpl();
+}
+
+void ov::intel_cpu::AsyncInferRequest::SetProperties(const ov::AnyMap& properties) {
+    CheckState();
+    for (const auto& property : properties) {
+        if (property.first == ov::hint::request_priority) {
+            _priority = property.second.as<ov::hint::Priority>();
+        } else if (property.first == ov::hint::request_deadline) {
+            _deadline = std::chrono::milliseconds(property.second.as<uint32_t>());
+        } else {
+            IE_THROW(NotFound) << "Unsupported infer request property: " << property.first;
+        }
+    }
+}
+
+ov::Any ov::intel_cpu::AsyncInferRequest::GetProperty(const std::string& name) const {
+    auto RO_property = [](const std::string& propertyName) {
+        return ov::PropertyName(propertyName, ov::PropertyMutability::RO);
+    };
+    auto RW_property = [](const std::string& propertyName) {
+        return ov::PropertyName(propertyName, ov::PropertyMutability::RW);
+    };
+
+    if (name == ov::supported_properties) {
+        return std::vector<ov::PropertyName>{
+            RO_property(ov::supported_properties.name()),
+            RW_property(ov::hint::request_priority.name()),
+            RW_property(ov::hint::request_deadline.name()),
+            RO_property(ov::request_queue_wait_time.name()),
+        };
+    } else if (name == ov::hint::request_priority) {
+        return _priority;
+    } else if (name == ov::hint::request_deadline) {
+        return decltype(ov::hint::request_deadline)::value_type(_deadline.count());
+    } else if (name == ov::request_queue_wait_time) {
+        return decltype(ov::request_queue_wait_time)::value_type(_queueWaitTime.load());
+    }
+    IE_THROW(NotFound) << "Unsupported infer request property: " << name;
+}
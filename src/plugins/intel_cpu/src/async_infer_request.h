@@ -4,9 +4,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <string>
 #include <map>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
+#include <threading/ie_cpu_streams_executor.hpp>
 #include "infer_request.h"
 
 namespace ov {
@@ -18,8 +21,23 @@ public:
                       const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
                       const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
     ~AsyncInferRequest();
+
+    void SetProperties(const ov::AnyMap& properties) override;
+
+    ov::Any GetProperty(const std::string& name) const override;
+
+private:
+    void Schedule(InferenceEngine::Task task);
+    void Start(InferRequestBase* request);
+
+    InferenceEngine::CPUStreamsExecutor::Ptr _streamsExecutor;
+    int _numaNodeId = -1;
+    ov::hint::Priority _priority = ov::hint::Priority::MEDIUM;
+    std::chrono::milliseconds _deadline{0};
+    // the time of the last start, the pipeline task reads it after the request was scheduled
+    std::chrono::steady_clock::time_point _scheduleTime;
+    std::atomic<uint64_t> _queueWaitTime{0};
 };
 
 }   // namespace intel_cpu
 }   // namespace ov
-
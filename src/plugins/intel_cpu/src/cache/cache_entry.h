@@ -6,11 +6,25 @@
 
 #include <memory>
 #include <functional>
+#include <atomic>
 #include "lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
 
+struct CacheStatistics {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+
+    CacheStatistics& operator+=(const CacheStatistics& rhs) {
+        hits += rhs.hits;
+        misses += rhs.misses;
+        evictions += rhs.evictions;
+        return *this;
+    }
+};
+
 class CacheEntryBase {
 public:
     enum class LookUpStatus : int8_t {
@@ -19,14 +33,38 @@ public:
     };
 public:
     virtual ~CacheEntryBase() = default;
+
+    CacheStatistics getStatistics() const {
+        CacheStatistics stats;
+        stats.hits = _hits.load(std::memory_order_relaxed);
+        stats.misses = _misses.load(std::memory_order_relaxed);
+        stats.evictions = _evictions.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+protected:
+    // the counters are only read for the statistics, so the relaxed order is enough
+    void countLookUp(LookUpStatus status) {
+        auto& counter = status == LookUpStatus::Hit ? _hits : _misses;
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void countEviction() {
+        _evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
+    std::atomic_size_t _evictions{0};
 };
 
 /**
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType), ValueType get(const KeyType&),
+ *         size() and getCapacity() interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -60,9 +98,13 @@ public:
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
             retVal = builder(key);
-            if (retVal != retEmpty)
+            if (retVal != retEmpty) {
+                if (_impl.size() == _impl.getCapacity())
+                    countEviction();
                 _impl.put(key, retVal);
+            }
         }
+        countLookUp(retStatus);
         return {retVal, retStatus};
     }
 
@@ -85,6 +85,26 @@ public:
          return _capacity;
      }
 
+    /**
+     * @brief Returns the number of the stored records
+     * @return the number of the stored records
+     */
+    size_t size() const noexcept {
+        return _cacheMapper.size();
+    }
+
+    /**
+     * @brief Removes the record associated with the key
+     * @param key
+     */
+    void erase(const Key &key) {
+        auto itr = _cacheMapper.find(key);
+        if (itr != _cacheMapper.end()) {
+            _lruList.erase(itr->second);
+            _cacheMapper.erase(itr);
+        }
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key &k) const {
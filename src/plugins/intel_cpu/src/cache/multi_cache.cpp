@@ -4,10 +4,37 @@
 
 #include "multi_cache.h"
 
+#include <map>
+
 namespace ov {
 namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+CacheStatistics MultiCache::getStatistics() const {
+    std::unique_lock<std::mutex> lock(_storageMutex, std::defer_lock);
+    if (_threadSafe)
+        lock.lock();
+    CacheStatistics stats;
+    for (const auto& entry : _storage) {
+        stats += entry.second->getStatistics();
+    }
+    return stats;
+}
+
+MultiCachePtr getProcessRuntimeCache(size_t capacity) {
+    static std::mutex mutex;
+    static std::map<size_t, std::weak_ptr<MultiCache>> caches;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& weakCache = caches[capacity];
+    auto cache = weakCache.lock();
+    if (!cache) {
+        cache = std::make_shared<MultiCache>(capacity, true);
+        weakCache = cache;
+    }
+    return cache;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
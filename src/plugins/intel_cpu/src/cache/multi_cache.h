@@ -7,7 +7,9 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
+#include "shared_cache_entry.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -15,7 +17,8 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE unless it is constructed as a thread safe one!
+ *            The thread safe cache may be shared between the streams, see SharedCacheEntry.
  */
 
 class MultiCache {
@@ -24,14 +27,20 @@ public:
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
-    using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
+    using SharedEntryTypeT = SharedCacheEntry<KeyType, ValueType>;
 
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param threadSafe the cache may be used from several threads simultaneously
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false) : _capacity(capacity), _threadSafe(threadSafe) {}
+
+    MultiCache(const MultiCache& other) : _capacity(other._capacity), _threadSafe(other._threadSafe) {
+        std::lock_guard<std::mutex> lock(other._storageMutex);
+        _storage = other._storage;
+    }
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -45,19 +54,36 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
+        if (_threadSafe) {
+            auto entry = getEntry<SharedEntryTypeT<KeyType, ValueType>>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
+        auto entry = getEntry<EntryTypeT<KeyType, ValueType>>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    bool isThreadSafe() const noexcept {
+        return _threadSafe;
+    }
+
+    /**
+    * @brief Returns hit/miss/eviction counters accumulated over all the entries
+    * @note The statistics of the cache which is not thread safe must not be read while the cache is used
+    */
+    CacheStatistics getStatistics() const;
+
 private:
     template<typename T>
     size_t getTypeId();
-    template<typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template<typename EntryType>
+    std::shared_ptr<EntryType> getEntry();
 
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    bool _threadSafe;
+    // guards the storage of the thread safe cache only, the thread safe entries synchronize the records themselves
+    mutable std::mutex _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -67,10 +93,12 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template<typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template<typename EntryType>
+std::shared_ptr<EntryType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
+    std::unique_lock<std::mutex> lock(_storageMutex, std::defer_lock);
+    if (_threadSafe)
+        lock.lock();
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
@@ -82,5 +110,11 @@ MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
 using MultiCachePtr = std::shared_ptr<MultiCache>;
 using MultiCacheCPtr = std::shared_ptr<const MultiCache>;
 
+/**
+ * @brief Returns the thread safe cache shared by all the users in the process that request the same capacity.
+ *        The cache lives while it is used by somebody.
+ */
+MultiCachePtr getProcessRuntimeCache(size_t capacity);
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -0,0 +1,127 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <future>
+#include <mutex>
+#include <vector>
+#include "cache_entry.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Thread safe counterpart of the CacheEntry that may be used by several streams simultaneously.
+ * The records are distributed between the shards by the key hash, each shard is a separate LRU cache with its own lock.
+ * The record is inserted before the value is built, so the concurrent requests of the same key wait for the single build
+ * instead of building the same value again.
+ * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note The values are shared between the streams, so they must not be modified after they are built.
+ * @note In this implementation default constructed value objects are treated as empty objects and are not cached.
+ */
+
+template<typename KeyType, typename ValType>
+class SharedCacheEntry : public CacheEntryBase {
+public:
+    using ResultType = std::pair<ValType, LookUpStatus>;
+
+public:
+    explicit SharedCacheEntry(size_t capacity) : _capacity(capacity) {
+        // small caches are not split, so the LRU policy is kept close to the global one
+        const size_t maxShardsNum = 16;
+        const size_t minShardCapacity = 64;
+        const size_t shardsNum = std::max<size_t>(1, std::min(maxShardsNum, capacity / minShardCapacity));
+        _shards.reserve(shardsNum);
+        for (size_t i = 0; i < shardsNum; i++) {
+            // the capacity is distributed between the shards, the first shards take the remainder
+            const size_t shardCapacity = capacity / shardsNum + (i < capacity % shardsNum ? 1 : 0);
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the builder functor and adds it to
+     *        the underlying storage. If the value for the key is being built by another thread, waits for that build to finish.
+     * @param key is the search key
+     * @param builder is a callable object that creates the ValType object from the KeyType lval reference
+     * @return result of the operation which is a pair of the requested object of ValType and the status of whether the cache hit or miss occurred
+     */
+
+    ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
+        if (0 == _capacity) {
+            // fast track
+            countLookUp(LookUpStatus::Miss);
+            return {builder(key), LookUpStatus::Miss};
+        }
+
+        auto& shard = *_shards[key.hash() % _shards.size()];
+        std::promise<ValType> promise;
+        RecordPtr record;
+        bool owner = false;
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            record = shard.impl.get(key);
+            if (!record) {
+                record = std::make_shared<Record>(promise.get_future().share());
+                owner = true;
+                if (shard.impl.size() == shard.impl.getCapacity())
+                    countEviction();
+                shard.impl.put(key, record);
+            }
+        }
+
+        if (!owner) {
+            // the value is either ready or being built by another thread
+            auto retVal = record->future.get();
+            countLookUp(LookUpStatus::Hit);
+            return {retVal, LookUpStatus::Hit};
+        }
+
+        ValType retVal;
+        try {
+            retVal = builder(key);
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+            forget(shard, key, record);
+            throw;
+        }
+        promise.set_value(retVal);
+        if (retVal == ValType())
+            forget(shard, key, record);
+
+        countLookUp(LookUpStatus::Miss);
+        return {retVal, LookUpStatus::Miss};
+    }
+
+private:
+    struct Record {
+        explicit Record(std::shared_future<ValType> future) : future(std::move(future)) {}
+        std::shared_future<ValType> future;
+    };
+    using RecordPtr = std::shared_ptr<Record>;
+
+    struct Shard {
+        explicit Shard(size_t capacity) : impl(capacity) {}
+
+        std::mutex mutex;
+        LruCache<KeyType, RecordPtr> impl;
+    };
+
+    // removes the failed or empty record, unless it has been replaced meanwhile
+    static void forget(Shard& shard, const KeyType& key, const RecordPtr& record) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (shard.impl.get(key) == record)
+            shard.impl.erase(key);
+    }
+
+    size_t _capacity;
+    std::vector<std::unique_ptr<Shard>> _shards;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -149,6 +149,31 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING == key) {
+            if (val == PluginConfigInternalParams::STREAM) rtCacheSharing = RuntimeCacheSharing::Stream;
+            else if (val == PluginConfigInternalParams::NETWORK) rtCacheSharing = RuntimeCacheSharing::Network;
+            else if (val == PluginConfigInternalParams::PROCESS) rtCacheSharing = RuntimeCacheSharing::Process;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_RUNTIME_CACHE_SHARING
+                           << ". Expected only STREAM/NETWORK/PROCESS";
+        } else if (PluginConfigInternalParams::KEY_CPU_WEIGHTS_CACHE_SHARING == key) {
+            if (val == PluginConfigInternalParams::NETWORK) weightsCacheSharing = WeightsCacheSharing::Network;
+            else if (val == PluginConfigInternalParams::PROCESS) weightsCacheSharing = WeightsCacheSharing::Process;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_WEIGHTS_CACHE_SHARING
+                           << ". Expected only NETWORK/PROCESS";
+        } else if (PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLEL == key) {
+            if (val == PluginConfigParams::YES) interOpParallel = true;
+            else if (val == PluginConfigParams::NO) interOpParallel = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLEL
+                           << ". Expected only YES/NO";
+        } else if (PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA == key) {
+            if (val == PluginConfigParams::YES) dynamicMemoryArena = true;
+            else if (val == PluginConfigParams::NO) dynamicMemoryArena = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA
+                           << ". Expected only YES/NO";
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -29,12 +29,27 @@ struct Config {
         DO_On,
     };
 
+    enum class RuntimeCacheSharing {
+        Stream,
+        Network,
+        Process,
+    };
+
+    enum class WeightsCacheSharing {
+        Network,
+        Process,
+    };
+
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
     std::string dumpToDot = "";
     int batchLimit = 0;
     size_t rtCacheCapacity = 5000ul;
+    RuntimeCacheSharing rtCacheSharing = RuntimeCacheSharing::Stream;
+    WeightsCacheSharing weightsCacheSharing = WeightsCacheSharing::Network;
+    bool interOpParallel = false;
+    bool dynamicMemoryArena = false;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
@@ -16,6 +16,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "nodes/reorder.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/numa_utils.hpp"
 
 using namespace InferenceEngine;
 using namespace dnnl;
@@ -183,13 +184,18 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > _memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
-        if (!ptr) {
-            throw std::bad_alloc();
+        void *ptr = _numaNodeId >= 0 ? allocateOnNumaNode(size, _numaNodeId) : nullptr;
+        if (ptr) {
+            _data = decltype(_data)(ptr, [size](void *data) { freeOnNumaNode(data, size); });
+        } else {
+            ptr = dnnl::impl::malloc(size, cacheLineSize);
+            if (!ptr) {
+                throw std::bad_alloc();
+            }
+            _data = decltype(_data)(ptr, destroy);
         }
         _memUpperBound = size;
         _useExternalStorage = false;
-        _data = decltype(_data)(ptr, destroy);
         sizeChanged = true;
     }
     return sizeChanged;
@@ -71,19 +71,21 @@ public:
 
 /**
  * @brief An implementation of the mem manager where memory reallocation occures only if bigger buffer is requested.
+ * If the NUMA node is set, the memory is mapped for the manager only, bound to the node and touched right away.
  */
 class MemoryMngrWithReuse : public IMemoryMngr {
 public:
-    MemoryMngrWithReuse() : _data(nullptr, release) {}
+    explicit MemoryMngrWithReuse(int numaNodeId = -1) : _numaNodeId(numaNodeId), _data(nullptr, release) {}
     void* getRawPtr() const noexcept override;
     void setExtBuff(void* ptr, size_t size) override;
     bool resize(size_t size) override;
     bool hasExtBuffer() const noexcept override;
 
 private:
+    int _numaNodeId = -1;
     bool _useExternalStorage = false;
     size_t _memUpperBound = 0ul;
-    std::unique_ptr<void, void (*)(void *)> _data;
+    std::unique_ptr<void, std::function<void(void *)>> _data;
 
     static void release(void *ptr);
     static void destroy(void *ptr);
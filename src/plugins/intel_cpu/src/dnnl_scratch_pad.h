@@ -18,8 +18,8 @@ class DnnlScratchPad {
     dnnl::engine eng;
 
 public:
-    DnnlScratchPad(dnnl::engine eng) : eng(eng) {
-        mgrPtr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()));
+    DnnlScratchPad(dnnl::engine eng, int numaNodeId = -1) : eng(eng) {
+        mgrPtr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse(numaNodeId)));
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
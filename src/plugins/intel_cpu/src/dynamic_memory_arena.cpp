@@ -0,0 +1,116 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_memory_arena.h"
+#include "utils/general_utils.h"
+
+#include <common/primitive_hashing_utils.hpp>
+#include <memory_solver.hpp>
+
+#include <algorithm>
+
+namespace ov {
+namespace intel_cpu {
+
+size_t DynamicMemoryArena::PlanKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& dims : inputShapes) {
+        seed = hash_combine(seed, dims.size());
+        for (const auto& dim : dims) {
+            seed = hash_combine(seed, dim);
+        }
+    }
+    return seed;
+}
+
+DynamicMemoryArena::DynamicMemoryArena(int numaNodeId, size_t plansCapacity)
+    : numaNodeId(numaNodeId), arena(numaNodeId), plans(plansCapacity) {}
+
+DnnlMemoryMngrPtr DynamicMemoryArena::addTensor(std::vector<EdgePtr> edges, int start, int finish) {
+    auto memMngr = std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse(numaNodeId)));
+    tensors.push_back({std::move(edges), start, finish, memMngr, false});
+    // a new tensor invalidates the plans
+    plans.evict(plans.size());
+    planApplied = false;
+    return memMngr;
+}
+
+void DynamicMemoryArena::prepare(const std::vector<VectorDims>& inputShapes) {
+    if (planApplied && current.inputShapes == inputShapes)
+        return;
+
+    current.inputShapes = inputShapes;
+    planApplied = false;
+    auto plan = plans.get(current);
+    if (!plan)
+        return;
+
+    // the buffer is reallocated only if it is too small for the plan
+    arena.resize(plan->size);
+    arenaSize = std::max(arenaSize, plan->size);
+    auto data = static_cast<uint8_t*>(arena.getRawPtr());
+    for (size_t i = 0; i < tensors.size(); i++) {
+        auto& tensor = tensors[i];
+        if (plan->sizes[i] != 0) {
+            tensor.memMngr->setExtBuff(data + plan->offsets[i], plan->sizes[i]);
+            tensor.bound = true;
+        } else if (tensor.bound) {
+            // the tensor wasn't defined when the plan was built, so it gets the own memory on the first resize
+            tensor.memMngr->setExtBuff(nullptr, 0);
+            tensor.bound = false;
+        }
+    }
+    planApplied = true;
+}
+
+void DynamicMemoryArena::update() {
+    // a bound tensor loses the external buffer only if it needs more memory than planned
+    if (planApplied && std::all_of(tensors.begin(), tensors.end(), [](const Tensor& tensor) {
+            return !tensor.bound || tensor.memMngr->hasExtBuffer();
+        })) {
+        return;
+    }
+
+    constexpr size_t alignment = 32;  // 32 bytes, the same as for the static memory
+
+    auto plan = std::make_shared<Plan>();
+    plan->offsets.resize(tensors.size(), 0);
+    plan->sizes.resize(tensors.size(), 0);
+    plan->size = 0;
+
+    std::vector<MemorySolver::Box> boxes;
+    for (size_t i = 0; i < tensors.size(); i++) {
+        auto& tensor = tensors[i];
+        size_t size = 0;
+        for (auto& edge : tensor.edges) {
+            if (edge->getStatus() != Edge::Status::Validated)
+                continue;
+            const auto& desc = edge->getMemory().getDesc();
+            if (desc.isDefined())
+                size = std::max(size, desc.getCurrentMemSize());
+        }
+        if (size == 0)
+            continue;
+        plan->sizes[i] = size;
+        boxes.push_back({tensor.start, tensor.finish, static_cast<int64_t>(div_up(size, alignment)), static_cast<int64_t>(i)});
+    }
+
+    if (!boxes.empty()) {
+        MemorySolver solver(boxes);
+        plan->size = static_cast<size_t>(solver.solve()) * alignment;
+        for (const auto& box : boxes) {
+            plan->offsets[box.id] = static_cast<size_t>(solver.getOffset(box.id)) * alignment;
+        }
+    }
+
+    // the plan is applied by the next prepare call, the outputs of the finished inference may be still in use
+    plans.put(current, plan);
+    planApplied = false;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
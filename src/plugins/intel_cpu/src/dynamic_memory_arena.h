@@ -0,0 +1,104 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+#include "edge.h"
+#include "cache/lru_cache.h"
+
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief One growable buffer for the intermediate tensors of a dynamic graph.
+ *
+ * The tensor sizes of a dynamic graph are known only during the inference, so the tensors can't be placed once on load
+ * like in a static graph. Instead the sizes used by an inference are collected afterwards, MemorySolver places the
+ * tensors by their lifetimes, and the plan is cached by the graph input shapes. When the shapes are met again
+ * the tensors are bound to their offsets in the arena before the inference starts.
+ *
+ * While there is no plan for the input shapes or a tensor needs more memory than planned (data dependent shapes),
+ * the tensor memory manager allocates its own buffer as usual and the plan is rebuilt after the inference.
+ *
+ * Is not thread safe, the arena belongs to a graph which executes one inference at a time.
+ */
+class DynamicMemoryArena {
+public:
+    using Ptr = std::shared_ptr<DynamicMemoryArena>;
+
+    explicit DynamicMemoryArena(int numaNodeId = -1, size_t plansCapacity = 64);
+
+    /**
+     * @brief Registers the tensor
+     * @param edges - edges sharing the tensor memory
+     * @param start - execution index of the tensor producer
+     * @param finish - execution index of the last tensor consumer
+     * @return memory manager which the edges have to be allocated with
+     */
+    DnnlMemoryMngrPtr addTensor(std::vector<EdgePtr> edges, int start, int finish);
+
+    /**
+     * @brief Binds the tensors to the plan of the input shapes if it is known, called before the inference
+     */
+    void prepare(const std::vector<VectorDims>& inputShapes);
+
+    /**
+     * @brief Builds the plan for the current input shapes if the finished inference didn't fit into the applied one
+     */
+    void update();
+
+    /**
+     * @brief Returns the size of the arena buffer in bytes
+     */
+    size_t getSize() const {
+        return arenaSize;
+    }
+
+    /**
+     * @brief Checks if the tensors are bound to the plan of the current input shapes
+     */
+    bool isPlanApplied() const {
+        return planApplied;
+    }
+
+private:
+    struct Tensor {
+        std::vector<EdgePtr> edges;
+        int start;
+        int finish;
+        DnnlMemoryMngrPtr memMngr;
+        bool bound;
+    };
+
+    struct Plan {
+        std::vector<size_t> offsets;
+        std::vector<size_t> sizes;
+        size_t size;
+    };
+    using PlanPtr = std::shared_ptr<const Plan>;
+
+    struct PlanKey {
+        std::vector<VectorDims> inputShapes;
+
+        size_t hash() const;
+        bool operator==(const PlanKey& rhs) const {
+            return inputShapes == rhs.inputShapes;
+        }
+    };
+
+    std::vector<Tensor> tensors;
+    int numaNodeId;
+    MemoryMngrWithReuse arena;
+    size_t arenaSize = 0;
+    LruCache<PlanKey, PlanPtr> plans;
+    PlanKey current;
+    bool planApplied = false;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
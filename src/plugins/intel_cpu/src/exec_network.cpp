@@ -13,6 +13,7 @@
 #include "serialize.h"
 #include "ngraph/type/element_type.hpp"
 #include "nodes/memory.hpp"
+#include "utils/numa_utils.hpp"
 #include <threading/ie_executor_manager.hpp>
 #define FIX_62820 0
 #if FIX_62820 && ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
@@ -24,11 +25,13 @@
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
 
 #include <algorithm>
+#include <set>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -64,12 +67,14 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const CompiledGraphState::CPtr& compiledState) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _cfg{cfg},
     _name{network.getName()},
-    _network(network) {
+    _network(network),
+    _compiledState(compiledState) {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -106,6 +111,13 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
 #else
         _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
 #endif
+        // memory placement makes sense only if the stream threads stay on their NUMA nodes
+        auto cpuStreamsExecutor = std::dynamic_pointer_cast<CPUStreamsExecutor>(_taskExecutor);
+        if (cpuStreamsExecutor && streamsExecutorConfig._threadBindingType != IStreamsExecutor::ThreadBindingType::NONE) {
+            auto numaNodes = cpuStreamsExecutor->GetUsedNumaNodes();
+            if (numaNodes.size() > 1)
+                _numaNodes = std::move(numaNodes);
+        }
     }
     if (0 != cfg.streamExecutorConfig._streams) {
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -119,6 +131,17 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
 
+    if (_cfg.rtCacheSharing == Config::RuntimeCacheSharing::Network) {
+        _rtCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, true);
+    } else if (_cfg.rtCacheSharing == Config::RuntimeCacheSharing::Process) {
+        _rtCache = getProcessRuntimeCache(_cfg.rtCacheCapacity);
+    }
+
+    if (_cfg.weightsCacheSharing == Config::WeightsCacheSharing::Process) {
+        _processWeights = getProcessWeightsSharing();
+        _numaNodesWeights = NumaNodesWeights(_processWeights);
+    }
+
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -139,6 +162,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         ExecNetwork::GetGraph();
     }
+    _compiledState.reset();
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -181,6 +205,10 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
                     graphLock._graph.setConfig(_cfg);
                 }
+                graphLock._graph.setCompiledState(_compiledState);
+                if (_rtCache)
+                    graphLock._graph.setRuntimeCache(_rtCache);
+                graphLock._graph.setNumaNodeId(_numaNodes.empty() ? -1 : numaNodeId);
                 graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId], _mutex);
             } catch(...) {
                 exception = std::current_exception();
@@ -287,6 +315,14 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
 InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const {
     if (_graphs.empty())
         IE_THROW() << "No graph was found";
+    // the internal statistics properties are not advertised in supported_properties,
+    // the graphs are locked one by one while the statistics are collected
+    if (name == ov::cpu_memory_numa_statistics)
+        return decltype(ov::cpu_memory_numa_statistics)::value_type(GetNumaMemoryStatistics());
+    if (name == ov::cpu_runtime_cache_statistics)
+        return decltype(ov::cpu_runtime_cache_statistics)::value_type(GetRuntimeCacheStatistics());
+    if (name == ov::cpu_weights_sharing_statistics)
+        return decltype(ov::cpu_weights_sharing_statistics)::value_type(GetWeightsSharingStatistics());
     // @todo Can't we just use local copy (_cfg) instead?
     auto graphLock = GetGraph();
     const auto& graph = graphLock._graph;
@@ -360,6 +396,55 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     return GetMetricLegacy(name, graph);
 }
 
+std::map<std::string, uint64_t> ExecNetwork::GetRuntimeCacheStatistics() const {
+    CacheStatistics stats;
+    if (_rtCache) {
+        stats = _rtCache->getStatistics();
+    } else {
+        // the caches of the streams are not thread safe, so each one is read while its graph is locked
+        std::set<MultiCachePtr> caches;
+        for (auto& graph : _graphs) {
+            auto graphLock = GraphGuard::Lock(graph);
+            auto cache = graphLock._graph.getRuntimeCache();
+            if (cache && caches.insert(cache).second)
+                stats += cache->getStatistics();
+        }
+    }
+    return {{"hits", stats.hits}, {"misses", stats.misses}, {"evictions", stats.evictions}};
+}
+
+std::map<std::string, uint64_t> ExecNetwork::GetWeightsSharingStatistics() const {
+    if (!_processWeights)
+        return {};
+    return _processWeights->getStatistics();
+}
+
+std::map<std::string, uint64_t> ExecNetwork::GetNumaMemoryStatistics() const {
+    std::vector<std::pair<const void*, size_t>> buffers;
+    for (auto& graph : _graphs) {
+        auto graphLock = GraphGuard::Lock(graph);
+        if (!graphLock._graph.IsReady())
+            continue;
+        for (auto& edge : graphLock._graph.GetEdges()) {
+            if (edge->getStatus() != Edge::Status::Validated)
+                continue;
+            const auto& memory = edge->getMemoryPtr();
+            if (!memory || !memory->isAllocated())
+                continue;
+            const auto size = memory->getDesc().getCurrentMemSize();
+            if (size != MemoryDesc::UNDEFINED_SIZE)
+                buffers.emplace_back(memory->GetData(), size);
+        }
+    }
+
+    std::map<std::string, uint64_t> stats;
+    for (const auto& placement : getNumaPlacement(buffers)) {
+        const auto key = placement.first < 0 ? std::string("not_resident") : "node_" + std::to_string(placement.first);
+        stats[key] = placement.second;
+    }
+    return stats;
+}
+
 bool ExecNetwork::canBeExecViaLegacyDynBatch(std::shared_ptr<const ov::Model> function, int64_t& maxBatchSize) const {
     maxBatchSize = -1;
     auto isDynBatchWithUpperBound = [maxBatchSize](const ov::PartialShape& shape) -> bool {
@@ -545,6 +630,9 @@ bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network)
 void ExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+
+    // the compiled state follows the model, so the blobs stay readable by the model deserializer
+    GetGraph()._graph.getCompiledState()->write(modelStream, _cfg);
 }
 
 }   // namespace intel_cpu
@@ -36,7 +36,8 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const CompiledGraphState::CPtr& compiledState = nullptr);
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
@@ -70,6 +71,14 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                    _numaNodesWeights;
+    // weights store shared with the other networks of the process, null if the weights are shared by the streams only
+    ProcessWeightsSharing::Ptr                  _processWeights;
+    // compilation results of the imported graph, used only while the graphs are created
+    CompiledGraphState::CPtr                    _compiledState;
+    // runtime parameters cache shared by the streams, null if each stream owns its cache
+    MultiCachePtr                               _rtCache;
+    // NUMA nodes of the streams if the graphs memory and the infer requests are bound to them, empty otherwise
+    std::vector<int>                            _numaNodes;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -80,6 +89,12 @@ protected:
     bool canBeExecViaLegacyDynBatch(std::shared_ptr<const ov::Model> function, int64_t& maxBatchSize) const;
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
 
+    std::map<std::string, uint64_t> GetRuntimeCacheStatistics() const;
+
+    std::map<std::string, uint64_t> GetNumaMemoryStatistics() const;
+
+    std::map<std::string, uint64_t> GetWeightsSharingStatistics() const;
+
     bool isLegacyAPI() const;
 
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
@@ -25,9 +25,11 @@
 #include "nodes/input.h"
 #include <nodes/reorder.h>
 #include "nodes/convert.h"
+#include "nodes/concat.h"
 #include "nodes/subgraph.h"
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -76,12 +78,14 @@ void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
 
     if (IsReady())
         ForgetGraphData();
-    // disable weights caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable weights caching if graph was created only once and the weights are not shared with other models
+    weightsCache = config.streamExecutorConfig._streams != 1 || (w_cache && w_cache->getProcessWeights()) ? w_cache : nullptr;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    // the nodes executed concurrently in the inter-op parallel mode share the cache
+    if (!rtParamsCache)
+        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity, config.interOpParallel);
     sharedMutex = mutex;
-    rtScratchPad = std::make_shared<DnnlScratchPad>(getEngine());
+    rtScratchPad = std::make_shared<DnnlScratchPad>(getEngine(), numaNodeId);
 
     Replicate(net, extMgr);
 
@@ -98,11 +102,11 @@ void Graph::CreateGraph(const std::vector<NodePtr> &graphNodes,
                               std::string name) {
     if (IsReady())
         ForgetGraphData();
-    // disable weights caching if graph was created only once
-    weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
+    // disable weights caching if graph was created only once and the weights are not shared with other models
+    weightsCache = config.streamExecutorConfig._streams != 1 || (w_cache && w_cache->getProcessWeights()) ? w_cache : nullptr;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
-    rtScratchPad = std::make_shared<DnnlScratchPad>(getEngine());
+    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity, config.interOpParallel);
+    rtScratchPad = std::make_shared<DnnlScratchPad>(getEngine(), numaNodeId);
 
     this->_name = std::move(name);
     this->reuse_io_tensors = false;
@@ -410,6 +414,8 @@ void Graph::InitGraph() {
     optimizer.ApplyImplSpecificGraphOptimizations(*this);
     SortTopologically();
 
+    InitExecutionStages();
+
     Allocate();
 
     CreatePrimitives();
@@ -422,6 +428,9 @@ void Graph::InitGraph() {
     ExtractConstantAndExecutableNodes();
 
     ExecuteConstantNodesOnly();
+
+    // the compiled state is needed only once, release the constants data
+    compiledState.reset();
 }
 
 void Graph::InitNodes() {
@@ -460,8 +469,31 @@ void Graph::InitDescriptors() {
 
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
-        node->selectOptimalPrimitiveDescriptor();
+        if (RestoreSelectedPrimitiveDescriptor(node))
+            restoredNodes.insert(node.get());
+        else
+            node->selectOptimalPrimitiveDescriptor();
+    }
+}
+
+bool Graph::RestoreSelectedPrimitiveDescriptor(const NodePtr& node) const {
+    if (!compiledState)
+        return false;
+
+    const auto it = compiledState->selectedDescriptors.find(node->getName());
+    if (it == compiledState->selectedDescriptors.end())
+        return false;
+
+    const auto& supportedPrimitiveDescriptors = node->getSupportedPrimitiveDescriptors();
+    const int index = it->second.index;
+    if (index < 0 || index >= static_cast<int>(supportedPrimitiveDescriptors.size()) ||
+        supportedPrimitiveDescriptors[index].getImplementationType() != it->second.implType) {
+        DEBUG_LOG("Cannot restore the selected primitive descriptor of node ", node->getName());
+        return false;
     }
+
+    node->selectPrimitiveDescriptorByIndex(index);
+    return true;
 }
 
 void Graph::InitOptimalPrimitiveDescriptors() {
@@ -487,9 +519,97 @@ void Graph::ExtractConstantAndExecutableNodes() {
             executableGraphNodes.emplace_back(graphNode);
         }
     }
+
+    if (execIndexToStage.empty())
+        return;
+
+    for (const auto& node : executableGraphNodes) {
+        const size_t stage = execIndexToStage[node->execIndex];
+        if (stage >= executableStages.size())
+            executableStages.resize(stage + 1);
+        executableStages[stage].emplace_back(node);
+    }
+
+    executableStages.erase(std::remove_if(executableStages.begin(), executableStages.end(),
+                                          [](const std::vector<NodePtr>& stage) { return stage.empty(); }),
+                           executableStages.end());
+}
+
+void Graph::InitExecutionStages() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitExecutionStages");
+
+    execIndexToStage.clear();
+    executableStages.clear();
+    maxStageWidth = 1;
+
+    if (!config.interOpParallel)
+        return;
+
+    // State nodes have hidden dependencies between each other, while dynamic nodes reallocate their memory
+    // and update their executors during the execution. Such graphs are executed sequentially.
+    for (const auto& node : graphNodes) {
+        if (node->isDynamicNode() || one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput)) {
+            DEBUG_LOG("Inter-op parallel execution is disabled for graph ", _name, " due to node ", node->getName());
+            return;
+        }
+    }
+
+    // graphNodes are sorted topologically, so the stages of all the parents are already known
+    std::vector<int> stages(graphNodes.size(), 0);
+    for (const auto& node : graphNodes) {
+        int stage = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto parent = node->getParentEdgeAt(i)->getParent();
+            if (parent->isConstant())
+                continue;
+            stage = std::max(stage, stages[parent->execIndex] + 1);
+        }
+
+        // a node that overwrites its input in place must not run together with the other readers of this input
+        if (const auto selectedPd = node->getSelectedPrimitiveDescriptor()) {
+            for (const auto& outConf : selectedPd->getConfig().outConfs) {
+                const int inPlacePort = outConf.inPlace();
+                if (inPlacePort < 0 || inPlacePort >= static_cast<int>(node->getParentEdges().size()))
+                    continue;
+                const auto inPlaceEdge = node->getParentEdgeAt(inPlacePort);
+                for (const auto& sibling : inPlaceEdge->getParent()->getChildEdgesAtPort(inPlaceEdge->getInputNum())) {
+                    const auto reader = sibling->getChild();
+                    if (reader == node)
+                        continue;
+                    if (reader->execIndex > node->execIndex) {
+                        DEBUG_LOG("Inter-op parallel execution is disabled for graph ", _name, " due to in-place node ", node->getName());
+                        return;
+                    }
+                    stage = std::max(stage, stages[reader->execIndex] + 1);
+                }
+            }
+        }
+
+        stages[node->execIndex] = stage;
+    }
+
+    // nodes from one stage may run concurrently, so each of them requires its own scratchpad
+    std::vector<size_t> stageWidth(graphNodes.size(), 0);
+    std::vector<DnnlScratchPadPtr> laneScratchPads{rtScratchPad};
+    for (const auto& node : graphNodes) {
+        if (node->isConstant())
+            continue;
+        const size_t lane = stageWidth[stages[node->execIndex]]++;
+        if (lane == laneScratchPads.size())
+            laneScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), numaNodeId));
+        node->setRuntimeScratchPad(laneScratchPads[lane]);
+    }
+
+    maxStageWidth = laneScratchPads.size();
+    if (maxStageWidth == 1) {
+        DEBUG_LOG("Graph ", _name, " has no independent branches, it is executed sequentially");
+        return;
+    }
+
+    execIndexToStage = std::move(stages);
 }
 
-void Graph::ExecuteConstantNodesOnly() const {
+void Graph::ExecuteConstantNodesOnly() {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ExecuteConstantNodesOnly");
     dnnl::stream stream(eng);
 
@@ -517,18 +637,53 @@ void Graph::ExecuteConstantNodesOnly() const {
         return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
     };
 
+    // The outputs of the constant nodes may be restored from the compiled state of the exported graph.
+    // In this case the constant subgraphs which produce them are not executed at all.
+    enum class ConstantAction { Execute, Restore, Skip };
+    std::unordered_map<const Node*, ConstantAction> actions;
+    if (compiledState) {
+        for (auto it = constantGraphNodes.rbegin(); it != constantGraphNodes.rend(); ++it) {
+            const auto& node = *it;
+            if (CanRestoreConstantOutputs(node)) {
+                actions[node.get()] = ConstantAction::Restore;
+                continue;
+            }
+
+            bool required = node->getChildEdges().empty();
+            for (size_t i = 0; i < node->getChildEdges().size() && !required; i++) {
+                const auto child = node->getChildEdgeAt(i)->getChild();
+                required = !child->isConstant() || actions[child.get()] == ConstantAction::Execute;
+            }
+            actions[node.get()] = required ? ConstantAction::Execute : ConstantAction::Skip;
+        }
+    }
+
+    auto executeOrRestore = [&](const NodePtr& node, ConstantAction action) {
+        if (action == ConstantAction::Restore) {
+            RestoreConstantOutputs(node);
+            restoredNodes.insert(node.get());
+        } else {
+            ExecuteNode(node, stream);
+        }
+    };
+
     for (const auto &node : constantGraphNodes) {
+        const auto actionIt = actions.find(node.get());
+        const auto action = actionIt != actions.end() ? actionIt->second : ConstantAction::Execute;
+        if (action == ConstantAction::Skip)
+            continue;
+
         if (weightsCache) {
             auto sharedOutputs = acquireSharedOutputs(node);
 
             if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                ExecuteNode(node, stream);
+                executeOrRestore(node, action);
 
                 for (auto & output : std::get<2>(sharedOutputs))
                     output->valid(true);
             }
         } else {
-            ExecuteNode(node, stream);
+            executeOrRestore(node, action);
         }
     }
 }
@@ -627,6 +782,70 @@ static inline bool isConstOutput(EdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
+bool Graph::CanRestoreConstantOutputs(const NodePtr& node) const {
+    if (!compiledState || compiledState->constants.empty() || node->getChildEdges().empty())
+        return false;
+
+    // a restored node is not executed, so all its outputs must be present in the compiled state
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        const auto edge = node->getChildEdgeAt(i);
+        if (!isConstOutput(edge))
+            return false;
+
+        const auto it = compiledState->constants.find(edge->name());
+        if (it == compiledState->constants.end())
+            return false;
+
+        const auto& memory = edge->getMemory();
+        if (!memory.getDesc().isDefined() ||
+            it->second.format != memory.getDesc().serializeFormat() ||
+            it->second.size != memory.GetSize())
+            return false;
+    }
+
+    return true;
+}
+
+void Graph::RestoreConstantOutputs(const NodePtr& node) const {
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        const auto edge = node->getChildEdgeAt(i);
+        const auto& constant = compiledState->constants.at(edge->name());
+        cpu_memcpy(edge->getMemory().GetData(), constant.data.get(), constant.size);
+    }
+}
+
+CompiledGraphState::Ptr Graph::getCompiledState() const {
+    auto state = std::make_shared<CompiledGraphState>();
+
+    for (const auto& node : graphNodes) {
+        const auto selectedPd = node->getSelectedPrimitiveDescriptor();
+        if (selectedPd)
+            state->selectedDescriptors[node->getName()] = {node->selectedPrimitiveDescriptorIndex, selectedPd->getImplementationType()};
+    }
+
+    for (const auto& edge : graphEdges) {
+        if (!isConstOutput(edge))
+            continue;
+
+        // model constants are already stored in the blob, in-place nodes just reinterpret their parents data
+        const auto parent = edge->getParent();
+        if (parent->getType() == Type::Input || parent->isInPlace())
+            continue;
+
+        const auto& memory = edge->getMemoryPtr();
+        if (!memory->getDesc().isDefined())
+            continue;
+
+        // the data is not copied, the state keeps the memory of the edge alive
+        auto& constant = state->constants[edge->name()];
+        constant.format = memory->getDesc().serializeFormat();
+        constant.data = std::shared_ptr<const uint8_t>(memory, static_cast<const uint8_t*>(memory->GetData()));
+        constant.size = memory->GetSize();
+    }
+
+    return state;
+}
+
 static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges) {
     typedef std::unordered_map<EdgePtr, size_t> edge_cluster_idx_map_t;
 
@@ -705,14 +924,19 @@ void Graph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // in the inter-op parallel mode nodes from one stage run concurrently, so the memory lifetimes are measured in stages
+    auto lifetimeIndex = [this](const NodePtr& node) {
+        return execIndexToStage.empty() ? node->execIndex : execIndexToStage[node->execIndex];
+    };
+
     std::vector<MemorySolver::Box> definedBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
     for (int i = 0; i < edge_clusters.size(); i++) {
         MemorySolver::Box box = { std::numeric_limits<int>::max(), 0, 0, i };
         int64_t boxSize = 0;
         for (auto &edge : edge_clusters[i]) {
-            int e_start = edge->getParent()->execIndex;
-            int e_finish = edge->getChild()->execIndex;
+            int e_start = lifetimeIndex(edge->getParent());
+            int e_finish = lifetimeIndex(edge->getChild());
 
             if (boxSize != -1 && edge->getDesc().hasDefinedMaxSize()) {
                 int64_t e_size = edge->getDesc().getMaxMemSize();  // size in bytes (from the beginning of data to the last element)
@@ -757,7 +981,7 @@ void Graph::AllocateWithReuse() {
     MemorySolver staticMemSolver(definedBoxes);
     size_t total_size = static_cast<size_t>(staticMemSolver.solve()) * alignment;
 
-    memWorkspace = std::make_shared<Memory>(eng);
+    memWorkspace = std::make_shared<Memory>(eng, std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse(numaNodeId)));
     memWorkspace->Create(DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{total_size})));
 
     if (edge_clusters.empty())
@@ -786,6 +1010,30 @@ void Graph::AllocateWithReuse() {
         IE_ASSERT(count == 1);
     }
 
+    // the intermediate tensors of the dynamic graph are placed in the arena, the tensors exchanged with the infer request
+    // or the states keep the individual memory, because their buffers may be replaced from outside
+    dynamicMemArena.reset();
+    if (config.dynamicMemoryArena && !undefinedBoxes.empty()) {
+        dynamicMemArena = std::make_shared<DynamicMemoryArena>(numaNodeId);
+        auto arenaBoxes = std::partition(undefinedBoxes.begin(), undefinedBoxes.end(), [&](const MemorySolver::Box& box) {
+            const auto& cluster = edge_clusters[box.id];
+            return std::any_of(cluster.begin(), cluster.end(), [](const EdgePtr& edge) {
+                return one_of(edge->getParent()->getType(), Type::Input, Type::MemoryInput) ||
+                       one_of(edge->getChild()->getType(), Type::Output, Type::MemoryOutput);
+            });
+        });
+        for (auto box = arenaBoxes; box != undefinedBoxes.end(); ++box) {
+            const auto& cluster = edge_clusters[box->id];
+            auto memMngr = dynamicMemArena->addTensor({cluster.begin(), cluster.end()}, box->start, box->finish);
+            for (auto& edge : cluster) {
+                if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                    edge->allocate(memMngr);
+                }
+            }
+        }
+        undefinedBoxes.erase(arenaBoxes, undefinedBoxes.end());
+    }
+
     if (!undefinedBoxes.empty()) {
         MemorySolver::normalizeBoxes(undefinedBoxes);
 
@@ -809,7 +1057,7 @@ void Graph::AllocateWithReuse() {
         }
         for (auto& group : groups) {
             auto grpMemMngr =
-                std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse()));
+                std::make_shared<DnnlMemoryMngr>(std::unique_ptr<MemoryMngrWithReuse>(new MemoryMngrWithReuse(numaNodeId)));
             for (auto& box : group) {
                 for (auto& edge : edge_clusters[box.id]) {
                     if (edge->getStatus() == Edge::Status::NeedAllocation) {
@@ -1017,6 +1265,69 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
     DEBUG_LOG(*node);
 }
 
+bool Graph::canUseExternalMemory(const NodePtr &node) {
+    // Input cannot be in-place with other primitives
+    for (auto& childEdge : node->getChildEdges()) {
+        auto ce = childEdge.lock();
+        if (!ce)
+            IE_THROW() << "Node " << node->getName() << " contains empty child edge";
+
+        auto& child = ce->getChild();
+
+        if (child->isConstant())
+            return false;
+
+        if (child->getType() == Type::Concatenation) {
+            auto concat = dynamic_cast<node::Concat*>(child.get());
+            if (concat && concat->isOptimized())
+                return false;
+        }
+
+        // Cannot be in-place before split because split is using different ptrs without offsets
+        if (child->getType() == Type::Split)
+            return false;
+
+        if (child->isInPlace())
+            return false;
+
+        auto& edges = child->getChildEdges();
+        for (auto& edge : edges) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << child->getName() << " contains empty child edge";
+
+            if (e->getMemory().GetData() == ce->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+bool Graph::canUseExternalMemory(const EdgePtr &parentEdge) {
+    void* defaultPtr = parentEdge->getMemory().GetData();
+    // Cannot be in-place after concat because concat is using different ptrs without offsets
+    auto parent = parentEdge->getParent();
+    NodePtr previousParent;
+    do {
+        previousParent = parent;
+        if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace())
+            return false;
+
+        auto& parentEdges = parent->getParentEdges();
+        for (auto& edge : parentEdges) {
+            auto e = edge.lock();
+            if (!e)
+                IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
+
+            if (e->getMemory().GetData() == defaultPtr) {
+                parent = e->getParent();
+                break;
+            }
+        }
+    } while (previousParent != parent);
+    return true;
+}
+
 void Graph::Infer(InferRequestBase* request) {
     if (!IsReady()) {
         IE_THROW() << "Wrong state. Topology is not ready.";
@@ -1024,18 +1335,77 @@ void Graph::Infer(InferRequestBase* request) {
 
     dnnl::stream stream(eng);
 
-    for (const auto& node : executableGraphNodes) {
-        VERBOSE(node, config.verbose);
-        PERF(node, config.collectPerfCounters);
+    if (dynamicMemArena) {
+        std::vector<VectorDims> inputShapes;
+        inputShapes.reserve(inputNodesMap.size());
+        for (const auto& input : inputNodesMap) {
+            const auto& node = input.second;
+            if (node->getChildEdges().empty() || !node->getChildEdgeAt(0)->getMemory().getDesc().isDefined()) {
+                inputShapes.emplace_back();
+            } else {
+                inputShapes.push_back(node->getChildEdgeAt(0)->getMemory().getStaticDims());
+            }
+        }
+        dynamicMemArena->prepare(inputShapes);
+    }
 
-        if (request)
-            request->ThrowIfCanceled();
-        ExecuteNode(node, stream);
+    if (!executableStages.empty()) {
+        InferStages(request, stream);
+    } else {
+        for (const auto& node : executableGraphNodes) {
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+
+            if (request)
+                request->ThrowIfCanceled();
+            ExecuteNode(node, stream);
+        }
     }
 
+    if (dynamicMemArena)
+        dynamicMemArena->update();
+
     if (infer_count != -1) infer_count++;
 }
 
+void Graph::InferStages(InferRequestBase* request, const dnnl::stream& stream) {
+    std::vector<dnnl::stream> laneStreams{stream};
+    for (size_t i = 1; i < maxStageWidth; i++)
+        laneStreams.emplace_back(eng);
+
+    std::vector<std::exception_ptr> laneErrors(maxStageWidth);
+
+    for (const auto& stage : executableStages) {
+        if (request)
+            request->ThrowIfCanceled();
+
+        if (stage.size() == 1) {
+            const auto& node = stage.front();
+            VERBOSE(node, config.verbose);
+            PERF(node, config.collectPerfCounters);
+            ExecuteNode(node, stream);
+            continue;
+        }
+
+        // the nested parallel sections of the nodes share the threads of the current stream
+        parallel_for(stage.size(), [&](size_t lane) {
+            const auto& node = stage[lane];
+            try {
+                VERBOSE(node, config.verbose);
+                PERF(node, config.collectPerfCounters);
+                ExecuteNode(node, laneStreams[lane]);
+            } catch (...) {
+                laneErrors[lane] = std::current_exception();
+            }
+        });
+
+        for (auto& error : laneErrors) {
+            if (error)
+                std::rethrow_exception(error);
+        }
+    }
+}
+
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
@@ -12,7 +12,10 @@
 #include "edge.h"
 #include "cache/multi_cache.h"
 #include "dnnl_scratch_pad.h"
+#include "dynamic_memory_arena.h"
+#include "serialize.h"
 #include <map>
+#include <unordered_set>
 #include <string>
 #include <vector>
 #include <memory>
@@ -51,6 +54,41 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    /**
+     * @brief Sets the compilation results of the previously exported graph, they are used by the next CreateGraph call
+     */
+    void setCompiledState(const CompiledGraphState::CPtr& state) {
+        compiledState = state;
+    }
+
+    /**
+     * @brief Collects the compilation results which are required to restore this graph on import
+     */
+    CompiledGraphState::Ptr getCompiledState() const;
+
+    /**
+     * @brief Sets the runtime parameters cache shared with other graphs, otherwise CreateGraph creates an own one
+     */
+    void setRuntimeCache(const MultiCachePtr& cache) {
+        rtParamsCache = cache;
+    }
+
+    MultiCachePtr getRuntimeCache() const {
+        return rtParamsCache;
+    }
+
+    /**
+     * @brief Sets the NUMA node the graph is executed on, the graph memory is allocated on this node by CreateGraph.
+     *        Negative value keeps the default placement
+     */
+    void setNumaNodeId(int id) {
+        numaNodeId = id;
+    }
+
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
     template<typename NET>
     void CreateGraph(NET &network,
                      const ExtensionManager::Ptr& extMgr,
@@ -71,6 +109,16 @@ public:
 
     void Infer(InferRequestBase* request = nullptr);
 
+    /**
+     * @brief Checks that the consumers of the input node can read its output from external memory
+     */
+    static bool canUseExternalMemory(const NodePtr &node);
+
+    /**
+     * @brief Checks that the producer of the edge can write its output to external memory
+     */
+    static bool canUseExternalMemory(const EdgePtr &parentEdge);
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -198,6 +246,23 @@ public:
         return graphHasDynamicInput;
     }
 
+    /**
+     * @brief Returns the stage of the inter-op parallel execution the node belongs to,
+     *        or -1 if the graph is executed sequentially
+     */
+    int getExecutionStage(const NodePtr& node) const {
+        return execIndexToStage.empty() ? -1 : execIndexToStage[node->getExecIndex()];
+    }
+
+    /**
+     * @brief Returns true if the compilation results of the node were taken from the compiled state of
+     *        the exported graph: the primitive descriptor was not selected again or the constant outputs
+     *        were not computed
+     */
+    bool isRestoredFromCompiledState(const NodePtr& node) const {
+        return restoredNodes.count(node.get()) != 0;
+    }
+
 protected:
     void VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes);
 
@@ -209,7 +274,9 @@ protected:
         outputNodesMap.clear();
         graphNodes.clear();
         graphEdges.clear();
+        dynamicMemArena.reset();
         _normalizePreprocMap.clear();
+        restoredNodes.clear();
     }
     Status status { NotReady };
     Config config;
@@ -221,6 +288,7 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    DynamicMemoryArena::Ptr dynamicMemArena;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -244,8 +312,13 @@ protected:
     void AllocateWithReuse();
     void CreatePrimitives();
     void ExtractConstantAndExecutableNodes();
+    void InitExecutionStages();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
-    void ExecuteConstantNodesOnly() const;
+    void InferStages(InferRequestBase* request, const dnnl::stream& stream);
+    void ExecuteConstantNodesOnly();
+    bool RestoreSelectedPrimitiveDescriptor(const NodePtr& node) const;
+    bool CanRestoreConstantOutputs(const NodePtr& node) const;
+    void RestoreConstantOutputs(const NodePtr& node) const;
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -263,8 +336,18 @@ private:
     std::vector<NodePtr> constantGraphNodes;
     std::vector<NodePtr> executableGraphNodes;
 
+    // inter-op parallel mode: executable nodes grouped by the longest path from the graph inputs.
+    // Nodes from one stage have no data dependencies between each other and may be executed concurrently.
+    // The stage index replaces execIndex as a lifetime timestamp in AllocateWithReuse.
+    std::vector<std::vector<NodePtr>> executableStages;
+    std::vector<int> execIndexToStage;
+    size_t maxStageWidth = 1;
+
     MultiCachePtr rtParamsCache;
+    int numaNodeId = -1;
     std::shared_ptr<std::mutex> sharedMutex = nullptr;
+    CompiledGraphState::CPtr compiledState;
+    std::unordered_set<const Node*> restoredNodes;
     DnnlScratchPadPtr rtScratchPad;
 
     void EnforceBF16();
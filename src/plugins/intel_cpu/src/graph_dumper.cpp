@@ -29,7 +29,7 @@ void serializeToXML(const Graph &graph, const std::string& path);
 
 namespace {
 
-std::map<std::string, std::string> extract_node_metadata(const NodePtr &node) {
+std::map<std::string, std::string> extract_node_metadata(const Graph &graph, const NodePtr &node) {
     std::map<std::string, std::string> serialization_info;
 
     if (node->getType() == Type::Input && node->isConstant()) {
@@ -109,6 +109,14 @@ std::map<std::string, std::string> extract_node_metadata(const NodePtr &node) {
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
 
+    // the nodes of one stage may be executed concurrently
+    const int stage = graph.getExecutionStage(node);
+    if (stage >= 0 && !node->isConstant())
+        serialization_info["executionStage"] = std::to_string(stage);
+
+    if (graph.isRestoredFromCompiledState(node))
+        serialization_info["restoredFromCompiledState"] = "true";
+
     return serialization_info;
 }
 
@@ -162,7 +170,7 @@ std::shared_ptr<ngraph::Function> dump_graph_as_ie_ngraph_net(const Graph &graph
             should_be_hold = true;
         }
 
-        auto meta_data = extract_node_metadata(node);
+        auto meta_data = extract_node_metadata(graph, node);
         std::shared_ptr<ngraph::Node> return_node;
         if (is_input) {
             auto& desc = node->getChildEdgeAt(0)->getMemory().getDesc();
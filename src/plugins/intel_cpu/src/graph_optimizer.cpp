@@ -20,6 +20,7 @@
 #include "nodes/reduce.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
+#include "nodes/fullyconnected.h"
 #include "nodes/common/cpu_convert.h"
 
 #include "onednn/dnnl.h"
@@ -65,6 +66,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseConvolutionMatMulDeconvAndBias(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseFCAndWeightsDecompression");
+    FuseFCAndWeightsDecompression(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMultiplyAndAdd");
     FuseMultiplyAndAdd(graph);
     graph.RemoveDroppedNodes();
@@ -298,6 +303,127 @@ void GraphOptimizer::FuseConvolutionMatMulDeconvAndBias(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isConstantInput = [](const NodePtr& node) {
+        return node->getType() == Type::Input && node->isConstant() && node->getChildEdges().size() == 1;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        const auto fcNode = std::dynamic_pointer_cast<node::FullyConnected>(graphNodes[i]);
+        if (!fcNode || fcNode->withWeightsDecompression() ||
+            !one_of(fcNode->getInputShapeAtPort(0).getRank(), 2, 3) || fcNode->getInputShapeAtPort(1).getRank() != 2 ||
+            !fcNode->canUseWeightsDecompression())
+            continue;
+
+        // FullyConnected <- [Reshape] <- Multiply <- [Subtract] <- Convert <- Constant [u8/i8]
+        NodePtr reshapeNode;
+        auto weightsNode = fcNode->getParentEdgesAtPort(1)[0]->getParent();
+        if (weightsNode->getType() == Type::Reshape && weightsNode->getChildEdges().size() == 1) {
+            reshapeNode = weightsNode;
+            weightsNode = reshapeNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        std::vector<NodePtr> eltwiseNodes;
+        while (weightsNode->getType() == Type::Eltwise && weightsNode->getChildEdges().size() == 1 &&
+               weightsNode->getFusedWith().empty() && weightsNode->getOriginalOutputPrecisionAtPort(0) == Precision::FP32) {
+            eltwiseNodes.insert(eltwiseNodes.begin(), weightsNode);
+            weightsNode = weightsNode->getParentEdgesAtPort(0)[0]->getParent();
+        }
+        const auto convertNode = weightsNode;
+        if (eltwiseNodes.empty() || convertNode->getType() != Type::Convert || convertNode->getChildEdges().size() != 1 ||
+            convertNode->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+        const auto weightsConstant = convertNode->getParentEdgesAtPort(0)[0]->getParent();
+        const auto weightsPrecision = weightsConstant->getOriginalOutputPrecisionAtPort(0);
+        if (!isConstantInput(weightsConstant) || !one_of(weightsPrecision, Precision::U8, Precision::I8))
+            continue;
+
+        // [OC, IC] weights or per-group [OC, groups, IC / groups] weights reshaped to [OC, IC]
+        const auto& weightsDims = weightsConstant->getOutputShapeAtPort(0).getStaticDims();
+        const auto& fcWeightsDims = fcNode->getInputShapeAtPort(1).getStaticDims();
+        if (weightsDims.size() != (reshapeNode ? 3 : 2))
+            continue;
+        const size_t groups = reshapeNode ? weightsDims[1] : 1;
+        if (weightsDims[0] != fcWeightsDims[0] || weightsDims.back() * groups != fcWeightsDims[1])
+            continue;
+        const size_t OC = weightsDims[0];
+
+        // the whole chain is folded into scale * w + shift per output channel and group
+        std::vector<float> scales(OC * groups, 1.f);
+        std::vector<float> shifts(OC * groups, 0.f);
+        auto foldConstant = [&](const NodePtr& eltwise) {
+            if (eltwise->getParentEdges().size() != 2)
+                return false;
+            const auto constant = std::dynamic_pointer_cast<node::Input>(eltwise->getParentEdgesAtPort(1)[0]->getParent());
+            if (!constant || !isConstantInput(constant) || constant->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+                return false;
+            // the values may vary along output channels and groups only
+            const auto dims = getNormalizedDimsBySize(constant->getOutputShapeAtPort(0).getStaticDims(), weightsDims.size());
+            if (dims.size() != weightsDims.size() || dims.back() != 1)
+                return false;
+            for (size_t d = 0; d < dims.size() - 1; d++) {
+                if (dims[d] != 1 && dims[d] != weightsDims[d])
+                    return false;
+            }
+
+            const auto data = static_cast<const float*>(constant->getMemoryPtr()->GetPtr());
+            const size_t groupsDim = reshapeNode ? dims[1] : 1;
+            for (size_t oc = 0; oc < OC; oc++) {
+                for (size_t g = 0; g < groups; g++) {
+                    const float value = data[(dims[0] == 1 ? 0 : oc) * groupsDim + (groupsDim == 1 ? 0 : g)];
+                    if (eltwise->getAlgorithm() == Algorithm::EltwiseSubtract) {
+                        shifts[oc * groups + g] -= value;
+                    } else {
+                        scales[oc * groups + g] *= value;
+                        shifts[oc * groups + g] *= value;
+                    }
+                }
+            }
+            return true;
+        };
+
+        bool isSuitable = true;
+        for (const auto& eltwise : eltwiseNodes) {
+            if (one_of(eltwise->getAlgorithm(), Algorithm::EltwiseSubtract, Algorithm::EltwiseMultiply)) {
+                isSuitable = foldConstant(eltwise);
+            } else if (eltwise->getAlgorithm() == Algorithm::EltwisePowerStatic) {
+                // scalar zero points and scales are converted to PowerStatic: (beta * x + gamma) ^ alpha
+                const auto powerStatic = std::dynamic_pointer_cast<node::Eltwise>(eltwise);
+                isSuitable = powerStatic && powerStatic->getAlpha() == 1.f;
+                for (size_t j = 0; isSuitable && j < scales.size(); j++) {
+                    scales[j] *= powerStatic->getBeta();
+                    shifts[j] = shifts[j] * powerStatic->getBeta() + powerStatic->getGamma();
+                }
+            } else {
+                isSuitable = false;
+            }
+            if (!isSuitable)
+                break;
+        }
+        if (!isSuitable)
+            continue;
+
+        fcNode->initWeightsDecompression(scales, shifts, groups);
+        for (const auto& eltwise : eltwiseNodes) {
+            if (eltwise->getParentEdges().size() == 2) {
+                auto constantEdge = eltwise->getParentEdgesAtPort(1)[0];
+                graph.RemoveEdge(constantEdge);
+            }
+            fcNode->addOriginalLayer(eltwise->getOriginalLayers());
+            graph.DropNode(eltwise);
+        }
+        fcNode->addOriginalLayer(convertNode->getOriginalLayers());
+        graph.DropNode(convertNode);
+
+        if (reshapeNode) {
+            reshapeNode->setOriginalInputPrecisionAtPort(0, weightsPrecision);
+            reshapeNode->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
+        }
+        fcNode->setOriginalInputPrecisionAtPort(1, weightsPrecision);
+    }
+}
+
 void GraphOptimizer::FuseDeconvolutionAndSimpleOperation(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
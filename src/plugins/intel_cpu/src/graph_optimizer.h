@@ -21,6 +21,7 @@ public:
 
 private:
     void FuseConvolutionMatMulDeconvAndBias(Graph &graph);
+    void FuseFCAndWeightsDecompression(Graph &graph);
     void FuseDeconvolutionAndSimpleOperation(Graph &graph);
     void FuseMultiplyAndAdd(Graph &graph);
     void MergeConvertAndScaleShift(Graph& graph);
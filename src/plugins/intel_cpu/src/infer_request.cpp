@@ -22,6 +22,7 @@
 #include <debug.h>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
+#include "utils/numa_utils.hpp"
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
@@ -29,6 +30,10 @@
 namespace ov {
 namespace intel_cpu {
 
+static inline void changeEdgePtr(const EdgePtr &edge, void *newPtr) {
+    edge->getMemoryPtr()->setDataHandle(newPtr);
+}
+
 void InferRequestBase::CreateInferRequest() {
     auto id = (execNetwork->_numRequests)++;
     profilingTask = openvino::itt::handle("INTEL_CPU_INFER_" + execNetwork->_name + "_" + std::to_string(id));
@@ -37,6 +42,12 @@ void InferRequestBase::CreateInferRequest() {
         IE_THROW() << "No graph was found";
     graph = &(execNetwork->GetGraph()._graph);
 
+    // the requests are spread over the NUMA nodes of the streams, so each one is executed close to its blobs
+    if (!execNetwork->_numaNodes.empty()) {
+        numaNodeId = execNetwork->_numaNodes[id % execNetwork->_numaNodes.size()];
+        blobAllocator = std::make_shared<NumaMemoryAllocator>(numaNodeId);
+    }
+
     initBlobs();
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
@@ -61,6 +72,12 @@ void InferRequestBase::CreateInferRequest() {
     }
 }
 
+InferenceEngine::Blob::Ptr InferRequestBase::createBlob(const InferenceEngine::TensorDesc& desc) const {
+    auto blob = blobAllocator ? make_blob_with_precision(desc, blobAllocator) : make_blob_with_precision(desc);
+    blob->allocate();
+    return blob;
+}
+
 InferRequestBase::~InferRequestBase() {
     --(execNetwork->_numRequests);
 }
@@ -93,49 +110,74 @@ void InferRequestBase::pushInput(const std::string& inputName, InferenceEngine::
 }
 
 void InferRequestBase::PushStates() {
+    // The state buffers are bound to the graph instead of copying the state in and out.
+    // If the graph edges can't use external memory, the memory nodes copy the state themselves.
     for (auto &node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
             auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
             if (!cur_node) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
+            auto state = findState(cur_node->getId());
+            if (!state)
+                continue;
+            const auto& input = state->getInputMemory();
+            cur_node->bindState(input, state->getOutputMemory());
+
+            auto childEdge = cur_node->getChildEdgeAt(0);
+            if (childEdge->getMemory().GetData() != input->GetData() &&
+                childEdge->getMemory().getDesc().isCompatible(input->getDesc()) &&
+                Graph::canUseExternalMemory(node)) {
+                for (auto& edge : node->getChildEdges()) {
+                    auto e = edge.lock();
+                    if (!e)
+                        IE_THROW() << "Node " << node->getName() << " contains empty child edge";
+
+                    changeEdgePtr(e, input->GetData());
                 }
             }
+        } else if (node->getType() == Type::MemoryOutput) {
+            auto cur_node = dynamic_cast<node::MemoryOutput*>(node.get());
+            if (!cur_node) {
+                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryOutput";
+            }
+            auto state = findState(cur_node->getId());
+            if (!state)
+                continue;
+            const auto& output = state->getOutputMemory();
+
+            auto parentEdge = cur_node->getParentEdgeAt(0);
+            if (parentEdge->getMemory().GetData() != output->GetData() &&
+                parentEdge->getMemory().getDesc().isCompatible(output->getDesc()) &&
+                Graph::canUseExternalMemory(parentEdge)) {
+                changeEdgePtr(parentEdge, output->GetData());
+            }
         }
     }
 }
 
 void InferRequestBase::PullStates() {
+    // Assign has written the new value to the second buffer of the state, make it the current one
     for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
+        if (node->getType() == Type::MemoryOutput) {
+            auto cur_node = dynamic_cast<node::MemoryOutput*>(node.get());
             if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->GetPtr());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
-                }
+                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryOutput";
             }
+            if (auto state = findState(cur_node->getId()))
+                state->commit();
         }
     }
 }
 
+std::shared_ptr<VariableState> InferRequestBase::findState(const std::string& id) const {
+    for (const auto& state : memoryStates) {
+        if (state->GetName() == id)
+            return std::dynamic_pointer_cast<VariableState>(state);
+    }
+    return nullptr;
+}
+
 void InferRequestBase::redefineMemoryForInputNodes() {
     const auto cpuInputNodes = graph->GetInputNodesMap();
 
@@ -196,10 +238,6 @@ std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestB
     return perfMap;
 }
 
-static inline void changeEdgePtr(const EdgePtr &edge, void *newPtr) {
-    edge->getMemoryPtr()->setDataHandle(newPtr);
-}
-
 void InferRequestBase::changeDefaultPtr() {
     for (auto& it : externalPtr) {
         const auto& inputNodesMap = graph->GetInputNodesMap();
@@ -209,55 +247,7 @@ void InferRequestBase::changeDefaultPtr() {
             if (inputNodePtr->getChildEdgeAt(0)->getMemory().GetData() == it.second)
                 continue;
             auto& childEdges = inputNodePtr->getChildEdges();
-            // Input cannot be in-place with other primitives
-            bool canBeInPlace = true;
-            for (auto& childEdge : childEdges) {
-                auto ce = childEdge.lock();
-                if (!ce)
-                    IE_THROW() << "Node " << inputNodePtr->getName() << " contains empty child edge";
-
-                auto& child = ce->getChild();
-
-                if (child->isConstant()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->getType() == Type::Concatenation) {
-                    auto concat = dynamic_cast<node::Concat*>(child.get());
-                    if (concat && concat->isOptimized()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                // Cannot be in-place before split because split is using different ptrs without offsets
-                if (child->getType() == Type::Split) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                if (child->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& edges = child->getChildEdges();
-                for (auto& edge : edges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << child->getName() << " contains empty child edge";
-
-                    if (e->getMemory().GetData() == ce->getMemory().GetData()) {
-                        canBeInPlace = false;
-                        break;
-                    }
-                }
-
-                if (!canBeInPlace)
-                    break;
-            }
-            if (canBeInPlace) {
+            if (Graph::canUseExternalMemory(inputNodePtr)) {
                 for (auto& edge : childEdges) {
                     auto e = edge.lock();
                     if (!e)
@@ -277,31 +267,7 @@ void InferRequestBase::changeDefaultPtr() {
             if (parentEdge->getMemory().GetData() == it.second)
                 continue;
 
-            bool canBeInPlace = true;
-            void* defaultPtr = parentEdge->getMemory().GetData();
-            // Cannot be in-place after concat because concat is using different ptrs without offsets
-            auto parent = parentEdge->getParent();
-            NodePtr previousParent;
-            do {
-                previousParent = parent;
-                if (parent->getChildEdges().size() != 1 || parent->isConstant() || parent->isInPlace()) {
-                    canBeInPlace = false;
-                    break;
-                }
-
-                auto& parentEdges = parent->getParentEdges();
-                for (auto& edge : parentEdges) {
-                    auto e = edge.lock();
-                    if (!e)
-                        IE_THROW() << "Node " << parent->getName() << " contains empty parent edge";
-
-                    if (e->getMemory().GetData() == defaultPtr) {
-                        parent = e->getParent();
-                        break;
-                    }
-                }
-            } while (previousParent != parent);
-            if (canBeInPlace)
+            if (Graph::canUseExternalMemory(parentEdge))
                 changeEdgePtr(parentEdge, it.second);
             continue;
         }
@@ -506,8 +472,7 @@ InferenceEngine::Blob::Ptr LegacyInferRequest::GetBlob(const std::string& name)
                 desc = InferenceEngine::TensorDesc(p, dims, l);
             }
 
-            _inputs[name] = make_blob_with_precision(desc);
-            _inputs[name]->allocate();
+            _inputs[name] = createBlob(desc);
             if (pBlobDesc == desc &&
                 graph->_normalizePreprocMap.find(name) == graph->_normalizePreprocMap.end() && !graph->getProperty().batchLimit) {
                 externalPtr[name] = _inputs[name]->buffer();
@@ -548,8 +513,7 @@ InferenceEngine::Blob::Ptr LegacyInferRequest::GetBlob(const std::string& name)
                 auto currBlockDesc = InferenceEngine::BlockingDesc(desc.getBlockingDesc().getBlockDims(), desc.getBlockingDesc().getOrder());
                 desc = InferenceEngine::TensorDesc(desc.getPrecision(), desc.getDims(), currBlockDesc);
 
-                data = make_blob_with_precision(desc);
-                data->allocate();
+                data = createBlob(desc);
             } else {
                 const auto& expectedTensorDesc = pBlobDesc;
 
@@ -779,8 +743,7 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                 InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(inputNode->second->get_output_element_type(0)),
                                                  dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                _inputs[name] = make_blob_with_precision(desc);
-                _inputs[name]->allocate();
+                _inputs[name] = createBlob(desc);
 
                 if (!isDynamic &&
                     desc == MemoryDescUtils::convertToTensorDesc(graph->getInputNodeByName(name)->getChildEdgesAtPort(0)[0]->getMemory().getDesc()) &&
@@ -814,8 +777,7 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                     InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(outputNode->second->get_input_element_type(0)),
                                                      dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                    data = make_blob_with_precision(desc);
-                    data->allocate();
+                    data = createBlob(desc);
                 } else {
                     const auto& blobDims = data->getTensorDesc().getDims();
                     // in static shape case is enough information that shapes are incompatible to throw exception
@@ -14,6 +14,7 @@ namespace ov {
 namespace intel_cpu {
 
 class ExecNetwork;
+class VariableState;
 class AsyncInferRequest;
 
 class InferRequestBase : public InferenceEngine::IInferRequestInternal {
@@ -37,6 +38,13 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief Returns the NUMA node the request is bound to, negative value if the request isn't bound
+     */
+    int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
 protected:
     InferRequestBase(InferenceEngine::InputsDataMap networkInputs,
                      InferenceEngine::OutputsDataMap networkOutputs,
@@ -55,12 +63,18 @@ protected:
     virtual void initBlobs() = 0;
     virtual void PushInputData() = 0;
 
+    /**
+     * @brief Creates and allocates the request blob, the memory is placed on the NUMA node of the request if it's bound
+     */
+    InferenceEngine::Blob::Ptr createBlob(const InferenceEngine::TensorDesc& desc) const;
+
     Graph* graph = nullptr;
     std::unordered_map<std::string, void*> externalPtr;
 
 private:
     void PushStates();
     void PullStates();
+    std::shared_ptr<VariableState> findState(const std::string& id) const;
     void redefineMemoryForInputNodes();
 
     void changeDefaultPtr();
@@ -68,6 +82,8 @@ private:
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     AsyncInferRequest*                  _asyncRequest = nullptr;
+    int                                 numaNodeId = -1;
+    std::shared_ptr<InferenceEngine::IAllocator> blobAllocator;
 };
 
 class LegacyInferRequest : public InferRequestBase {
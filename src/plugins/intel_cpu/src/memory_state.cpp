@@ -11,10 +11,38 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 
+void* VariableStateAllocator::alloc(size_t size) noexcept {
+    // the buffers are allocated already, the handle is not used by lock()
+    return size <= buffers[current]->GetSize() ? buffers[current]->GetData() : nullptr;
+}
+
+VariableState::VariableState(std::string name, MemoryPtr storage)
+    : InferenceEngine::IVariableStateInternal{name} {
+    MemoryPtr buffers[2];
+    for (auto& buffer : buffers) {
+        buffer = std::make_shared<Memory>(storage->getEngine());
+        buffer->Create(storage->getDescPtr());
+    }
+    cpu_memcpy(buffers[0]->GetData(), storage->GetData(), storage->GetSize());
+    allocator = std::make_shared<VariableStateAllocator>(buffers[0], buffers[1]);
+    state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()), allocator);
+    state->allocate();
+}
+
 void VariableState::Reset() {
     std::memset(state->buffer(), 0, state->byteSize());
 }
 
+void VariableState::SetState(const Blob::Ptr& newState) {
+    if (newState->byteSize() != state->byteSize())
+        IE_THROW() << "Variable state " << name << " can't be set: expected " << state->byteSize()
+                   << " bytes, but the new state has " << newState->byteSize() << " bytes";
+    cpu_memcpy(state->buffer(), newState->cbuffer(), newState->byteSize());
+}
+
+void VariableState::commit() {
+    allocator->swap();
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
-
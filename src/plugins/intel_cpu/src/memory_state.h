@@ -15,16 +15,75 @@
 namespace ov {
 namespace intel_cpu {
 
-class VariableState : public InferenceEngine::IVariableStateInternal {
+/**
+ * @brief Blob allocator which maps the blob to the current buffer of the variable state, so the blob
+ * reads the new state after the buffers are swapped. The buffers are owned by the allocator and stay
+ * alive as long as the blob is used.
+ */
+class VariableStateAllocator : public InferenceEngine::IAllocator {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->GetData(), storage->GetSize());
+    VariableStateAllocator(MemoryPtr first, MemoryPtr second) : buffers{std::move(first), std::move(second)} {}
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return buffers[current]->GetData();
+    }
+    void unlock(void* handle) noexcept override {}
+    void* alloc(size_t size) noexcept override;
+    bool free(void* handle) noexcept override {
+        return false;
+    }
+
+    const MemoryPtr& getCurrent() const {
+        return buffers[current];
     }
+    const MemoryPtr& getNext() const {
+        return buffers[current ^ 1];
+    }
+    void swap() {
+        current ^= 1;
+    }
+
+private:
+    MemoryPtr buffers[2];
+    size_t current = 0;
+};
+
+/**
+ * @brief Variable state with two buffers of the same layout.
+ * ReadValue reads the current buffer and Assign writes the other one, so instead of copying
+ * the new value into the state after the inference the buffers are swapped by commit().
+ * The blob returned by GetState() is bound to the current buffer, so the blob obtained before
+ * the inference reads the new state after it. A raw pointer taken from the blob addresses the
+ * buffer which was current at that moment, it has to be taken again after the inference.
+ */
+class VariableState : public InferenceEngine::IVariableStateInternal {
+public:
+    VariableState(std::string name, MemoryPtr storage);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+
+    /**
+     * @brief Memory read by ReadValue in the next inference
+     */
+    const MemoryPtr& getInputMemory() const {
+        return allocator->getCurrent();
+    }
+
+    /**
+     * @brief Memory written by Assign in the next inference
+     */
+    const MemoryPtr& getOutputMemory() const {
+        return allocator->getNext();
+    }
+
+    /**
+     * @brief Makes the value written by Assign the current state
+     */
+    void commit();
+
+private:
+    std::shared_ptr<VariableStateAllocator> allocator;
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_parallel.hpp>
+#include <ngraph/pass/constant_folding.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Lets ConstantFolding evaluate the independent constant subgraphs and the large
+ *        tensors on the threading of the plugin.
+ */
+inline ngraph::pass::ConstantFolding::ParallelExecutor constantFoldingExecutor() {
+    return [](size_t count, const std::function<void(size_t)>& body) {
+        InferenceEngine::parallel_for(count, body);
+    };
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
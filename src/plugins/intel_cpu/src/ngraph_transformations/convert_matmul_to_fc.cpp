@@ -8,13 +8,91 @@
 #include <ngraph/rt_info.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <transformations/utils/utils.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 
 #include "itt.hpp"
 
+namespace {
+
+// Weights-only compressed weights kept by MarkMatMulWeightsDecompression:
+//   Constant -> Convert -> [Subtract] -> Multiply -> [Reshape]
+struct WeightsDecompression {
+    std::shared_ptr<ngraph::opset1::Constant> weights;
+    std::shared_ptr<ngraph::Node> convert;
+    std::shared_ptr<ngraph::opset1::Constant> zero_point;
+    std::shared_ptr<ngraph::opset1::Constant> scale;
+    std::shared_ptr<ngraph::Node> reshape;
+};
+
+bool getWeightsDecompression(const ngraph::Output<ngraph::Node>& output, WeightsDecompression& decompression) {
+    auto node = output.get_node_shared_ptr();
+    if (ngraph::is_type<ngraph::opset1::Reshape>(node)) {
+        decompression.reshape = node;
+        node = node->get_input_node_shared_ptr(0);
+    }
+    if (!ngraph::is_type<ngraph::opset1::Multiply>(node))
+        return false;
+    decompression.scale = ngraph::as_type_ptr<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1));
+    node = node->get_input_node_shared_ptr(0);
+    if (ngraph::is_type<ngraph::opset1::Subtract>(node)) {
+        decompression.zero_point = ngraph::as_type_ptr<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(1));
+        if (!decompression.zero_point)
+            return false;
+        node = node->get_input_node_shared_ptr(0);
+    }
+    if (!ngraph::is_type<ngraph::opset1::Convert>(node) || !ov::pass::constant_folding_is_disabled(node))
+        return false;
+    decompression.convert = node;
+    decompression.weights = ngraph::as_type_ptr<ngraph::opset1::Constant>(node->get_input_node_shared_ptr(0));
+    return decompression.weights && decompression.scale;
+}
+
+// Decompression is elementwise, so instead of transposing the decompressed weights
+// every constant of the subgraph is transposed and the subgraph is rebuilt on top of them.
+// [K, N] weights are transposed to [N, K], grouped [G, K / G, N] weights to [N, G, K / G].
+ngraph::Output<ngraph::Node> transposeWeightsDecompression(const WeightsDecompression& decompression, ngraph::NodeVector& new_ops) {
+    const auto rank = decompression.weights->get_shape().size();
+    std::vector<size_t> order(rank);
+    std::iota(order.begin() + 1, order.end(), 0);
+    order[0] = rank - 1;
+    auto order_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ order.size() }, order);
+
+    auto transpose = [&](const std::shared_ptr<ngraph::opset1::Constant>& constant) {
+        ngraph::Output<ngraph::Node> aligned = constant;
+        auto shape = constant->get_shape();
+        if (shape.size() < rank) {
+            shape.insert(shape.begin(), rank - shape.size(), 1);
+            auto shape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ rank }, shape);
+            aligned = ngraph::op::util::make_try_fold<ngraph::opset1::Reshape>(aligned, shape_const, false);
+        }
+        return ngraph::op::util::make_try_fold<ngraph::opset1::Transpose>(aligned, order_const);
+    };
+
+    auto convert = decompression.convert->clone_with_new_inputs({ transpose(decompression.weights) });
+    ov::disable_constant_folding(convert);
+    new_ops.push_back(convert);
+    ngraph::Output<ngraph::Node> result = convert;
+    if (decompression.zero_point) {
+        result = std::make_shared<ngraph::opset1::Subtract>(result, transpose(decompression.zero_point));
+        new_ops.push_back(result.get_node_shared_ptr());
+    }
+    result = std::make_shared<ngraph::opset1::Multiply>(result, transpose(decompression.scale));
+    new_ops.push_back(result.get_node_shared_ptr());
+    if (decompression.reshape) {
+        const auto& reshaped = decompression.reshape->get_output_shape(0);
+        auto shape_const = ngraph::opset1::Constant::create(ngraph::element::i64, ngraph::Shape{ 2 }, { reshaped[1], reshaped[0] });
+        result = std::make_shared<ngraph::opset1::Reshape>(result, shape_const, false);
+        new_ops.push_back(result.get_node_shared_ptr());
+    }
+    return result;
+}
+
+}   // namespace
+
 ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
     MATCHER_SCOPE(ConvertMatMulToFC);
     auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
-    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>();
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant, ngraph::opset1::Multiply, ngraph::opset1::Reshape>();
     auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({ activations_m, weights_m }, ngraph::pattern::has_static_rank());
 
     ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
@@ -45,8 +123,12 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Check that if second inputs is Constant path and it's shape without ones dimensions has length <= 2
         // we replace MatMul with FullyConnected operation.
-        if (!std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr()) ||
-            std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
+        WeightsDecompression decompression;
+        const bool is_decompressed = !std::dynamic_pointer_cast<ngraph::opset1::Constant>(fc_input_b.get_node_shared_ptr());
+        if (is_decompressed && (!getWeightsDecompression(fc_input_b, decompression) || rank_b != 2)) {
+            return false;
+        }
+        if (std::count_if(shape_b.begin(), shape_b.end(), [](ngraph::Dimension x) { return x != 1; }) > 2) {
             return false;
         }
         /*
@@ -136,8 +218,12 @@ ov::intel_cpu::ConvertMatMulToFC::ConvertMatMulToFC() {
 
         // Weights normalization
         if (!matmul->get_transpose_b()) {
-            fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
-            new_ops.push_back(fc_input_b.get_node_shared_ptr());
+            if (is_decompressed) {
+                fc_input_b = transposeWeightsDecompression(decompression, new_ops);
+            } else {
+                fc_input_b = create_transpose(fc_input_b, matmul->get_friendly_name() + "/transpose_b");
+                new_ops.push_back(fc_input_b.get_node_shared_ptr());
+            }
         }
 
         if (rank_b != 2) {
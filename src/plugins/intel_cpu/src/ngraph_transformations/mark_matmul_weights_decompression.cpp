@@ -0,0 +1,82 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "mark_matmul_weights_decompression.hpp"
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/pattern/op/or.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
+#include "snippets/pass/collapse_subgraph.hpp"
+
+#include "itt.hpp"
+
+ov::intel_cpu::MarkMatMulWeightsDecompression::MarkMatMulWeightsDecompression() {
+    MATCHER_SCOPE(MarkMatMulWeightsDecompression);
+    const ngraph::element::TypeVector weights_precisions{ngraph::element::u8, ngraph::element::i8,
+                                                         ngraph::element::u4, ngraph::element::i4};
+    auto weights_m = ngraph::pattern::wrap_type<ngraph::opset1::Constant>(ngraph::pattern::type_matches_any(weights_precisions));
+    auto convert_m = ngraph::pattern::wrap_type<ngraph::opset1::Convert>({weights_m}, ngraph::pattern::consumers_count(1));
+    auto zero_point_m = ngraph::pattern::any_input();
+    auto subtract_m = ngraph::pattern::wrap_type<ngraph::opset1::Subtract>({convert_m, zero_point_m}, ngraph::pattern::consumers_count(1));
+    auto scale_input_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{subtract_m, convert_m});
+    auto scale_m = ngraph::pattern::any_input();
+    auto multiply_m = ngraph::pattern::wrap_type<ngraph::opset1::Multiply>({scale_input_m, scale_m}, ngraph::pattern::consumers_count(1));
+    auto reshape_m = ngraph::pattern::wrap_type<ngraph::opset1::Reshape>({multiply_m, ngraph::pattern::wrap_type<ngraph::opset1::Constant>()},
+                                                                         ngraph::pattern::consumers_count(1));
+    auto matmul_weights_m = std::make_shared<ngraph::pattern::op::Or>(ngraph::OutputVector{reshape_m, multiply_m});
+    auto activations_m = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto matmul_m = ngraph::pattern::wrap_type<ngraph::opset1::MatMul>({activations_m, matmul_weights_m});
+
+    ngraph::matcher_pass_callback callback = [=](ngraph::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+
+        // zero point and scale are expected to be constant folded later on
+        auto is_constant = [](const ngraph::Output<ngraph::Node>& output) {
+            auto node = output.get_node();
+            if (ngraph::is_type<ngraph::opset1::Convert>(node))
+                node = node->get_input_node_ptr(0);
+            return ngraph::is_type<ngraph::opset1::Constant>(node);
+        };
+        if (!is_constant(pattern_map.at(scale_m)))
+            return false;
+        auto zero_point = pattern_map.find(zero_point_m);
+        if (zero_point != pattern_map.end() && !is_constant(zero_point->second))
+            return false;
+
+        // the same restrictions as in ConvertMatMulToFC: weights must become a 2D FullyConnected input,
+        // per-group compressed weights are stored as 3D constant which is reshaped to 2D right before MatMul
+        const auto activations_rank = pattern_map.at(activations_m).get_partial_shape().rank().get_length();
+        if (activations_rank != 2 && activations_rank != 3)
+            return false;
+        const auto weights_rank = pattern_map.at(weights_m).get_shape().size();
+        const bool has_reshape = pattern_map.count(reshape_m) != 0;
+        if (has_reshape) {
+            const auto matmul = std::dynamic_pointer_cast<ngraph::opset1::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+            const auto& reshaped = pattern_map.at(reshape_m).get_partial_shape();
+            if (!matmul || weights_rank != 3 || reshaped.is_dynamic() || reshaped.size() != 2)
+                return false;
+            // only the input channels may be split into groups
+            const auto& shape = pattern_map.at(weights_m).get_shape();
+            const auto grouped = matmul->get_transpose_b() ? ngraph::Shape{shape[0], shape[1] * shape[2]}
+                                                           : ngraph::Shape{shape[0] * shape[1], shape[2]};
+            if (reshaped.to_shape() != grouped)
+                return false;
+        } else if (weights_rank != 2) {
+            return false;
+        }
+
+        ov::disable_constant_folding(pattern_map.at(convert_m).get_node_shared_ptr());
+        // the subgraph is fused into FullyConnected, so it must not be tokenized as well
+        for (const auto& pattern : {subtract_m, multiply_m, reshape_m}) {
+            auto it = pattern_map.find(pattern);
+            if (it != pattern_map.end())
+                ngraph::snippets::pass::SetSnippetsNodeType(it->second.get_node_shared_ptr(),
+                                                            ngraph::snippets::pass::SnippetsNodeType::SkippedByPlugin);
+        }
+        return false;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(matmul_m, matcher_name);
+    this->register_matcher(m, callback);
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Keeps weights-only compressed MatMul weights in low precision.
+ * Matches the decompression subgraph produced by compress_quantize_weights and NNCF
+ *
+ *    Constant [u8/i8/u4/i4]
+ *       |
+ *    Convert    zero point
+ *        \       /
+ *        [Subtract]   scale
+ *             \       /
+ *             Multiply
+ *                |
+ *           [Reshape]
+ *                |
+ *     MatMul (second input)
+ *
+ * and disables constant folding of the Convert, so the subgraph reaches the CPU graph where
+ * FullyConnected decompresses the weights on the fly instead of keeping them in fp32.
+ */
+class MarkMatMulWeightsDecompression: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MarkMatMulWeightsDecompression", "0");
+    MarkMatMulWeightsDecompression();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
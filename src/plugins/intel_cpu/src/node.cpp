@@ -116,7 +116,10 @@ Node::Node(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, Wei
                 std::any_of(outputShapes.begin(), outputShapes.end(), [](const Shape& shape){ return shape.isDynamic(); });
 
     if (isDynamic) {
-        shapeInference = make_shape_inference(op);
+        // the same input shapes recur often (e.g. a few sequence lengths), so the inferred shapes are remembered
+        constexpr size_t shapeInferCacheCapacity = 16;
+        shapeInferCache = std::make_shared<MemoizedShapeInfer>(make_shape_inference(op), shapeInferCacheCapacity);
+        shapeInference = shapeInferCache;
     }
 
     const auto& rtInfo = op->get_rt_info();
@@ -758,10 +761,10 @@ void Node::prepareMemory(const std::vector<DnnlMemoryDescPtr>& intDescs) {
     for (size_t i = 0; i < internalBlobs.size(); i++) {
         const auto &internalBlob = internalBlobs[i];
 
-        auto create = [&] () {
-            // TODO [DS]: internal blobs should be removed or rewritten using Memory object
-            auto newDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
+        // TODO [DS]: internal blobs should be removed or rewritten using Memory object
+        auto newDesc = MemoryDescUtils::convertToDnnlBlockedMemoryDesc(internalBlob->getTensorDesc());
 
+        auto create = [&] () {
             Memory memory{ engine };
             memory.Create(newDesc, internalBlob->buffer());
 
@@ -781,7 +784,10 @@ void Node::prepareMemory(const std::vector<DnnlMemoryDescPtr>& intDescs) {
                                             + "_" + std::to_string(internalBlob->byteSize())
                                             + "_" + std::to_string(data_hash);
 
-            ptr = *weightCache->findOrCreate(string_hash, create);
+            ptr = weightCache->findOrCreateConstant(string_hash,
+                                                    std::shared_ptr<const void>(internalBlob, internalBlob->cbuffer().as<const void*>()),
+                                                    internalBlob->byteSize(),
+                                                    std::make_shared<DnnlBlockedMemoryDesc>(newDesc), intDescs[i], create);
         } else {
             ptr = create();
         }
@@ -1496,11 +1502,36 @@ std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<StaticShape>&
         return s.to_shape();
     });
 
+    if (shapeInferCache)
+        shapeInferCache->store(result);
+
     return result;
 }
 
+const std::vector<VectorDims>* Node::findShapeInferResult(uint32_t input_value_port_mask) const {
+    // the input dims are expected to be already appended to the key
+    if (input_value_port_mask) {
+        const auto& iranks = shapeInferCache->get_input_ranks();
+        for (size_t port = 0; port < iranks.size(); port++) {
+            if (input_value_port_mask & (1 << port)) {
+                const auto& memPtr = getParentEdgesAtPort(port)[0]->getMemory();
+                shapeInferCache->appendData(memPtr.GetPtr(), memPtr.GetSize());
+            }
+        }
+    }
+    return shapeInferCache->find();
+}
+
 std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<Shape>& shapes,
                                                       uint32_t input_value_port_mask) const {
+    if (shapeInferCache) {
+        shapeInferCache->resetKey();
+        for (const auto& shape : shapes)
+            shapeInferCache->appendDims(shape.getStaticDims());
+        if (auto cached = findShapeInferResult(input_value_port_mask))
+            return *cached;
+    }
+
     std::vector<StaticShape> input_shapes;
 
     input_shapes.reserve(shapes.size());
@@ -1511,9 +1542,19 @@ std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<Shape>& shapes
 }
 
 std::vector<VectorDims> Node::shapeInferGeneric(uint32_t input_value_port_mask) const {
-    std::vector<StaticShape> input_shapes;
     const auto & iranks = shapeInference->get_input_ranks();
 
+    if (shapeInferCache) {
+        // fast path: the key is built right from the input memory, no shapes and host tensors are created on hit
+        shapeInferCache->resetKey();
+        for (size_t port = 0; port < iranks.size(); port++)
+            shapeInferCache->appendDims(getParentEdgesAtPort(port)[0]->getMemory().getStaticDims());
+        if (auto cached = findShapeInferResult(input_value_port_mask))
+            return *cached;
+    }
+
+    std::vector<StaticShape> input_shapes;
+
     input_shapes.reserve(iranks.size());
 
     for (size_t port = 0; port < iranks.size(); port++) {
@@ -35,6 +35,7 @@
 
 #include <utils/shape_inference/static_shape.hpp>
 #include <utils/shape_inference/shape_inference.hpp>
+#include <utils/shape_inference/memoized_shape_inference.hpp>
 #include "utils/debug_capabilities.h"
 
 #include "dnnl_postops_composer.h"
@@ -731,6 +732,8 @@ protected:
     std::vector<VectorDims> lastInputDims = {};
 
     std::shared_ptr<IShapeInfer> shapeInference;
+    // the same object as shapeInference when the output shapes of the recently seen inputs are memoized
+    std::shared_ptr<MemoizedShapeInfer> shapeInferCache;
 
     std::shared_ptr<std::mutex> sharedMutex = nullptr;
 
@@ -781,6 +784,7 @@ private:
 
     std::vector<VectorDims> shapeInferGeneric(const std::vector<StaticShape>& input_shapes,
                                               uint32_t input_value_port_mask) const;
+    const std::vector<VectorDims>* findShapeInferResult(uint32_t input_value_port_mask) const;
 
 #ifdef CPU_DEBUG_CAPS
     friend class Verbose;
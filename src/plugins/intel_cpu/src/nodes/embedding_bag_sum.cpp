@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
@@ -10,6 +11,8 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
+#include "utils/general_utils.h"
 
 using namespace InferenceEngine;
 
@@ -39,11 +42,80 @@ EmbeddingBagSum::EmbeddingBagSum(
     }
 }
 
-void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
+bool EmbeddingBagSum::isJitSupported() {
+    return mayiuse(cpu::x64::avx2);
+}
+
+impl_desc_type EmbeddingBagSum::getImplType(const InferenceEngine::Precision& tablePrecision) {
+    if (!isJitSupported() || !one_of(tablePrecision, Precision::FP32, Precision::BF16))
+        return impl_desc_type::ref_any;
+    return mayiuse(cpu::x64::avx512_core) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+}
+
+void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& tablePrecision,
+                                    size_t outputBagsNum) {
     _embDepth = 1lu;
     for (size_t i = 1lu; i < indexStaticShape.size(); i++) {
         _embDepth *= indexStaticShape[i];
     }
+
+    _bagsCost.resize(outputBagsNum + 1);
+    _bagsSplit = false;
+
+    if (_kernel || !isJitSupported() || !one_of(tablePrecision, Precision::FP32, Precision::BF16))
+        return;
+
+    jit_emb_bag_config jcp;
+    jcp.with_weights = _withWeights;
+
+    _tableTypeSize = tablePrecision.size();
+    if (mayiuse(cpu::x64::avx512_core)) {
+        if (tablePrecision == Precision::BF16)
+            _kernel.reset(new jit_emb_bag_kernel_impl<bfloat16_t[16]>(jcp));
+        else
+            _kernel.reset(new jit_emb_bag_kernel_impl<float[16]>(jcp));
+    } else {
+        if (tablePrecision == Precision::BF16)
+            _kernel.reset(new jit_emb_bag_kernel_impl<bfloat16_t[8]>(jcp));
+        else
+            _kernel.reset(new jit_emb_bag_kernel_impl<float[8]>(jcp));
+    }
+    _kernel->init();
+}
+
+void EmbeddingBagSum::splitEqualBags(size_t bagSize) {
+    for (size_t obi = 0; obi < _bagsCost.size(); obi++)
+        _bagsCost[obi] = obi * (bagSize + 1lu);
+    _bagsSplit = true;
+}
+
+void EmbeddingBagSum::splitBags() {
+    if (_bagsSplit)
+        return;
+
+    const size_t outputBagsNum = _bagsCost.size() - 1;
+    _bagsCost[0] = 0;
+
+    size_t indicesSize = 0lu;
+    const int* indices = nullptr;
+    int weightsIdx = 0;
+    bool withWeights = _withWeights;
+    for (size_t obi = 0; obi < outputBagsNum; obi++) {
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+        // an empty bag still has to be written
+        _bagsCost[obi + 1] = _bagsCost[obi] + (indices != nullptr ? indicesSize : 0lu) + 1lu;
+    }
+}
+
+void EmbeddingBagSum::getThreadBags(int ithr, int nthr, size_t& start, size_t& end) const {
+    const size_t totalCost = _bagsCost.back();
+    auto findBag = [&](int thr) {
+        const size_t cost = totalCost * thr / nthr;
+        return static_cast<size_t>(std::lower_bound(_bagsCost.begin(), _bagsCost.end(), cost) - _bagsCost.begin());
+    };
+    const size_t bagsNum = _bagsCost.size() - 1;
+    start = std::min(findBag(ithr), bagsNum);
+    end = ithr == nthr - 1 ? bagsNum : std::min(findBag(ithr + 1), bagsNum);
 }
 
 template<typename T>
@@ -53,12 +125,13 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
 
     initFromInputs();
 
-    const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
     auto *dstData = reinterpret_cast<T *>(outMemory->GetPtr());
 
+    splitBags();
+
     auto threadBody = [&](const int ithr, const int nthr) {
         size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+        getThreadBags(ithr, nthr, start, end);
         if (start >= end)
             return;
 
@@ -119,8 +192,93 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
     parallel_nt(0, threadBody);
 }
 
+void EmbeddingBagSum::processDataJit(const uint8_t* srcData, const uint8_t* weightsData,
+                                     const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    auto *dstData = reinterpret_cast<float *>(outMemory->GetPtr());
+
+    const size_t srcTypeSize = _tableTypeSize;
+    const size_t simd = _kernel->simd_size();
+    const size_t workAmount = _embDepth / simd;
+    const size_t tailStart = workAmount * simd;
+
+    auto loadValue = [&](const uint8_t* ptr, size_t idx) {
+        if (srcTypeSize == sizeof(float))
+            return reinterpret_cast<const float*>(ptr)[idx];
+        return static_cast<float>(reinterpret_cast<const bfloat16_t*>(ptr)[idx]);
+    };
+
+    splitBags();
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        getThreadBags(ithr, nthr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0;
+        bool withWeights = _withWeights;
+
+        for (size_t obi = start; obi < end; obi++) {
+            float* dst = dstData + obi * _embDepth;
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            if (indices == nullptr)
+                indicesSize = 0lu;
+
+            for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                if (indices[inIdx] < 0 || static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                }
+            }
+
+            // the default index bag is not weighted, so the weights are passed only for the regular bags
+            const uint8_t* weights = withWeights && _withWeights ? weightsData + weightsIdx * srcTypeSize : nullptr;
+            if (_withWeights && !weights) {
+                // the kernel is generated with weights, so the unweighted bag is processed by the scalar code
+                for (size_t i = 0lu; i < _embDepth; i++) {
+                    float acc = 0.f;
+                    for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++)
+                        acc += loadValue(srcData, indices[inIdx] * _embDepth + i);
+                    dst[i] = acc;
+                }
+                continue;
+            }
+
+            jit_emb_bag_args args;
+            args.src = srcData;
+            args.indices = indices;
+            args.weights = weights;
+            args.dst = dst;
+            args.indices_num = indicesSize;
+            args.row_stride = _embDepth * srcTypeSize;
+            args.work_amount = workAmount;
+            (*_kernel)(&args);
+
+            for (size_t i = tailStart; i < _embDepth; i++) {
+                float acc = 0.f;
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
+                    const float weight = weights ? loadValue(weights, inIdx) : 1.f;
+                    acc += loadValue(srcData, indices[inIdx] * _embDepth + i) * weight;
+                }
+                dst[i] = acc;
+            }
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory) {
+    if (_kernel && one_of(srcPrc, Precision::FP32, Precision::BF16)) {
+        return processDataJit(srcData, weightsData, inDims, outMemory);
+    }
+
     switch (srcPrc) {
         case Precision::FP32: {
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
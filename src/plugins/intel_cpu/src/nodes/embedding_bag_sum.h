@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <node.h>
+#include "kernels/embedding_bag_kernel.hpp"
 #include <string>
 #include <memory>
 #include <vector>
@@ -28,6 +29,10 @@ public:
 
     ~EmbeddingBagSum() = default;
 
+    // fp32 and bf16 tables are processed by the jit kernel, bf16 tables are accumulated in fp32
+    static bool isJitSupported();
+    static impl_desc_type getImplType(const InferenceEngine::Precision& tablePrecision);
+
 protected:
     virtual void initFromInputs() = 0;
     virtual void getIndices(
@@ -37,12 +42,22 @@ protected:
             int& weightsIdx,
             bool& withWeights) = 0;
 
-    void prepareParams(const VectorDims& indexStaticShape);
+    void prepareParams(const VectorDims& indexStaticShape, const InferenceEngine::Precision& tablePrecision,
+                       size_t outputBagsNum);
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
                      const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
 
+    void processDataJit(const uint8_t* srcData, const uint8_t* weightsData,
+                        const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+
+    // splits the bags between the threads by the number of the gathered rows, so the uneven bags are balanced
+    void splitBags();
+    // the bags of the same size are split once on the params preparation instead of each execution
+    void splitEqualBags(size_t bagSize);
+    void getThreadBags(int ithr, int nthr, size_t& start, size_t& end) const;
+
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
     const size_t PER_SAMPLE_WEIGHTS_IDX;
@@ -51,6 +66,11 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+
+    std::shared_ptr<jit_emb_bag_kernel> _kernel;
+    size_t _tableTypeSize = 0lu;
+    std::vector<size_t> _bagsCost;
+    bool _bagsSplit = false;
 };
 
 }   // namespace node
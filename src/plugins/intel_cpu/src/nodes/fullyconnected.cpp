@@ -11,6 +11,7 @@
 #include <ngraph/opsets/opset1.hpp>
 #include <string>
 #include <vector>
+#include <numeric>
 #include <dnnl_extension_utils.h>
 #include <onednn/dnnl.h>
 #include "utils/general_utils.h"
@@ -22,6 +23,7 @@
 #include <common/primitive_desc.hpp>
 #include <common/primitive_desc_iface.hpp>
 #include "onednn/dnnl.h"
+#include "ie_parallel.hpp"
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -81,6 +83,82 @@ bool FCKey::operator==(const FCKey &rhs) const {
     return retVal;
 }
 
+// output channels decompressed and accumulated together by the weights decompression kernel
+constexpr size_t decompressionBlock = 16;
+// input rows sharing the same decompressed weights
+constexpr size_t decompressionRows = 4;
+// the weights are decompressed on the fly only for the small number of input rows, the larger inputs reuse
+// each decompressed weight enough times to be executed faster by oneDNN gemm over the fp32 weights
+constexpr size_t decompressionMaxRows = 16;
+
+/*
+ * dst[M, N] = src[M, K] x (scale * weights + shift)^T
+ * The weights are stored in [N / decompressionBlock, K, decompressionBlock] layout and are decompressed on the fly.
+ * Scale and shift are constant within an input channels group, so the raw weights are accumulated over the group
+ * and the decompression is applied once per group: scale * sum(src * w) + shift * sum(src).
+ */
+template <typename T>
+void gemmWithWeightsDecompression(const float* src, const T* weights, const float* scales, const float* shifts,
+                                  const float* bias, float* dst, size_t M, size_t N, size_t K, size_t groups) {
+    const size_t NB = div_up(N, decompressionBlock);
+    const size_t NPadded = NB * decompressionBlock;
+    const size_t groupSize = K / groups;
+
+    parallel_for2d(div_up(M, decompressionRows), NB, [&](size_t mb, size_t nb) {
+        const size_t m0 = mb * decompressionRows;
+        const size_t rows = std::min(decompressionRows, M - m0);
+        const size_t n0 = nb * decompressionBlock;
+        const size_t channels = std::min(decompressionBlock, N - n0);
+        const T* w = weights + nb * K * decompressionBlock;
+
+        float acc[decompressionRows][decompressionBlock] = {};
+        for (size_t g = 0; g < groups; g++) {
+            float partial[decompressionRows][decompressionBlock] = {};
+            float srcSum[decompressionRows] = {};
+            for (size_t k = g * groupSize; k < (g + 1) * groupSize; k++) {
+                float wk[decompressionBlock];
+                for (size_t j = 0; j < decompressionBlock; j++)
+                    wk[j] = static_cast<float>(w[k * decompressionBlock + j]);
+                for (size_t m = 0; m < rows; m++) {
+                    const float x = src[(m0 + m) * K + k];
+                    srcSum[m] += x;
+                    for (size_t j = 0; j < decompressionBlock; j++)
+                        partial[m][j] += x * wk[j];
+                }
+            }
+
+            const float* scale = scales + g * NPadded + n0;
+            const float* shift = shifts + g * NPadded + n0;
+            for (size_t m = 0; m < rows; m++) {
+                for (size_t j = 0; j < decompressionBlock; j++)
+                    acc[m][j] += partial[m][j] * scale[j] + srcSum[m] * shift[j];
+            }
+        }
+
+        for (size_t m = 0; m < rows; m++) {
+            float* out = dst + (m0 + m) * N + n0;
+            for (size_t j = 0; j < channels; j++)
+                out[j] = bias ? acc[m][j] + bias[n0 + j] : acc[m][j];
+        }
+    });
+}
+
+/*
+ * dst[N, K] = scale * weights + shift, scale and shift are stored as in gemmWithWeightsDecompression
+ */
+template <typename T>
+void decompressWeights(const T* weights, const float* scales, const float* shifts, float* dst, size_t N, size_t K, size_t groups) {
+    const size_t NPadded = rnd_up(N, decompressionBlock);
+    const size_t groupSize = K / groups;
+
+    parallel_for2d(N, groups, [&](size_t n, size_t g) {
+        const float scale = scales[g * NPadded + n];
+        const float shift = shifts[g * NPadded + n];
+        for (size_t k = g * groupSize; k < (g + 1) * groupSize; k++)
+            dst[n * K + k] = scale * static_cast<float>(weights[n * K + k]) + shift;
+    });
+}
+
 } // namespace
 
 bool FullyConnected::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
@@ -172,6 +250,12 @@ void FullyConnected::getSupportedDescriptors() {
     if (getChildEdges().empty())
         IE_THROW()<< errorPrefix << " has incorrect number of output edges";
 
+    // weights-only compressed execution is implemented for fp32 activations, see initSupportedPrimitiveDescriptors
+    if (withWeightsDecompression()) {
+        outputDataType = memory::data_type::f32;
+        return;
+    }
+
     auto inputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalInputPrecisionAtPort(DATA_ID));
     outputDataType = DnnlExtensionUtils::IEPrecisionToDataType(getOriginalOutputPrecisionAtPort(DATA_ID));
 
@@ -212,6 +296,10 @@ void FullyConnected::getSupportedDescriptors() {
 }
 
 void FullyConnected::prepareParams() {
+    // weights-only compressed execution doesn't use oneDNN primitives
+    if (withWeightsDecompression())
+        return;
+
     auto srcMemPtr = getParentEdgesAtPort(0)[0]->getMemoryPtr();
     auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
     if (!dstMemPtr || !dstMemPtr->isAllocated())
@@ -383,6 +471,11 @@ void FullyConnected::prepareParams() {
 }
 
 void FullyConnected::setDynamicBatchLim(int lim) {
+    if (withWeightsDecompression()) {
+        Node::setDynamicBatchLim(lim);
+        return;
+    }
+
     if (!execPtr) {
         IE_THROW() << "Can't set dynamic batch for FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -414,6 +507,11 @@ void FullyConnected::setDynamicBatchLim(int lim) {
 }
 
 void FullyConnected::execute(dnnl::stream strm) {
+    if (withWeightsDecompression()) {
+        executeWeightsDecompression();
+        return;
+    }
+
     if (!execPtr) {
         IE_THROW() << "Can't execute FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -443,6 +541,10 @@ void FullyConnected::executeDynamicImpl(dnnl::stream strm) {
 }
 
 bool FullyConnected::canFuse(const NodePtr& node) const {
+    // the weights decompression kernel doesn't support post ops
+    if (withWeightsDecompression())
+        return false;
+
     return canFuseSimpleOperation(node);
 }
 
@@ -619,6 +721,15 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (withWeightsDecompression()) {
+        std::vector<PortConfigurator> inConfs = {{LayoutType::ncsp, Precision::FP32},
+                                                 {LayoutType::ncsp, getOriginalInputPrecisionAtPort(WEIGHTS_ID)}};
+        if (withBiases)
+            inConfs.emplace_back(LayoutType::ncsp, Precision::FP32);
+        addSupportedPrimDesc(inConfs, {{LayoutType::ncsp, Precision::FP32}}, impl_desc_type::gemm_any);
+        return;
+    }
+
     for (auto& desc : descs) {
         auto itpd = desc.createPrimitiveDescriptorIterator(getEngine());
         while (static_cast<bool>(itpd)) {
@@ -709,6 +820,10 @@ InferenceEngine::Precision FullyConnected::getRuntimePrecision() const {
 }
 
 void FullyConnected::initOptimalPrimitiveDescriptor() {
+    // plain descriptors of weights-only compressed execution are already final
+    if (withWeightsDecompression())
+        return;
+
     Node::initOptimalPrimitiveDescriptor();
     auto selectedPD = getSelectedPrimitiveDescriptor();
     implementationTypeIP = selectedPD->getImplementationType();
@@ -858,7 +973,8 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
                                             + "_" + std::to_string(blob->GetSize())
                                             + "_" + std::to_string(reinterpret_cast<uint64_t>(blob->GetData()));
 
-            ptr = *weightCache->findOrCreate(string_hash, create);
+            ptr = weightCache->findOrCreateConstant(string_hash, std::shared_ptr<const void>(blob, blob->GetData()),
+                                                    blob->GetSize(), blob->getDescPtr(), weightDesc, create);
         } else {
             ptr = create();
         }
@@ -868,6 +984,144 @@ MemoryPtr FullyConnected::prepareWeightMemory(DnnlMemoryDescPtr weightDesc) {
     return ptr;
 }
 
+bool FullyConnected::canUseWeightsDecompression() const {
+    // the dynamic inputs are checked again on execution, see executeWeightsDecompression
+    const auto& inMinDims = getInputShapeAtPort(DATA_ID).getMinDims();
+    const auto M = std::accumulate(inMinDims.begin(), inMinDims.end() - 1, size_t{1}, std::multiplies<size_t>());
+    return M <= decompressionMaxRows;
+}
+
+void FullyConnected::initWeightsDecompression(const std::vector<float>& scales, const std::vector<float>& shifts, size_t groups) {
+    const size_t OC = scales.size() / groups;
+    const size_t OCPadded = rnd_up(OC, decompressionBlock);
+    decompressionScales.assign(groups * OCPadded, 0.f);
+    decompressionShifts.assign(groups * OCPadded, 0.f);
+    for (size_t oc = 0; oc < OC; oc++) {
+        for (size_t g = 0; g < groups; g++) {
+            decompressionScales[g * OCPadded + oc] = scales[oc * groups + g];
+            decompressionShifts[g * OCPadded + oc] = shifts[oc * groups + g];
+        }
+    }
+    decompressionGroups = groups;
+}
+
+MemoryPtr FullyConnected::prepareDecompressionWeights() {
+    if (!getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant())
+        IE_THROW() << "Weight input is not const for node " << getName() << ".";
+    auto blob = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!blob)
+        IE_THROW() << "Cannot get const weights blob for node " << getName() << ".";
+
+    const auto& weightDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t OC = weightDims[0];
+    const size_t IC = weightDims[1];
+    const size_t OCPadded = rnd_up(OC, decompressionBlock);
+    const auto decompressionDesc = std::make_shared<CpuBlockedMemoryDesc>(blob->getDesc().getPrecision(), Shape(VectorDims{OCPadded * IC}));
+    auto create = [&] () {
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
+        _ptr->Create(decompressionDesc);
+
+        // u8 and i8 values are repacked byte-wise in the same way
+        auto src = static_cast<const uint8_t*>(blob->GetPtr());
+        auto dst = static_cast<uint8_t*>(_ptr->GetPtr());
+        parallel_for2d(OCPadded / decompressionBlock, IC, [&](size_t ocb, size_t ic) {
+            uint8_t* out = dst + (ocb * IC + ic) * decompressionBlock;
+            for (size_t j = 0; j < decompressionBlock; j++) {
+                const size_t oc = ocb * decompressionBlock + j;
+                out[j] = oc < OC ? src[oc * IC + ic] : 0;
+            }
+        });
+
+        return _ptr;
+    };
+
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_decompression"
+                                        + "_" + std::to_string(blob->GetSize())
+                                        + "_" + std::to_string(reinterpret_cast<uint64_t>(blob->GetData()));
+
+        return weightCache->findOrCreateConstant(string_hash, std::shared_ptr<const void>(blob, blob->GetData()),
+                                                 blob->GetSize(), blob->getDescPtr(), decompressionDesc, create);
+    }
+    return create();
+}
+
+MemoryPtr FullyConnected::prepareDecompressedWeights() {
+    auto blob = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    const auto& weightDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const size_t OC = weightDims[0];
+    const size_t IC = weightDims[1];
+    const auto decompressedDesc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(VectorDims{OC * IC}));
+    auto create = [&] () {
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine());
+        _ptr->Create(decompressedDesc);
+
+        auto dst = static_cast<float*>(_ptr->GetPtr());
+        if (blob->getDesc().getPrecision() == Precision::U8) {
+            decompressWeights(static_cast<const uint8_t*>(blob->GetPtr()), decompressionScales.data(),
+                              decompressionShifts.data(), dst, OC, IC, decompressionGroups);
+        } else {
+            decompressWeights(static_cast<const int8_t*>(blob->GetPtr()), decompressionScales.data(),
+                              decompressionShifts.data(), dst, OC, IC, decompressionGroups);
+        }
+
+        return _ptr;
+    };
+
+    if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_decompressed"
+                                        + "_" + std::to_string(blob->GetSize())
+                                        + "_" + std::to_string(reinterpret_cast<uint64_t>(blob->GetData()));
+
+        return weightCache->findOrCreateConstant(string_hash, std::shared_ptr<const void>(blob, blob->GetData()),
+                                                 blob->GetSize(), blob->getDescPtr(), decompressedDesc, create);
+    }
+    return create();
+}
+
+void FullyConnected::executeWeightsDecompression() {
+    auto srcMemPtr = getParentEdgesAtPort(DATA_ID)[0]->getMemoryPtr();
+    auto dstMemPtr = getChildEdgesAtPort(0)[0]->getMemoryPtr();
+    const auto& weightDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    const auto& srcDims = srcMemPtr->getStaticDims();
+    const size_t N = weightDims[0];
+    const size_t K = weightDims[1];
+    const size_t M = std::accumulate(srcDims.begin(), srcDims.end(), size_t{1}, std::multiplies<size_t>()) / K;
+
+    const auto src = reinterpret_cast<const float*>(srcMemPtr->GetPtr());
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgesAtPort(BIAS_ID)[0]->getMemoryPtr()->GetPtr()) : nullptr;
+    auto dst = reinterpret_cast<float*>(dstMemPtr->GetPtr());
+
+    if (M > decompressionMaxRows) {
+        // the weights are available only after the constant nodes have been executed
+        if (!decompressedWeights)
+            decompressedWeights = prepareDecompressedWeights();
+        if (bias) {
+            parallel_for(M, [&](size_t m) {
+                std::copy(bias, bias + N, dst + m * N);
+            });
+        }
+        // dst[M, N] = src[M, K] x weights[N, K]^T + dst
+        const auto status = dnnl_sgemm('N', 'T', M, N, K, 1.f, src, K,
+                                       reinterpret_cast<const float*>(decompressedWeights->GetPtr()), K,
+                                       bias ? 1.f : 0.f, dst, N);
+        if (status != dnnl_success)
+            IE_THROW() << errorPrefix << " failed to execute gemm with decompressed weights";
+        return;
+    }
+
+    if (!decompressionWeights)
+        decompressionWeights = prepareDecompressionWeights();
+
+    if (decompressionWeights->getDesc().getPrecision() == Precision::U8) {
+        gemmWithWeightsDecompression(src, reinterpret_cast<const uint8_t*>(decompressionWeights->GetPtr()),
+                                     decompressionScales.data(), decompressionShifts.data(), bias, dst, M, N, K, decompressionGroups);
+    } else {
+        gemmWithWeightsDecompression(src, reinterpret_cast<const int8_t*>(decompressionWeights->GetPtr()),
+                                     decompressionScales.data(), decompressionShifts.data(), bias, dst, M, N, K, decompressionGroups);
+    }
+}
+
 }   // namespace node
 }   // namespace intel_cpu
 }   // namespace ov
@@ -58,6 +58,23 @@ public:
 
     void setDynamicBatchLim(int lim) override;
 
+    /**
+     * @brief Switches the node to weights-only compressed execution: the u8/i8 weights input is decompressed
+     * on the fly as scale * w + shift, where scale and shift are given per output channel and input channels group
+     * @param scales decompression scales, [OC, groups] layout
+     * @param shifts decompression shifts (-zero_point * scale), [OC, groups] layout
+     * @param groups number of input channels groups
+     */
+    void initWeightsDecompression(const std::vector<float>& scales, const std::vector<float>& shifts, size_t groups);
+    /**
+     * @brief Checks that the input may have few enough rows for the weights-only compressed execution to pay off,
+     * otherwise the decompression subgraph is better executed once as constant nodes and the weights post ops fused
+     */
+    bool canUseWeightsDecompression() const;
+    bool withWeightsDecompression() const {
+        return decompressionGroups != 0;
+    }
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -106,6 +123,20 @@ private:
 
     bool canBeExecutedInConv1x1() const;
     MemoryPtr prepareWeightMemory(const DnnlMemoryDescPtr weightDesc);
+
+    // weights-only compressed execution, see initWeightsDecompression
+    size_t decompressionGroups = 0;
+    // [groups, OC padded to the weights block] layout
+    std::vector<float> decompressionScales;
+    std::vector<float> decompressionShifts;
+    // compressed weights repacked to [OC / block, IC, block] layout
+    MemoryPtr decompressionWeights;
+    // fp32 weights in [OC, IC] layout, decompressed only when the dynamic input gets many rows
+    MemoryPtr decompressedWeights;
+
+    MemoryPtr prepareDecompressionWeights();
+    MemoryPtr prepareDecompressedWeights();
+    void executeWeightsDecompression();
 };
 
 }   // namespace node
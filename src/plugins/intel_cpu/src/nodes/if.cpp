@@ -70,6 +70,9 @@ void If::getSupportedDescriptors() {
 
     const std::shared_ptr<const ov::Model>& thenBody = ifOp->get_then_body();
     const std::shared_ptr<const ov::Model>& elseBody = ifOp->get_else_body();
+    // the bodies are executed by the same stream, so they reuse the runtime cache of the parent graph
+    subGraphThen.setRuntimeCache(getRuntimeCache());
+    subGraphElse.setRuntimeCache(getRuntimeCache());
     subGraphThen.CreateGraph(thenBody, ext_mng, weightCache, sharedMutex);
     subGraphElse.CreateGraph(elseBody, ext_mng, weightCache, sharedMutex);
 
@@ -351,7 +351,10 @@ void Input::cloneBlobIfRequired() {
     };
 
     if (weightCache) {
-        MemoryPtr ptr = *weightCache->findOrCreate(blobKey(), cloneBlob);
+        const auto desc = std::make_shared<DnnlBlockedMemoryDesc>(memDesc);
+        MemoryPtr ptr = weightCache->findOrCreateConstant(blobKey(),
+                                                          std::shared_ptr<const void>(constOp, constOp->get_data_ptr()),
+                                                          constOp->get_byte_size(), desc, desc, cloneBlob);
         memoryPtr = std::const_pointer_cast<const Memory>(ptr);
     } else if (isBlobAligned() && !hasSubnormals() && !isWA()) {
         auto ptr = new Memory(getEngine());
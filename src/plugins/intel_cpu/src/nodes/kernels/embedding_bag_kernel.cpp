@@ -0,0 +1,127 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_kernel.hpp"
+#include "utils/bfloat16.hpp"
+#include <ie_common.h>
+
+using namespace dnnl::impl;
+using namespace Xbyak;
+
+namespace ov {
+namespace intel_cpu {
+
+jit_emb_bag_kernel::jit_emb_bag_kernel(const jit_emb_bag_config& jcp)
+    : jit_kernel(jit_name()),
+      _jcp(jcp) {
+}
+
+void jit_emb_bag_kernel::init() {
+    if (create_kernel() != status::success)
+        IE_THROW() << "Can't generate jit embedding bag kernel";
+    _fn = (function_t)jit_ker();
+}
+
+template <typename T, size_t N>
+void jit_emb_bag_kernel_impl<T[N]>::generate() {
+    preamble();
+
+    // Get arguments addresses
+    auto src = arg<const T*>(&jit_emb_bag_args::src);
+    auto indices = arg(&jit_emb_bag_args::indices);
+    auto weights = arg<const T*>(&jit_emb_bag_args::weights);
+    auto dst = arg(&jit_emb_bag_args::dst);
+    auto indices_num = arg(&jit_emb_bag_args::indices_num);
+    auto row_stride = arg(&jit_emb_bag_args::row_stride);
+    auto work_amount = arg(&jit_emb_bag_args::work_amount);
+
+    // the table pointer is moved together with the output block, so the rows are addressed at the block offset
+    auto blocks_num = var<size_t>();
+    mov(blocks_num, work_amount);
+    blocks_num >>= max_unroll_log2;
+
+    foreach(0, blocks_num, [&](const Reg64 &) {
+        accumulate_block(max_unroll, src, indices, weights, dst, indices_num, row_stride);
+        src += max_unroll * N * sizeof(T);
+        dst += max_unroll * N * sizeof(float);
+    });
+
+    work_amount &= max_unroll - 1;
+
+    foreach(0, work_amount, [&](const Reg64 &) {
+        accumulate_block(1, src, indices, weights, dst, indices_num, row_stride);
+        src += N * sizeof(T);
+        dst += N * sizeof(float);
+    });
+
+    postamble();
+}
+
+template <typename T, size_t N>
+void jit_emb_bag_kernel_impl<T[N]>::accumulate_block(size_t unroll,
+                                                     const variable<const T*> & src,
+                                                     const variable<const int*> & indices,
+                                                     const variable<const T*> & weights,
+                                                     const variable<float*> & dst,
+                                                     const variable<size_t> & indices_num,
+                                                     const variable<size_t> & row_stride) {
+    const size_t step = N * sizeof(T);
+
+    std::vector<variable<float[N]>> acc;
+    acc.reserve(unroll);
+    for (size_t k = 0; k < unroll; k++) {
+        acc.emplace_back(var<float[N]>());
+        uni_vxorps(acc[k], acc[k], acc[k]);
+    }
+
+    auto data = var<float[N]>();
+    auto weight = var<float[N]>();
+    auto row = var<const T*>();
+    auto next_row = var<size_t>();
+
+    foreach(0, indices_num, [&](const Reg64 & idx) {
+        // the row of the index prefetch_distance steps ahead at the same block offset
+        mov(next_row, idx);
+        next_row += prefetch_distance;
+        _if(next_row < indices_num)
+        ._then([&] {
+            movsxd(next_row, dword[indices.reg() + next_row.reg() * sizeof(int)]);
+            imul(next_row, row_stride);
+            add(next_row, src);
+            for (size_t k = 0; k < unroll; k++)
+                prefetcht0(ptr[next_row.reg() + k * step]);
+        });
+
+        if (_jcp.with_weights) {
+            lea(row, ptr[weights.reg() + idx * sizeof(T)]);
+            load(weight, row, 1);
+            uni_vbroadcastss(weight, Xmm(weight.reg().getIdx()));
+        }
+
+        movsxd(row, dword[indices.reg() + idx * sizeof(int)]);
+        imul(row, row_stride);
+        add(row, src);
+
+        for (size_t k = 0; k < unroll; k++) {
+            load(data, row);
+            if (_jcp.with_weights)
+                uni_vfmadd231ps(acc[k], data, weight);
+            else
+                uni_vaddps(acc[k], acc[k], data);
+            if (k + 1 < unroll)
+                row += step;
+        }
+    });
+
+    for (size_t k = 0; k < unroll; k++)
+        uni_vmovups(ptr[dst.reg() + k * N * sizeof(float)], acc[k]);
+}
+
+template class jit_emb_bag_kernel_impl<float[8]>;
+template class jit_emb_bag_kernel_impl<float[16]>;
+template class jit_emb_bag_kernel_impl<bfloat16_t[8]>;
+template class jit_emb_bag_kernel_impl<bfloat16_t[16]>;
+
+}   // namespace intel_cpu
+}   // namespace ov
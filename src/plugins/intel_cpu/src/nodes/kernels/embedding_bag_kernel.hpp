@@ -0,0 +1,80 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <utils/jit_kernel.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_emb_bag_config {
+    bool with_weights;
+};
+
+struct jit_emb_bag_args {
+    const void* src;        // embedding table
+    const int* indices;     // indices of the bag rows
+    const void* weights;    // per sample weights of the bag, the same precision as the table
+    float* dst;             // output row
+    size_t indices_num;
+    size_t row_stride;      // size of the table row in bytes
+    size_t work_amount;     // number of the vectors in the output row
+};
+
+struct jit_emb_bag_kernel : public jit_kernel {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_emb_bag_kernel)
+
+    typedef void (*function_t)(const jit_emb_bag_args *);
+
+    void init();
+
+    void operator()(const jit_emb_bag_args* args) const {
+        assert(_fn);
+        _fn(args);
+    }
+
+    virtual size_t simd_size() const = 0;
+
+protected:
+    explicit jit_emb_bag_kernel(const jit_emb_bag_config& jcp);
+
+    jit_emb_bag_config _jcp;
+    function_t _fn = nullptr;
+};
+
+/**
+ * Gathers the rows of the bag and accumulates them in fp32, T is the table precision (float or bfloat16_t).
+ * The output row is processed by blocks of several vectors, all the bag rows are accumulated into the block registers
+ * before the block is stored, so the output is written once. The rows of the next indices are prefetched.
+ */
+template <typename T>
+class jit_emb_bag_kernel_impl;
+
+template <typename T, size_t N>
+class jit_emb_bag_kernel_impl<T[N]> : public jit_emb_bag_kernel {
+public:
+    explicit jit_emb_bag_kernel_impl(const jit_emb_bag_config& jcp) : jit_emb_bag_kernel(jcp) {}
+
+    size_t simd_size() const override {
+        return N;
+    }
+
+private:
+    static constexpr size_t max_unroll_log2 = 2;
+    static constexpr size_t max_unroll = 1lu << max_unroll_log2;
+    static constexpr size_t prefetch_distance = 4;
+
+    void generate() override;
+    void accumulate_block(size_t unroll,
+                          const variable<const T*> & src,
+                          const variable<const int*> & indices,
+                          const variable<const T*> & weights,
+                          const variable<float*> & dst,
+                          const variable<size_t> & indices_num,
+                          const variable<size_t> & row_stride);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
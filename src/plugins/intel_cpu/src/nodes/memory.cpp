@@ -107,7 +107,7 @@ bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>
 }
 
 MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache)
-        : Input(op, eng, cache), MemoryNode(op), dataStore(new Memory{eng}) {
+        : Input(op, eng, cache), MemoryNode(op), dataStore(new Memory{eng}), assignStore(dataStore) {
     std::string errorMessage;
     if (!isSupportedOperation(op, errorMessage)) {
         IE_THROW(NotImplemented) << errorMessage;
@@ -158,18 +158,30 @@ MemoryPtr MemoryInput::getStore() {
     return dataStore;
 }
 
+void MemoryInput::bindState(const MemoryPtr& input, const MemoryPtr& output) {
+    dataStore = input;
+    assignStore = output;
+}
+
 void MemoryInput::storeState(const Memory &new_state) {
+    // the producer has already written the state in place
+    if (new_state.GetData() == assignStore->GetData())
+        return;
     // TODO: Should be next one call:
     //           dataStore.SetData(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*assignStore, new_state);
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
+    auto& dstMemory = getChildEdgeAt(0)->getMemory();
+    // the consumers read the state in place
+    if (dstMemory.GetData() == dataStore->GetData())
+        return;
     // TODO: Should be simple call of:
     //           dst_mem.SetData(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(dstMemory, *dataStore);
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -103,8 +103,16 @@ public:
     void setInputNode(Node* node) override {}
     void storeState(const Memory& mem);
     MemoryPtr getStore();
+    /**
+     * @brief Binds the buffers of a variable state: the node reads the state from the input memory
+     * and the paired MemoryOutput writes the new state to the output memory.
+     * Nothing is copied if the graph edges are redirected to the same buffers.
+     */
+    void bindState(const MemoryPtr& input, const MemoryPtr& output);
  private:
     MemoryPtr dataStore;
+    // equal to dataStore until a double buffered state is bound
+    MemoryPtr assignStore;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
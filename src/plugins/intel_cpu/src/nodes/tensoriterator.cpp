@@ -4,6 +4,7 @@
 
 #include "tensoriterator.h"
 
+#include <set>
 #include <string>
 #include <vector>
 #include <dnnl_extension_utils.h>
@@ -144,6 +145,61 @@ private:
     int iter_count;
 };
 
+/**
+ * Points the body memories to the current chunk of the full tensor instead of copying the chunk.
+ * Applicable only if the chunk is a contiguous part of the full tensor, both have the plain layout
+ * and the body is able to read (write) external memory.
+ */
+class PortIteratorViewHelper : public PortMapHelper {
+public:
+    PortIteratorViewHelper(const MemoryPtr &full, const std::vector<MemoryPtr> &parts, const PortMap &slice_rule)
+                           : parts(parts) {
+        const auto axis = slice_rule.axis;
+        const auto stride = slice_rule.stride;
+        const auto abs_stride = std::abs(stride);
+
+        auto full_dims = full->GetShape().getStaticDims();
+        iter_count = full_dims[axis] / abs_stride;
+
+        full_dims[axis] = abs_stride;
+        IE_ASSERT(full_dims == parts.front()->GetShape().getStaticDims()) << "Shape mismatch for tensor iterator port";
+
+        full_mem = full->GetPrimitive();
+
+        chunk_stride_in_byte = parts.front()->GetSize();
+        chunk_offset_in_byte = stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= stride < 0 ? -1 : 1;
+    }
+
+    static bool isApplicable(const MemoryPtr &full, const MemoryPtr &part, const PortMap &slice_rule) {
+        const auto &full_dims = full->GetShape().getStaticDims();
+        if (std::any_of(full_dims.begin(), full_dims.begin() + slice_rule.axis, [](size_t dim) { return dim != 1; }))
+            return false;
+
+        const auto prec = full->getDesc().getPrecision();
+        return part->getDesc().getPrecision() == prec &&
+               full->getDesc().isCompatible(CpuBlockedMemoryDesc(prec, full->GetShape())) &&
+               part->getDesc().isCompatible(CpuBlockedMemoryDesc(prec, part->GetShape()));
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem.get_data_handle()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (auto &part : parts)
+            part->setDataHandle(chunk_ptr);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    std::vector<MemoryPtr> parts;
+    dnnl::memory full_mem;
+
+    int iter_count;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng) {
@@ -224,93 +280,144 @@ private:
 };
 
 DynamicBuffer::DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr> &to_,
-                             const PortMap &map_rule_) : from(from_), to(to_), map_rule(map_rule_) {
+                             const PortMap &map_rule_, bool can_share_from_)
+                             : from(from_), to(to_), map_rule(map_rule_), can_share_from(can_share_from_) {
     elem_size = DnnlExtensionUtils::sizeOfDataType(from->GetDataType());
 }
 
+void DynamicBuffer::reset(const int max_num_iter) {
+    // the iteration count of the previous inference is the best guess for the next one
+    iter_count_hint = std::max(num_execs, size_t(1));
+    if (max_num_iter > 0)
+        iter_count_hint = std::min(iter_count_hint, static_cast<size_t>(max_num_iter));
+    num_execs = 0;
+}
+
+void DynamicBuffer::bind(const dnnl::engine& eng) {
+    // the chunk layout is known only after the first iteration (of the previous inference for the first one)
+    if (!from_is_shared)
+        return;
+
+    if (num_execs == max_iter_count)
+        grow_buffer(eng, 2 * max_iter_count);
+
+    from->setDataHandle(chunk_ptr(num_execs));
+    from_is_bound = true;
+}
+
 void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
     if (iter == 0) {
         init(eng);
-        return;
-    }
+    } else {
+        const auto abs_stride = std::abs(map_rule.stride);
+        if (from->getStaticDims()[map_rule.axis] != abs_stride)
+            IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
+                       " is expected, but actual: " << from->getStaticDims()[map_rule.axis];
 
-    auto new_buffer = create_buffer(eng);
-    move_buffer(new_buffer);
-    move_data();
+        if (num_execs == max_iter_count)
+            grow_buffer(eng, 2 * max_iter_count);
+
+        if (!is_written_in_place())
+            move_data();
+    }
+    num_execs++;
 }
 
 void DynamicBuffer::init(const dnnl::engine& eng) {
-    chunk_offset_in_byte = 0;
-    buffer_offset_in_byte = 0;
-
     const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
-
-    auto src_mem = from->GetPrimitive();
-    auto src_desc = src_mem.get_desc();
-    auto dims = src_desc.dims();
+    const auto abs_stride = std::abs(map_rule.stride);
 
+    const auto dims = from->getStaticDims();
     if (dims[axis] != abs_stride)
         IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
                    " is expected, but actual: " << dims[axis];
 
-    count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, size_t(1), std::multiplies<size_t>());
-    len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
-    mem_holder_buffer.reset(new memory(src_desc, eng));
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()), 0, 0, 1, from->GetSize());
-}
-
-std::shared_ptr<dnnl::memory> DynamicBuffer::create_buffer(const dnnl::engine& eng) {
-    const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
-
-    const auto old_desc = mem_holder_buffer->get_desc();
-    auto dims = old_desc.dims();
+    count = std::accumulate(dims.begin(), dims.begin() + axis, size_t(1), std::multiplies<size_t>());
+    len = std::accumulate(dims.begin() + axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
+    chunk_len = len * abs_stride;
+    chunk_dims = dims;
+
+    // the body output may be written in place only if the chunk is a contiguous part of the buffer
+    const auto prec = from->getDesc().getPrecision();
+    from_is_shared = can_share_from && count == 1 && chunk_len != 0 &&
+                     from->getDesc().isCompatible(CpuBlockedMemoryDesc(prec, Shape(dims)));
+
+    // the buffer of the previous inference is reused if it's large enough,
+    // but it's kept alive in any case since the body output may point to it
+    auto old_buffer = mem_holder_buffer;
+    const auto chunk_size = count * chunk_len;
+    const auto get_max_iter_count = [&]() {
+        return chunk_size != 0 ? mem_holder_buffer->get_desc().get_size() / chunk_size : iter_count_hint;
+    };
 
-    if (from->getStaticDims()[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-        " is expected, but actual: " << from->getStaticDims()[axis];
+    bool reuse_buffer = mem_holder_buffer && mem_holder_buffer->get_desc().get_size() >= chunk_size * iter_count_hint;
+    if (reuse_buffer) {
+        max_iter_count = get_max_iter_count();
+        // the output written to the buffer with another layout may overlap with the new first chunk
+        reuse_buffer = !from_is_bound || is_written_in_place();
+    }
+    if (!reuse_buffer) {
+        mem_holder_buffer = create_buffer(eng, chunk_size * iter_count_hint);
+        max_iter_count = get_max_iter_count();
+    }
 
-    dims[axis] += abs_stride;
-    dnnl::memory::desc new_buffer_desc(dims, old_desc.data_type(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size()));
+    if (!is_written_in_place())
+        move_data();
 
-    if (stride > 0.0f) {
-        chunk_offset_in_byte += new_buffer_desc.data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    } else {
-        buffer_offset_in_byte = from->GetPrimitive().get_desc().data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
+    // the body output keeps the chunk till the back edges of the next iteration are applied
+    if (from_is_bound) {
+        if (from_is_shared)
+            from->setDataHandle(chunk_ptr(0));
+        else
+            unbind_from(eng);
     }
-
-    return std::make_shared<dnnl::memory>(new_buffer_desc, eng);
 }
 
-void DynamicBuffer::move_buffer(std::shared_ptr<dnnl::memory> new_buffer) {
-    const auto axis = map_rule.axis;
-    const auto src_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-    const auto dst_stride = new_buffer->get_desc().dims()[axis] * len;
+void DynamicBuffer::grow_buffer(const dnnl::engine& eng, const size_t new_max_iter_count) {
+    auto new_buffer = create_buffer(eng, count * chunk_len * new_max_iter_count);
+
+    // stored chunks are placed at the beginning of each row for positive stride and at the end for negative one
+    const auto src_offset = map_rule.stride > 0 ? 0 : (max_iter_count - num_execs) * chunk_len;
+    const auto dst_offset = map_rule.stride > 0 ? 0 : (new_max_iter_count - num_execs) * chunk_len;
+    copy(get_ptr(*mem_holder_buffer) + src_offset, get_ptr(*new_buffer) + dst_offset,
+         max_iter_count * chunk_len, new_max_iter_count * chunk_len, count, num_execs * chunk_len);
 
-    copy(get_ptr(*mem_holder_buffer.get()), get_ptr(*new_buffer.get()) + buffer_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
     mem_holder_buffer = new_buffer;
+    max_iter_count = new_max_iter_count;
 }
 
 void DynamicBuffer::move_data() {
-    const auto axis = map_rule.axis;
-    const auto src_stride = abs(map_rule.stride) * len;
-    const auto dst_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
+    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), chunk_ptr(num_execs),
+         chunk_len, max_iter_count * chunk_len, count, chunk_len);
+}
 
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + chunk_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+void DynamicBuffer::unbind_from(const dnnl::engine& eng) {
+    // the memory primitive of the body output is kept, since the body nodes may hold it
+    mem_holder_from = create_buffer(eng, from->GetSize());
+    cpu_memcpy(get_ptr(*mem_holder_from), from->GetData(), from->GetSize());
+    from->setDataHandle(get_ptr(*mem_holder_from));
+    from_is_bound = false;
+}
+
+uint8_t* DynamicBuffer::chunk_ptr(const size_t idx) const {
+    const auto pos = map_rule.stride > 0 ? idx : max_iter_count - 1 - idx;
+    return get_ptr(*mem_holder_buffer) + pos * chunk_len;
+}
+
+bool DynamicBuffer::is_written_in_place() const {
+    return from_is_bound && count == 1 && from->GetPtr() == chunk_ptr(num_execs) && from->getStaticDims() == chunk_dims;
 }
 
 void DynamicBuffer::transfer(const Node* node) {
-    if (mem_holder_buffer) {
-        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(
-                DnnlExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims()));
+    if (num_execs != 0) {
+        auto dims = chunk_dims;
+        dims[map_rule.axis] *= num_execs;
+        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(dims);
         redefineToMemories(to, desc);
 
-        copy(get_ptr(*mem_holder_buffer.get()), reinterpret_cast<uint8_t*>(to.front()->GetPtr()), 0, 0, 1, to.front()->GetSize());
+        const auto first_chunk = map_rule.stride > 0 ? 0 : max_iter_count - num_execs;
+        copy(get_ptr(*mem_holder_buffer) + first_chunk * chunk_len, reinterpret_cast<uint8_t*>(to.front()->GetPtr()),
+             max_iter_count * chunk_len, num_execs * chunk_len, count, num_execs * chunk_len);
     } else {
         VectorDims newDims = to.front()->GetShape().getDims();
         nullifyUndefinedDims(newDims);
@@ -318,8 +425,12 @@ void DynamicBuffer::transfer(const Node* node) {
         const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(newDims);
         redefineToMemories(to, desc);
     }
+}
 
-    mem_holder_buffer.reset();
+std::shared_ptr<dnnl::memory> DynamicBuffer::create_buffer(const dnnl::engine& eng, const size_t size) {
+    const dnnl::memory::desc desc({static_cast<dnnl::memory::dim>(std::max(size, size_t(1)))},
+                                  memory::data_type::u8, memory::format_tag::a);
+    return std::make_shared<dnnl::memory>(desc, eng);
 }
 
 void DynamicBuffer::copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len) {
@@ -363,6 +474,8 @@ void TensorIterator::getSupportedDescriptors() {
         THROW_ERROR << "cannot be cast to ov::op::util::SubGraphOp";
     }
     const std::shared_ptr<const ov::Model> body = tiOp->get_function();
+    // the body is executed by the same stream, so it reuses the runtime cache of the parent graph
+    sub_graph.setRuntimeCache(getRuntimeCache());
     sub_graph.CreateGraph(body, ext_mng, weightCache, sharedMutex);
 
     const auto &inMap = sub_graph.GetInputNodesMap();
@@ -370,6 +483,7 @@ void TensorIterator::getSupportedDescriptors() {
         auto inNode = inMap.find(param->get_friendly_name());
         if (inNode != inMap.end()) {
             input_mems.push_back(getToMemories(inNode->second.get(), 0));
+            input_nodes.push_back(inNode->second);
         }
     }
 
@@ -379,8 +493,9 @@ void TensorIterator::getSupportedDescriptors() {
         const auto inputID = ngraph::op::util::create_ie_output_name(prev);
         auto outNode = outMap.find(inputID);
         if (outNode != outMap.end()) {
-            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
-            output_mem.push_back(outMem);
+            auto outEdge = outNode->second->getParentEdgeAt(0);
+            output_mem.push_back(outEdge->getMemoryPtr());
+            output_edges.push_back(outEdge);
         }
     }
 
@@ -512,8 +627,9 @@ void TensorIterator::prepareParams() {
         prepareLoopBodyCurrentIteration();
 
         if (!isDynamicNode()) {
-            prepareOutputPorts();
+            // back edges read the body outputs of the previous iteration before they are redirected to the next chunk
             prepareBackEdges();
+            prepareOutputPorts();
         }
     }
 }
@@ -557,6 +673,9 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
     for (auto &mapper : first_mappers)
         mapper->execute(strm);
 
+    for (auto& buffer : buffers)
+        buffer->reset(max_num_iter);
+
     // use  "i != max_num_iter" only to allow "-1" works like infinite loop
     for (int i = 0; i != max_num_iter && continue_cond; i++) {
         // copy data to subgraph iteration
@@ -565,6 +684,10 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
         for (auto &mapper : back_mappers)
             mapper->execute(strm, i);
 
+        // the body writes concatenated outputs directly to the buffers
+        for (auto& buffer : buffers)
+            buffer->bind(eng);
+
         sub_graph.Infer();
 
         continue_cond = continue_cond_check->getStatus();
@@ -590,6 +713,10 @@ void TensorIterator::prepareInputPorts() {
 
         if (map_rule.axis == -1)
             first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        else if (PortIteratorViewHelper::isApplicable(from_mem, to_mem, map_rule) &&
+                 Graph::canUseExternalMemory(input_nodes[map_rule.to]))
+            before_mappers.emplace_back(
+                    std::make_shared<PortIteratorViewHelper>(from_mem, input_mems[map_rule.to], map_rule));
         else
             before_mappers.emplace_back(
                     std::make_shared<PortIteratorHelper>(from_mem, to_mem, true, map_rule, eng));
@@ -598,14 +725,22 @@ void TensorIterator::prepareInputPorts() {
 
 void TensorIterator::prepareOutputPorts() {
     const auto &eng = getEngine();
+    std::set<int> shared_outputs;
     for (auto map_rule : outputPortMap) {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
-        else
+        } else if (!shared_outputs.count(map_rule.to) &&
+                   PortIteratorViewHelper::isApplicable(to_mem, from_mem, map_rule) &&
+                   canShareBodyOutput(map_rule.to)) {
+            // the body output is redirected to the chunk of the output before the iteration
+            shared_outputs.insert(map_rule.to);
+            before_mappers.emplace_back(std::make_shared<PortIteratorViewHelper>(to_mem, std::vector<MemoryPtr>{from_mem}, map_rule));
+        } else {
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(from_mem, to_mem, false, map_rule, eng));
+        }
     }
 }
 
@@ -634,11 +769,15 @@ void TensorIterator::prepareDynamicBackEdges() {
 }
 
 void TensorIterator::prepareDynamicBuffers() {
+    std::set<int> shared_outputs;
     for (auto map_rule : outputPortMap) {
         if (map_rule.axis != -1) {
             auto to_mems = getToMemories(this, map_rule.from);
             auto &from_mem = output_mem[map_rule.to];
-            buffers.emplace_back(std::make_shared<DynamicBuffer>(from_mem, to_mems, map_rule));
+            const bool can_share = !shared_outputs.count(map_rule.to) && canShareBodyOutput(map_rule.to);
+            if (can_share)
+                shared_outputs.insert(map_rule.to);
+            buffers.emplace_back(std::make_shared<DynamicBuffer>(from_mem, to_mems, map_rule, can_share));
         }
     }
 }
@@ -676,6 +815,15 @@ void TensorIterator::prepareTripCount() {
     lastUsedTripCount = trip_count_check->getStatus();
 }
 
+bool TensorIterator::canShareBodyOutput(const int idx) const {
+    // the condition output is checked through the memory captured in prepareParams,
+    // and the body input passed to the output directly mustn't be redirected
+    const auto &edge = output_edges[idx];
+    return idx != loopBodyConditionOutputIdx &&
+           edge->getParent()->getType() != Type::Input &&
+           Graph::canUseExternalMemory(edge);
+}
+
 /* *==============* *==============* *==============* *==============* *==============* */
 
 inline SizeVector sliced_input_dims(const MemoryPtr& mem, const int axis, const int stride) {
@@ -60,13 +60,19 @@ protected:
 
 /**
  * Class for storing intermediate output buffer state for dynamism when we don't know
- * final output shape but we should concatenate output after each iteration
+ * final output shape but we should concatenate output after each iteration.
+ * The buffer has room for several chunks along the concatenation axis and grows geometrically,
+ * so the already concatenated data is moved only a logarithmic number of times.
+ * If the layout allows it, the body output is redirected to the next free chunk of the buffer
+ * before the body inference, so the body writes its output in place.
  */
 class DynamicBuffer {
 public:
-    DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr> &to_, const PortMap &map_rule_);
+    DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr> &to_, const PortMap &map_rule_, bool can_share_from_);
     ~DynamicBuffer() = default;
 
+    void reset(const int max_num_iter);
+    void bind(const dnnl::engine& eng);
     void execute(const dnnl::engine& eng, const int iter);
     void transfer(const Node* node);
 
@@ -74,24 +80,36 @@ private:
     void init(const dnnl::engine& eng);
 
     /* methods for resize and refill buffer */
-    std::shared_ptr<dnnl::memory> create_buffer(const dnnl::engine& eng);
-    void move_buffer(std::shared_ptr<dnnl::memory> new_buffer);
+    void grow_buffer(const dnnl::engine& eng, const size_t new_max_iter_count);
     void move_data();
+    void unbind_from(const dnnl::engine& eng);
 
+    uint8_t* chunk_ptr(const size_t idx) const;
+    bool is_written_in_place() const;
+
+    static std::shared_ptr<dnnl::memory> create_buffer(const dnnl::engine& eng, const size_t size);
     static void copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len);
     static uint8_t* get_ptr(dnnl::memory& prim);
 
     size_t len = 1lu;
     size_t count = 1lu;
     size_t elem_size = 0lu;
-    ptrdiff_t chunk_offset_in_byte = 0;
-    ptrdiff_t buffer_offset_in_byte = 0;
+    size_t chunk_len = 0lu;         /**< Size of the chunk in a row of the buffer in bytes */
+    size_t num_execs = 0lu;         /**< Number of chunks stored in the buffer */
+    size_t max_iter_count = 0lu;    /**< Number of chunks the buffer has room for */
+    size_t iter_count_hint = 1lu;   /**< Expected number of chunks, the buffer is created for */
+    VectorDims chunk_dims;
 
     MemoryPtr from;
     std::vector<MemoryPtr> to;
     PortMap map_rule;
 
+    bool can_share_from = false;    /**< The body output may be redirected to external memory */
+    bool from_is_shared = false;    /**< The body output is redirected to the buffer before each iteration */
+    bool from_is_bound = false;     /**< The body output currently points to the buffer */
+
     std::shared_ptr<dnnl::memory> mem_holder_buffer;
+    std::shared_ptr<dnnl::memory> mem_holder_from;   /**< Own memory of the body output once it's not redirected anymore */
 };
 
 class TensorIterator : public Node {
@@ -127,6 +145,7 @@ private:
     void prepareContinueCond();
     void prepareInitialCond();
     void prepareTripCount();
+    bool canShareBodyOutput(const int idx) const;
 
     /* Dynamic support */
     void reshapeSubgraphInput();
@@ -138,6 +157,8 @@ private:
     Graph sub_graph;
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
+    std::vector<NodePtr> input_nodes;   /// < Body inputs, are used to check that the body can read external memory
+    std::vector<EdgePtr> output_edges;  /// < Body outputs, are used to check that the body can write to external memory
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
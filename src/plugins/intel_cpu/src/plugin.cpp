@@ -90,12 +90,14 @@
 #include "transformations/smart_reshape/smart_reshape.hpp"
 
 #include "ngraph_transformations/convert_to_cpu_specific_opset.hpp"
+#include "ngraph_transformations/constant_folding_executor.hpp"
 #include "ngraph_transformations/snippets_mark_skipped.hpp"
 #include "ngraph_transformations/mha_fusion.hpp"
 #include "ngraph_transformations/convert_to_interaction.hpp"
 #include "ngraph_transformations/convert_fq_rnn_to_quantized_rnn.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
 #include "ngraph_transformations/swap_convert_transpose.hpp"
+#include "ngraph_transformations/mark_matmul_weights_decompression.hpp"
 
 #include <snippets/pass/collapse_subgraph.hpp>
 #include <snippets/pass/common_optimizations.hpp>
@@ -282,6 +284,9 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
             defaultPrecisions = ngraph::pass::low_precision::precision_set::int8_int16_int32_support;
         }
         manager.register_pass<ov::pass::MarkDequantizationSubgraph>(defaultPrecisions);
+    } else {
+        // weights-only compressed MatMuls are executed by FullyConnected with on the fly decompression
+        manager.register_pass<MarkMatMulWeightsDecompression>();
     }
     auto get_convert_precisions = []() {
         precisions_array array = {
@@ -323,7 +328,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     manager.register_pass<ngraph::pass::ConvertMulticlassNmsToMulticlassNmsIE>();
     manager.register_pass<ngraph::pass::ConvertMatrixNmsToMatrixNmsIE>();
     manager.register_pass<ngraph::pass::TransposeMatMul>();
-    manager.register_pass<ngraph::pass::ConstantFolding>();
+    manager.register_pass<ngraph::pass::ConstantFolding>(constantFoldingExecutor());
 
     if (useLpt) {
         CPU_LPT_SCOPE(LowPrecisionTransformations_Part2);
@@ -609,7 +614,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         return false;
     });
 
-    postLPTPassManager.register_pass<ngraph::pass::ConstantFolding>();
+    postLPTPassManager.register_pass<ngraph::pass::ConstantFolding>(constantFoldingExecutor());
 
     // Snippets may brake MHA patterns so the fusion has to performed before
     postLPTPassManager.register_pass<MHAFusion>();
@@ -678,7 +683,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
             std::string errMsg;
             return node::FakeQuantize::isSupportedOperation(node, errMsg);
         });
-    postSnippetsManager.register_pass<ngraph::pass::ConstantFolding>();
+    postSnippetsManager.register_pass<ngraph::pass::ConstantFolding>(constantFoldingExecutor());
     postSnippetsManager.run_passes(nGraphFunc);
 }
 
@@ -1186,7 +1191,10 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
         conf.batchLimit = static_cast<int>(cnnnetwork.getBatchSize());
     }
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    // the stream is positioned right after the model, the compiled graph section is optional
+    auto compiledState = CompiledGraphState::read(networkModel, conf);
+
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this(), compiledState);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
@@ -6,6 +6,9 @@
 #include <openvino/pass/serialize.hpp>
 
 #include <pugixml.hpp>
+#include <onednn/dnnl.h>
+#include <cstring>
+#include <sstream>
 
 using namespace InferenceEngine;
 
@@ -65,6 +68,54 @@ namespace {
             it->second->setLayout(layout_from_string(layout_attr.value()));
         }
     }
+
+    // the version must be increased on any change of the compiled graph section layout
+    constexpr char compiledGraphMagic[8] = {'O', 'V', 'C', 'P', 'U', 'G', 'R', 'F'};
+    constexpr uint32_t compiledGraphVersion = 2;
+
+    // the section is laid out as: magic, uint64 size of the rest of the section, header, payload
+    struct CompiledGraphHeader {
+        uint32_t version;
+        int32_t isa;
+        uint8_t enforceBF16;
+        uint8_t lpTransformsMode;
+    };
+
+    CompiledGraphHeader makeCompiledGraphHeader(const Config& config) {
+        CompiledGraphHeader hdr = {};
+        hdr.version = compiledGraphVersion;
+        hdr.isa = static_cast<int32_t>(dnnl::get_effective_cpu_isa());
+        hdr.enforceBF16 = static_cast<uint8_t>(config.enforceBF16);
+        hdr.lpTransformsMode = static_cast<uint8_t>(config.lpTransformsMode);
+        return hdr;
+    }
+
+    template <typename T>
+    void writeValue(std::ostream& ostream, const T& value) {
+        ostream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    void writeString(std::ostream& ostream, const std::string& str) {
+        writeValue(ostream, static_cast<uint64_t>(str.size()));
+        ostream.write(str.data(), str.size());
+    }
+
+    uint64_t stringSize(const std::string& str) {
+        return sizeof(uint64_t) + str.size();
+    }
+
+    template <typename T>
+    bool readValue(std::istream& istream, T& value) {
+        return static_cast<bool>(istream.read(reinterpret_cast<char*>(&value), sizeof(value)));
+    }
+
+    bool readString(std::istream& istream, std::string& str) {
+        uint64_t size = 0;
+        if (!readValue(istream, size))
+            return false;
+        str.resize(size);
+        return static_cast<bool>(istream.read(&str[0], size));
+    }
 };  // namespace
 
 CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager)
@@ -174,5 +225,109 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     setPrecisionsAndLayouts(outputs.children("out"), network.getOutputsInfo());
 }
 
+void CompiledGraphState::write(std::ostream& ostream, const Config& config) const {
+    // the size of the section is computed in advance, so the constants are written straight from their memory
+    uint64_t sectionSize = sizeof(CompiledGraphHeader) + sizeof(uint64_t);
+    for (const auto& descriptor : selectedDescriptors)
+        sectionSize += stringSize(descriptor.first) + sizeof(int32_t) + sizeof(int64_t);
+    sectionSize += sizeof(uint64_t);
+    for (const auto& constant : constants) {
+        sectionSize += stringSize(constant.first) + stringSize(constant.second.format) + sizeof(uint64_t) +
+                       constant.second.size;
+    }
+
+    ostream.write(compiledGraphMagic, sizeof(compiledGraphMagic));
+    writeValue(ostream, sectionSize);
+    writeValue(ostream, makeCompiledGraphHeader(config));
+
+    writeValue(ostream, static_cast<uint64_t>(selectedDescriptors.size()));
+    for (const auto& descriptor : selectedDescriptors) {
+        writeString(ostream, descriptor.first);
+        writeValue(ostream, static_cast<int32_t>(descriptor.second.index));
+        writeValue(ostream, static_cast<int64_t>(descriptor.second.implType));
+    }
+
+    writeValue(ostream, static_cast<uint64_t>(constants.size()));
+    for (const auto& constant : constants) {
+        writeString(ostream, constant.first);
+        writeString(ostream, constant.second.format);
+        writeValue(ostream, static_cast<uint64_t>(constant.second.size));
+        ostream.write(reinterpret_cast<const char*>(constant.second.data.get()), constant.second.size);
+    }
+}
+
+CompiledGraphState::Ptr CompiledGraphState::read(std::istream& istream, const Config& config) {
+    // blobs exported by the previous versions of the plugin end right after the model,
+    // the stream is left untouched for them since the next blob may follow (e.g. HETERO subnetworks)
+    const auto sectionPos = istream.tellg();
+    char magic[sizeof(compiledGraphMagic)] = {};
+    uint64_t sectionSize = 0;
+    if (!istream.read(magic, sizeof(magic)) ||
+        std::memcmp(magic, compiledGraphMagic, sizeof(magic)) != 0 ||
+        !readValue(istream, sectionSize)) {
+        istream.clear();
+        istream.seekg(sectionPos);
+        return nullptr;
+    }
+
+    const auto sectionEnd = istream.tellg() + static_cast<std::streamoff>(sectionSize);
+    auto skipSection = [&]() {
+        istream.clear();
+        istream.seekg(sectionEnd);
+    };
+
+    const auto expected = makeCompiledGraphHeader(config);
+    CompiledGraphHeader hdr = {};
+    if (sectionSize < sizeof(hdr) || !readValue(istream, hdr))
+        IE_THROW(NetworkNotRead) << "The compiled graph section is corrupted";
+
+    // the section is produced for another version of the plugin or another configuration
+    if (hdr.version != expected.version ||
+        hdr.isa != expected.isa ||
+        hdr.enforceBF16 != expected.enforceBF16 ||
+        hdr.lpTransformsMode != expected.lpTransformsMode) {
+        skipSection();
+        return nullptr;
+    }
+
+    auto state = std::make_shared<CompiledGraphState>();
+
+    uint64_t count = 0;
+    if (!readValue(istream, count))
+        IE_THROW(NetworkNotRead) << "The compiled graph section is corrupted";
+    for (uint64_t i = 0; i < count; i++) {
+        std::string name;
+        int32_t index = -1;
+        int64_t implType = 0;
+        if (!readString(istream, name) || !readValue(istream, index) || !readValue(istream, implType))
+            IE_THROW(NetworkNotRead) << "The compiled graph section is corrupted";
+        state->selectedDescriptors[name] = {index, static_cast<impl_desc_type>(implType)};
+    }
+
+    if (!readValue(istream, count))
+        IE_THROW(NetworkNotRead) << "The compiled graph section is corrupted";
+    for (uint64_t i = 0; i < count; i++) {
+        std::string name;
+        ConstantData constant;
+        uint64_t size = 0;
+        if (!readString(istream, name) || !readString(istream, constant.format) || !readValue(istream, size))
+            IE_THROW(NetworkNotRead) << "The compiled graph section is corrupted";
+        if (size > sectionSize)
+            IE_THROW(NetworkNotRead) << "The compiled graph section is corrupted";
+        std::shared_ptr<uint8_t> data(new uint8_t[size], std::default_delete<uint8_t[]>());
+        if (!istream.read(reinterpret_cast<char*>(data.get()), size))
+            IE_THROW(NetworkNotRead) << "The compiled graph section is corrupted";
+        constant.data = std::move(data);
+        constant.size = size;
+        state->constants.emplace(std::move(name), std::move(constant));
+    }
+
+    if (istream.tellg() - sectionEnd > 0)
+        IE_THROW(NetworkNotRead) << "The compiled graph section is corrupted";
+    skipSection();
+
+    return state;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -3,9 +3,12 @@
 //
 #pragma once
 #include "extension_mngr.h"
+#include "config.h"
+#include "onednn/iml_type_mapper.h"
 
 #include <iostream>
 #include <functional>
+#include <unordered_map>
 #include <cpp/ie_cnn_network.h>
 
 namespace ov {
@@ -37,5 +40,41 @@ private:
 
 // const std::string& model, const Blob::CPtr& weights
 
+/**
+ * @brief Compilation results of the CPU graph which are stored in the exported blob right after the model.
+ * They allow to skip the primitive descriptors selection and the constant subgraphs execution on import.
+ * The section is versioned and bound to the CPU ISA and the precision related config, any mismatch
+ * makes the import fall back to the full graph compilation.
+ */
+struct CompiledGraphState {
+    typedef std::shared_ptr<CompiledGraphState> Ptr;
+    typedef std::shared_ptr<const CompiledGraphState> CPtr;
+
+    struct SelectedDescriptor {
+        int index;
+        impl_desc_type implType;
+    };
+
+    struct ConstantData {
+        std::string format;
+        // owned by the state which is read from the blob, the state taken from the graph shares the graph memory
+        std::shared_ptr<const uint8_t> data;
+        size_t size;
+    };
+
+    // node name -> selected primitive descriptor
+    std::unordered_map<std::string, SelectedDescriptor> selectedDescriptors;
+    // edge name -> constant data (e.g. weights reordered to the blocked layout) consumed by non constant nodes
+    std::unordered_map<std::string, ConstantData> constants;
+
+    void write(std::ostream& ostream, const Config& config) const;
+    /**
+     * @brief Reads the section from the current stream position
+     * @return nullptr if the stream has no compatible compiled graph section. The stream is left at the
+     * end of the section if it is present and at the initial position otherwise.
+     */
+    static Ptr read(std::istream& istream, const Config& config);
+};
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -0,0 +1,178 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_utils.hpp"
+#include "general_utils.h"
+
+#include <ie_parallel.hpp>
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace InferenceEngine;
+
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+
+size_t getPageSize() {
+#if defined(__linux__)
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return pageSize;
+#else
+    return 4096;
+#endif
+}
+
+#if defined(__linux__) && defined(SYS_mbind)
+// the memory must be page aligned and not shared with other allocations, since the policy is applied to whole pages
+bool bindToNumaNode(void* ptr, size_t size, int numaNodeId) {
+    constexpr size_t maskBits = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> nodeMask(numaNodeId / maskBits + 1, 0);
+    nodeMask[numaNodeId / maskBits] |= 1ul << (numaNodeId % maskBits);
+
+    // the kernel treats maxnode as the number of mask bits plus one
+    return syscall(SYS_mbind, ptr, size, MPOL_PREFERRED, nodeMask.data(), nodeMask.size() * maskBits + 1, 0) == 0;
+}
+#endif
+
+}   // namespace
+
+void* allocateOnNumaNode(size_t size, int numaNodeId) {
+#if defined(__linux__) && defined(SYS_mbind)
+    if (size == 0 || numaNodeId < 0)
+        return nullptr;
+
+    // the pages are mapped for the buffer only, so the policy doesn't affect other objects and is dropped on unmap
+    const auto mappedSize = rnd_up(size, getPageSize());
+    void* ptr = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+    if (!bindToNumaNode(ptr, mappedSize, numaNodeId)) {
+        munmap(ptr, mappedSize);
+        return nullptr;
+    }
+    firstTouch(ptr, mappedSize);
+    return ptr;
+#else
+    return nullptr;
+#endif
+}
+
+void freeOnNumaNode(void* ptr, size_t size) {
+#if defined(__linux__)
+    if (ptr != nullptr)
+        munmap(ptr, rnd_up(size, getPageSize()));
+#endif
+}
+
+void* NumaMemoryAllocator::alloc(size_t size) noexcept {
+    try {
+        void* ptr = allocateOnNumaNode(size, _numaNodeId);
+        const bool onNumaNode = ptr != nullptr;
+        if (!onNumaNode)
+            ptr = new char[size];
+        std::lock_guard<std::mutex> lock(_mutex);
+        _allocations[ptr] = {size, onNumaNode};
+        return ptr;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+bool NumaMemoryAllocator::free(void* handle) noexcept {
+    Allocation allocation;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _allocations.find(handle);
+        if (it == _allocations.end())
+            return false;
+        allocation = it->second;
+        _allocations.erase(it);
+    }
+    if (allocation.onNumaNode) {
+        freeOnNumaNode(handle, allocation.size);
+    } else {
+        delete[] static_cast<char*>(handle);
+    }
+    return true;
+}
+
+void firstTouch(void* ptr, size_t size) {
+    if (ptr == nullptr || size == 0)
+        return;
+
+    const auto pageSize = getPageSize();
+    auto data = static_cast<volatile uint8_t*>(ptr);
+    // offset of the first page start inside the buffer, the partially covered first page is touched separately
+    const size_t offset = (pageSize - reinterpret_cast<uintptr_t>(ptr) % pageSize) % pageSize;
+    data[0] = data[0];
+    if (offset >= size)
+        return;
+
+    // the data is rewritten with the same value, so the buffer content is preserved
+    parallel_for(div_up(size - offset, pageSize), [&](size_t page) {
+        const size_t idx = offset + page * pageSize;
+        data[idx] = data[idx];
+    });
+}
+
+std::map<int, uint64_t> getNumaPlacement(const std::vector<std::pair<const void*, size_t>>& buffers) {
+    std::map<int, uint64_t> placement;
+#if defined(__linux__) && defined(SYS_move_pages)
+    const auto pageSize = getPageSize();
+
+    // page aligned ranges are merged, so the overlapping buffers (e.g. views on one workspace) are counted once
+    std::vector<std::pair<uintptr_t, uintptr_t>> ranges;
+    for (const auto& buffer : buffers) {
+        if (buffer.first == nullptr || buffer.second == 0)
+            continue;
+        const auto begin = reinterpret_cast<uintptr_t>(buffer.first);
+        ranges.emplace_back(begin & ~(pageSize - 1), rnd_up(begin + buffer.second, pageSize));
+    }
+    std::sort(ranges.begin(), ranges.end());
+
+    constexpr size_t pagesPerQuery = 4096;
+    std::vector<void*> pages;
+    std::vector<int> status;
+    pages.reserve(pagesPerQuery);
+    auto query = [&]() {
+        status.assign(pages.size(), 0);
+        // without the target nodes move_pages only reports the node of every page
+        if (syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0) != 0)
+            return false;
+        for (auto nodeId : status) {
+            placement[nodeId >= 0 ? nodeId : -1] += pageSize;
+        }
+        pages.clear();
+        return true;
+    };
+
+    uintptr_t queried = 0;
+    for (const auto& range : ranges) {
+        for (auto page = std::max(range.first, queried); page < range.second; page += pageSize) {
+            pages.push_back(reinterpret_cast<void*>(page));
+            if (pages.size() == pagesPerQuery && !query())
+                return {};
+        }
+        queried = std::max(queried, range.second);
+    }
+    if (!pages.empty() && !query())
+        return {};
+#endif
+    return placement;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <ie_allocator.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Maps the memory pages for the buffer only and sets their preferred NUMA node, so the memory policy doesn't
+ *        affect other allocations and is released with the buffer. The pages are touched right away
+ * @param size - size of the memory in bytes
+ * @param numaNodeId - id of the NUMA node, negative values mean no preference
+ * @return page aligned memory, nullptr if the memory policy can't be applied (non Linux, single NUMA node)
+ */
+void* allocateOnNumaNode(size_t size, int numaNodeId);
+
+/**
+ * @brief Frees the memory allocated with allocateOnNumaNode
+ * @param ptr - pointer returned by allocateOnNumaNode
+ * @param size - size of the memory in bytes passed to allocateOnNumaNode
+ */
+void freeOnNumaNode(void* ptr, size_t size);
+
+/**
+ * @brief Blob allocator which places the memory on the NUMA node, falls back to the system memory if the memory
+ *        can't be bound
+ */
+class NumaMemoryAllocator : public InferenceEngine::IAllocator {
+public:
+    explicit NumaMemoryAllocator(int numaNodeId) : _numaNodeId(numaNodeId) {}
+
+    void* lock(void* handle, InferenceEngine::LockOp = InferenceEngine::LOCK_FOR_WRITE) noexcept override {
+        return handle;
+    }
+    void unlock(void* handle) noexcept override {}
+    void* alloc(size_t size) noexcept override;
+    bool free(void* handle) noexcept override;
+
+private:
+    struct Allocation {
+        size_t size;
+        bool onNumaNode;
+    };
+
+    int _numaNodeId;
+    std::mutex _mutex;
+    std::unordered_map<void*, Allocation> _allocations;
+};
+
+/**
+ * @brief Writes every memory page of the buffer, so the pages are allocated right away by the calling threads
+ *        instead of the first thread which accesses them during inference
+ */
+void firstTouch(void* ptr, size_t size);
+
+/**
+ * @brief Counts resident bytes of the buffers per NUMA node, a page shared by several buffers is counted once.
+ *        The bytes which are not resident yet are reported with -1 node id
+ * @param buffers - pairs of memory pointer and size in bytes
+ * @return NUMA node id to the number of bytes map, empty if the placement can't be queried
+ */
+std::map<int, uint64_t> getNumaPlacement(const std::vector<std::pair<const void*, size_t>>& buffers);
+
+}   // namespace intel_cpu
+}   // namespace ov
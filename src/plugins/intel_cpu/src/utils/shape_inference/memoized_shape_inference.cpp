@@ -0,0 +1,107 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memoized_shape_inference.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <common/primitive_hashing_utils.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// data dependent inputs are usually tiny shape-like tensors, larger ones are not worth keeping in the key
+constexpr size_t maxKeyDataSize = 1024;
+}   // namespace
+
+MemoizedShapeInfer::MemoizedShapeInfer(std::shared_ptr<IShapeInfer> impl, size_t capacity)
+    : m_impl(std::move(impl)), m_cache(capacity) {}
+
+std::vector<StaticShape> MemoizedShapeInfer::infer(
+    const std::vector<StaticShape>& input_shapes,
+    const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) {
+    m_last.reset();
+    return m_impl->infer(input_shapes, constant_data);
+}
+
+const ov::CoordinateDiff& MemoizedShapeInfer::get_pads_begin() {
+    return m_last ? m_last->pads_begin : m_impl->get_pads_begin();
+}
+
+const ov::CoordinateDiff& MemoizedShapeInfer::get_pads_end() {
+    return m_last ? m_last->pads_end : m_impl->get_pads_end();
+}
+
+bool MemoizedShapeInfer::has_pads() const {
+    return m_impl->has_pads();
+}
+
+const std::vector<int64_t>& MemoizedShapeInfer::get_input_ranks() {
+    return m_impl->get_input_ranks();
+}
+
+void MemoizedShapeInfer::resetKey() {
+    m_key.data.clear();
+    m_key.seed = 0;
+    m_key_valid = 0 != m_cache.getCapacity();
+}
+
+void MemoizedShapeInfer::appendDims(const VectorDims& dims) {
+    using namespace dnnl::impl;
+
+    if (!m_key_valid)
+        return;
+    m_key.data.push_back(dims.size());
+    m_key.seed = hash_combine(m_key.seed, dims.size());
+    for (const auto dim : dims) {
+        m_key.data.push_back(dim);
+        m_key.seed = hash_combine(m_key.seed, dim);
+    }
+}
+
+void MemoizedShapeInfer::appendData(const void* data, size_t size) {
+    using namespace dnnl::impl;
+
+    if (!m_key_valid)
+        return;
+    if (size > maxKeyDataSize) {
+        m_key_valid = false;
+        return;
+    }
+    m_key.data.push_back(size);
+    m_key.seed = hash_combine(m_key.seed, size);
+    const auto bytes = static_cast<const uint8_t*>(data);
+    for (size_t offset = 0; offset < size; offset += sizeof(size_t)) {
+        size_t word = 0;
+        std::memcpy(&word, bytes + offset, std::min(sizeof(size_t), size - offset));
+        m_key.data.push_back(word);
+        m_key.seed = hash_combine(m_key.seed, word);
+    }
+}
+
+const std::vector<VectorDims>* MemoizedShapeInfer::find() {
+    if (!m_key_valid)
+        return nullptr;
+    auto record = m_cache.get(m_key);
+    if (!record)
+        return nullptr;
+    m_last = std::move(record);
+    return &m_last->output_shapes;
+}
+
+void MemoizedShapeInfer::store(const std::vector<VectorDims>& output_shapes) {
+    if (!m_key_valid)
+        return;
+    auto record = std::make_shared<Record>();
+    record->output_shapes = output_shapes;
+    if (m_impl->has_pads()) {
+        record->pads_begin = m_impl->get_pads_begin();
+        record->pads_end = m_impl->get_pads_end();
+    }
+    m_cache.put(m_key, record);
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
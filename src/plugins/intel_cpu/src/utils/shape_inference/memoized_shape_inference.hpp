@@ -0,0 +1,84 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "shape_inference.hpp"
+#include "cache/lru_cache.h"
+#include "cpu_types.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Shape inference decorator that remembers the output shapes of the recently seen inputs.
+ * The lookup key is built in place from the input dims and the raw bytes of the data dependent inputs, so a cache hit
+ * neither wraps the input memory into HostTensors nor calls the underlying shape inference.
+ * The padding by-products of the wrapped shape inference are cached together with the output shapes.
+ *
+ * Usage: resetKey(), append the dims of all the inputs and the values of the data dependent inputs, then find().
+ * On miss, infer() and store() the result under the same key.
+ *
+ * @note Not thread safe, the instance belongs to a single node.
+ */
+class MemoizedShapeInfer : public IShapeInfer {
+public:
+    MemoizedShapeInfer(std::shared_ptr<IShapeInfer> impl, size_t capacity);
+
+    /**
+     * @brief Calls the wrapped shape inference directly, the result is not cached
+     */
+    std::vector<StaticShape> infer(
+        const std::vector<StaticShape>& input_shapes,
+        const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override;
+
+    const ov::CoordinateDiff& get_pads_begin() override;
+    const ov::CoordinateDiff& get_pads_end() override;
+    bool has_pads() const override;
+    const std::vector<int64_t>& get_input_ranks() override;
+
+    void resetKey();
+    void appendDims(const VectorDims& dims);
+    void appendData(const void* data, size_t size);
+
+    /**
+     * @brief Searches the output shapes for the key built since the last resetKey()
+     * @return pointer to the cached output shapes, or nullptr if the key is not cached
+     */
+    const std::vector<VectorDims>* find();
+
+    /**
+     * @brief Stores the output shapes and the padding of the last infer() call under the key built since the last resetKey()
+     */
+    void store(const std::vector<VectorDims>& output_shapes);
+
+private:
+    struct Key {
+        size_t hash() const {
+            return seed;
+        }
+        bool operator==(const Key& rhs) const {
+            return seed == rhs.seed && data == rhs.data;
+        }
+
+        std::vector<size_t> data;
+        size_t seed = 0;
+    };
+
+    struct Record {
+        std::vector<VectorDims> output_shapes;
+        ov::CoordinateDiff pads_begin, pads_end;
+    };
+
+    std::shared_ptr<IShapeInfer> m_impl;
+    LruCache<Key, std::shared_ptr<Record>> m_cache;
+    // reused between the lookups, so building the key does not allocate once the buffer has grown
+    Key m_key;
+    bool m_key_valid = true;
+    // the record of the last lookup hit, the padding is taken from it instead of the wrapped shape inference
+    std::shared_ptr<Record> m_last;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
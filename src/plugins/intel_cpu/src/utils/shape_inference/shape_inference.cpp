@@ -299,6 +299,9 @@ public:
     const ov::CoordinateDiff& get_pads_end() override {
         return pads_end;
     }
+    bool has_pads() const override {
+        return true;
+    }
 
     void post_validate_and_infer_types(const std::shared_ptr<ov::Node>& local_op) override {
         auto node = dynamic_cast<OP*>(local_op.get());
@@ -335,6 +338,9 @@ public:
     const ov::CoordinateDiff& get_pads_end() override {
         return pads_end;
     }
+    bool has_pads() const override {
+        return true;
+    }
     std::vector<StaticShape> infer(
         const std::vector<StaticShape>& input_shapes,
         const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
@@ -362,6 +368,9 @@ public:
     const ov::CoordinateDiff& get_pads_end() override {
         return pads_end;
     }
+    bool has_pads() const override {
+        return true;
+    }
     std::vector<StaticShape> infer(
         const std::vector<StaticShape>& input_shapes,
         const std::map<size_t, std::shared_ptr<ngraph::runtime::HostTensor>>& constant_data) override {
@@ -27,6 +27,9 @@ public:
     // infer may generate padding as by-product, these APIs is designed to retrieve them back
     virtual const ov::CoordinateDiff& get_pads_begin() = 0;
     virtual const ov::CoordinateDiff& get_pads_end() = 0;
+    virtual bool has_pads() const {
+        return false;
+    }
 
     virtual const std::vector<int64_t>& get_input_ranks() = 0;
 };
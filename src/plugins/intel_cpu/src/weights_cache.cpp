@@ -3,15 +3,111 @@
 //
 
 #include "weights_cache.hpp"
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include "utils/general_utils.h"
 
+#include <common/primitive_hashing_utils.hpp>
+#include <ie_parallel.hpp>
 #include <ie_system_conf.h>
+#include <algorithm>
+#include <cstring>
 #include <memory>
+#include <vector>
+
+using namespace InferenceEngine;
 
 namespace ov {
 namespace intel_cpu {
 
 const SimpleDataHash WeightsSharing::simpleCRC;
 
+MemoryPtr ProcessWeightsSharing::findOrCreate(const std::string& key,
+                                              const std::shared_ptr<const void>& source,
+                                              size_t size,
+                                              std::function<MemoryPtr(void)> create) {
+    MemoryInfo::Ptr ptr;
+    {
+        std::unique_lock<std::mutex> lock(guard);
+        auto found = sharedWeights.find(key);
+        if (found == sharedWeights.end()) {
+            // the entries of the released objects are dropped once the store doubles in size
+            if (sharedWeights.size() >= 2 * sizeAfterCleanup) {
+                for (auto it = sharedWeights.begin(); it != sharedWeights.end();) {
+                    if (it->second.use_count() == 1 && it->second->sharedMemory.expired())
+                        it = sharedWeights.erase(it);
+                    else
+                        ++it;
+                }
+                sizeAfterCleanup = sharedWeights.size();
+            }
+            found = sharedWeights.emplace(key, std::make_shared<MemoryInfo>()).first;
+        }
+        ptr = found->second;
+    }
+
+    // the objects are created under the entry lock only, so the models don't wait for the unrelated weights
+    std::unique_lock<std::mutex> lock(ptr->guard);
+    auto sharedMemory = ptr->sharedMemory.lock();
+    // the key is built from the data hash, so the objects are shared only if their content is the same
+    bool same = false;
+    MemoryPtr memory;
+    if (sharedMemory) {
+        auto sharedSource = ptr->source.lock();
+        if (sharedSource) {
+            same = ptr->sourceSize == size &&
+                   (sharedSource == source || std::memcmp(sharedSource.get(), source.get(), size) == 0);
+        } else {
+            // the source of the stored object is gone, so the created object is compared with it
+            memory = create();
+            same = sharedMemory->GetSize() == memory->GetSize() &&
+                   std::memcmp(sharedMemory->GetData(), memory->GetData(), memory->GetSize()) == 0;
+            if (same) {
+                ptr->source = source;
+                ptr->sourceSize = size;
+            }
+        }
+    }
+    if (!same && !memory)
+        memory = create();
+    if (!sharedMemory) {
+        ptr->sharedMemory = memory;
+        ptr->source = source;
+        ptr->sourceSize = size;
+    }
+
+    std::unique_lock<std::mutex> statsLock(guard);
+    if (same) {
+        hits++;
+        savedBytes += sharedMemory->GetSize();
+        return sharedMemory;
+    }
+    misses++;
+    return memory;
+}
+
+std::map<std::string, uint64_t> ProcessWeightsSharing::getStatistics() const {
+    std::unique_lock<std::mutex> lock(guard);
+    uint64_t storedBytes = 0;
+    for (const auto& entry : sharedWeights) {
+        if (auto memory = entry.second->sharedMemory.lock())
+            storedBytes += memory->GetSize();
+    }
+    return {{"hits", hits}, {"misses", misses}, {"saved_bytes", savedBytes}, {"stored_bytes", storedBytes}};
+}
+
+ProcessWeightsSharing::Ptr getProcessWeightsSharing() {
+    static std::mutex mutex;
+    static std::weak_ptr<ProcessWeightsSharing> weakStore;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto store = weakStore.lock();
+    if (!store) {
+        store = std::make_shared<ProcessWeightsSharing>();
+        weakStore = store;
+    }
+    return store;
+}
+
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MemoryInfo::Ptr & memory,
@@ -55,6 +151,39 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
+MemoryPtr WeightsSharing::findOrCreateConstant(const std::string& key,
+                                               const std::shared_ptr<const void>& data,
+                                               size_t size,
+                                               const MemoryDescPtr& srcDesc,
+                                               const MemoryDescPtr& dstDesc,
+                                               std::function<MemoryPtr(void)> create) {
+    if (!processWeights)
+        return *findOrCreate(key, create);
+
+    auto createShared = [&]() {
+        using namespace dnnl::impl::primitive_hashing;
+
+        // the chunks are hashed in parallel and the chunk sums are hashed once more
+        constexpr size_t chunkSize = 1 << 20;
+        const auto src = static_cast<const unsigned char*>(data.get());
+        std::vector<uint64_t> sums(div_up(size, chunkSize));
+        parallel_for(sums.size(), [&](size_t i) {
+            sums[i] = simpleCRC.hash(src + i * chunkSize, std::min(chunkSize, size - i * chunkSize));
+        });
+        const auto dataHash = simpleCRC.hash(reinterpret_cast<const unsigned char*>(sums.data()), sums.size() * sizeof(uint64_t));
+
+        const std::string sharedKey = std::to_string(numaNodeId)
+                                      + "_" + std::to_string(size)
+                                      + "_" + std::to_string(dataHash)
+                                      + "_" + std::to_string(get_md_hash(MemoryDescUtils::convertToDnnlMemoryDesc(srcDesc)->getDnnlDesc().data))
+                                      + "_" + std::to_string(get_md_hash(MemoryDescUtils::convertToDnnlMemoryDesc(dstDesc)->getDnnlDesc().data));
+
+        return processWeights->findOrCreate(sharedKey, data, size, create);
+    };
+
+    return *findOrCreate(key, createShared);
+}
+
 WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) const {
     MemoryInfo::Ptr ptr;
     MemoryPtr newPtr;
@@ -71,9 +200,9 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
-NumaNodesWeights::NumaNodesWeights() {
+NumaNodesWeights::NumaNodesWeights(const ProcessWeightsSharing::Ptr& processWeights) {
     for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<WeightsSharing>();
+        _cache_map[numa_id] = std::make_shared<WeightsSharing>(processWeights, numa_id);
 }
 
 WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
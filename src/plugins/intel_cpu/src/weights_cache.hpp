@@ -5,6 +5,7 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "memory_desc/cpu_memory_desc.h"
 
 #include <unordered_map>
 #include <functional>
@@ -47,6 +48,63 @@ protected:
     uint64_t table[kTableSize];
 };
 
+/**
+ * Caching store of constant Memory objects shared by all the compiled models of the process
+ * The objects are keyed by the hash of the source data and the memory descriptors, so identical constants
+ * of the different models (e.g. the same model compiled several times or the variants sharing a backbone)
+ * are stored once. The store doesn't own the objects, they are released with the last graph using them
+ *
+ * Is a thread safe
+ */
+class ProcessWeightsSharing {
+    struct MemoryInfo {
+        typedef std::shared_ptr<MemoryInfo> Ptr;
+
+        std::mutex guard;
+        std::weak_ptr<Memory> sharedMemory;
+        // the source data the stored object was created from, it is checked instead of creating a new object
+        std::weak_ptr<const void> source;
+        size_t sourceSize = 0;
+    };
+
+public:
+    typedef std::shared_ptr<ProcessWeightsSharing> Ptr;
+
+    /**
+     * @brief Returns the stored object or the created one. The stored object is returned only if its source data
+     *        has the same bytes, so the key collisions don't mix up the weights of the models. When the source data
+     *        of the stored object is released, the object is created and the stored one is returned only if their
+     *        bytes are the same
+     * @param key - key of the object
+     * @param source - source data of the object, the store keeps a weak reference to it
+     * @param size - size of the source data in bytes
+     * @param create - creates the object
+     */
+    MemoryPtr findOrCreate(const std::string& key,
+                           const std::shared_ptr<const void>& source,
+                           size_t size,
+                           std::function<MemoryPtr(void)> create);
+
+    /**
+     * @brief Returns the number of the objects served from the store ("hits") and created ("misses"),
+     *        the bytes not allocated thanks to the hits ("saved_bytes") and the bytes of the alive objects ("stored_bytes")
+     */
+    std::map<std::string, uint64_t> getStatistics() const;
+
+protected:
+    mutable std::mutex guard;
+    std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    size_t sizeAfterCleanup = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t savedBytes = 0;
+};
+
+/**
+ * @brief Returns the store shared by the compiled models of the process, it exists while any of them is alive
+ */
+ProcessWeightsSharing::Ptr getProcessWeightsSharing();
+
 /**
  * Caching store of Memory objects
  * Will return a cached object or create new one
@@ -70,6 +128,9 @@ class WeightsSharing {
 public:
     typedef std::shared_ptr<WeightsSharing> Ptr;
 
+    explicit WeightsSharing(ProcessWeightsSharing::Ptr processWeights = nullptr, int numaNodeId = -1)
+        : processWeights(std::move(processWeights)), numaNodeId(numaNodeId) {}
+
     class SharedMemory {
     public:
         typedef std::shared_ptr<SharedMemory> Ptr;
@@ -92,13 +153,34 @@ public:
                                    std::function<MemoryPtr(void)> create,
                                    bool valid = true);
 
+    /**
+     * @brief Returns the cached constant memory object or creates a new one. When the weights are shared by the process,
+     *        the memory created by the other compiled models from the same data for the same descriptors is reused
+     * @param key - key of the object within the model
+     * @param data - source data of the object, shares the ownership of the object holding the data
+     * @param size - size of the source data in bytes
+     * @param srcDesc - descriptor of the source data
+     * @param dstDesc - descriptor of the created object
+     * @param create - creates the object
+     */
+    MemoryPtr findOrCreateConstant(const std::string& key,
+                                   const std::shared_ptr<const void>& data,
+                                   size_t size,
+                                   const MemoryDescPtr& srcDesc,
+                                   const MemoryDescPtr& dstDesc,
+                                   std::function<MemoryPtr(void)> create);
+
     SharedMemory::Ptr get(const std::string& key) const;
 
+    const ProcessWeightsSharing::Ptr& getProcessWeights() const { return processWeights; }
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    ProcessWeightsSharing::Ptr processWeights;
+    int numaNodeId;
     static const SimpleDataHash simpleCRC;
 };
 
@@ -109,7 +191,7 @@ protected:
  */
 class NumaNodesWeights {
 public:
-    NumaNodesWeights();
+    explicit NumaNodesWeights(const ProcessWeightsSharing::Ptr& processWeights = nullptr);
 
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
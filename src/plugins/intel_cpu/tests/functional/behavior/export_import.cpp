@@ -62,4 +62,56 @@ TEST(ExportImportTest, ExportOptimalNumStreams) {
         EXPECT_EQ(nstreams_latency_original, nstreams_latency_imported);
     }
 }
+
+TEST(ExportImportTest, ImportRestoresCompiledGraph) {
+    auto original_model = MakeMatMulModel();
+    std::string deviceName = "CPU";
+    ov::Core core;
+
+    auto original_network = core.compile_model(original_model, deviceName);
+
+    ov::Tensor input(ov::element::f32, original_network.input().get_shape());
+    auto input_data = input.data<float>();
+    for (size_t i = 0; i < input.get_size(); i++)
+        input_data[i] = static_cast<float>(i % 17) / 17.f;
+
+    auto original_request = original_network.create_infer_request();
+    original_request.set_input_tensor(input);
+    original_request.infer();
+    auto original_output = original_request.get_output_tensor();
+
+    std::stringstream exported_stream;
+    original_network.export_model(exported_stream);
+
+    std::stringstream ss(exported_stream.str());
+    auto imported_network = core.import_model(ss, deviceName);
+
+    auto imported_request = imported_network.create_infer_request();
+    imported_request.set_input_tensor(input);
+    imported_request.infer();
+    auto imported_output = imported_request.get_output_tensor();
+
+    ASSERT_EQ(original_output.get_shape(), imported_output.get_shape());
+    const auto original_data = original_output.data<float>();
+    const auto imported_data = imported_output.data<float>();
+    for (size_t i = 0; i < original_output.get_size(); i++)
+        EXPECT_EQ(original_data[i], imported_data[i]);
+
+    // the imported graph takes the primitive descriptors and the constants from the compiled graph section
+    auto getImplTypes = [](const ov::CompiledModel& network) {
+        std::map<std::string, std::string> implTypes;
+        for (const auto& node : network.get_runtime_model()->get_ops())
+            implTypes[node->get_friendly_name()] = node->get_rt_info().at("primitiveType").as<std::string>();
+        return implTypes;
+    };
+    auto countRestored = [](const ov::CompiledModel& network) {
+        size_t restored = 0;
+        for (const auto& node : network.get_runtime_model()->get_ops())
+            restored += node->get_rt_info().count("restoredFromCompiledState");
+        return restored;
+    };
+    EXPECT_EQ(getImplTypes(original_network), getImplTypes(imported_network));
+    EXPECT_EQ(0u, countRestored(original_network));
+    EXPECT_EQ(imported_network.get_runtime_model()->get_ops().size(), countRestored(imported_network));
+}
 }  // namespace
@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/any.hpp"
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/exception.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <algorithm>
+
+namespace {
+
+class InferRequestPropertiesTest : public CommonTestUtils::TestsCommon {};
+
+// takes a few milliseconds on a single thread, so the requests started together wait for each other
+std::shared_ptr<ov::Model> MakeHeavyMatMulModel() {
+    const ov::Shape input_shape = {64, 4096};
+    const ov::element::Type precision = ov::element::f32;
+
+    auto params = ngraph::builder::makeParams(precision, {input_shape});
+    auto matmul_const = ngraph::builder::makeConstant(precision, {4096, 1024}, std::vector<float>{}, true);
+    auto matmul = ngraph::builder::makeMatMul(params[0], matmul_const);
+
+    ngraph::NodeVector results{matmul};
+    return std::make_shared<ov::Model>(results, params, "HeavyMatMulModel");
+}
+
+ov::CompiledModel CompileSingleStream(ov::Core& core) {
+    return core.compile_model(MakeHeavyMatMulModel(), "CPU", ov::num_streams(1), ov::inference_num_threads(1));
+}
+
+TEST(InferRequestPropertiesTest, SetAndGetHints) {
+    ov::Core core;
+    auto compiled_model = CompileSingleStream(core);
+    auto request = compiled_model.create_infer_request();
+
+    auto supported_properties = request.get_property(ov::supported_properties);
+    for (const auto& name : {ov::hint::request_priority.name(),
+                             ov::hint::request_deadline.name(),
+                             ov::request_queue_wait_time.name()}) {
+        EXPECT_NE(supported_properties.end(),
+                  std::find(supported_properties.begin(), supported_properties.end(), name)) << name;
+    }
+
+    EXPECT_EQ(ov::hint::Priority::MEDIUM, request.get_property(ov::hint::request_priority));
+    EXPECT_EQ(0u, request.get_property(ov::hint::request_deadline));
+
+    request.set_property({ov::hint::request_priority(ov::hint::Priority::HIGH), ov::hint::request_deadline(100)});
+    EXPECT_EQ(ov::hint::Priority::HIGH, request.get_property(ov::hint::request_priority));
+    EXPECT_EQ(100u, request.get_property(ov::hint::request_deadline));
+
+    ASSERT_THROW(request.set_property({{"UNSUPPORTED_PROPERTY", 1}}), ov::Exception);
+    ASSERT_THROW(request.set_property({{ov::request_queue_wait_time.name(), 1}}), ov::Exception);
+    ASSERT_THROW(request.get_property("UNSUPPORTED_PROPERTY"), ov::Exception);
+}
+
+TEST(InferRequestPropertiesTest, QueueWaitTimeOfWaitingRequest) {
+    ov::Core core;
+    auto compiled_model = CompileSingleStream(core);
+    std::vector<ov::InferRequest> requests;
+    for (int i = 0; i < 4; i++)
+        requests.push_back(compiled_model.create_infer_request());
+
+    for (auto& request : requests)
+        request.start_async();
+    for (auto& request : requests)
+        request.wait();
+
+    // the only stream executes the requests one by one, so the last one waits for the others
+    EXPECT_GT(requests.back().get_property(ov::request_queue_wait_time), 0u);
+}
+
+TEST(InferRequestPropertiesTest, RequestMissedDeadlineIsCancelled) {
+    ov::Core core;
+    auto compiled_model = CompileSingleStream(core);
+    std::vector<ov::InferRequest> requests;
+    for (int i = 0; i < 4; i++)
+        requests.push_back(compiled_model.create_infer_request());
+    auto late_request = compiled_model.create_infer_request();
+    late_request.set_property({ov::hint::request_priority(ov::hint::Priority::LOW), ov::hint::request_deadline(1)});
+    auto in_time_request = compiled_model.create_infer_request();
+    in_time_request.set_property({ov::hint::request_deadline(60000)});
+
+    for (auto& request : requests)
+        request.start_async();
+    late_request.start_async();
+    in_time_request.start_async();
+
+    for (auto& request : requests)
+        ASSERT_NO_THROW(request.wait());
+    ASSERT_NO_THROW(in_time_request.wait());
+    ASSERT_THROW(late_request.wait(), ov::Cancelled);
+    EXPECT_GT(late_request.get_property(ov::request_queue_wait_time), 1000u);
+
+    // the deadline is counted from the start, so the request is executed when it's started on the idle stream
+    late_request.set_property({ov::hint::request_deadline(60000)});
+    late_request.start_async();
+    ASSERT_NO_THROW(late_request.wait());
+}
+
+}  // namespace
@@ -77,7 +77,16 @@ protected:
         size_t numSegments, defaultIndex;
         std::tie(inputShapes, indices, segmentIds, numSegments, defaultIndex, withWeights, withDefIndex) = embParams;
 
-        selectedType = makeSelectedTypeStr("ref", inType);
+        // bf16 table is converted to fp32 on the platforms without avx512_core
+        const auto tablePrecision = inType == ElementType::bf16 && !InferenceEngine::with_cpu_x86_avx512_core() ? ElementType::f32 : inType;
+        if ((tablePrecision == ElementType::f32 || tablePrecision == ElementType::bf16) && InferenceEngine::with_cpu_x86_avx2()) {
+            selectedType = makeSelectedTypeStr(InferenceEngine::with_cpu_x86_avx512_core() ? "jit_avx512" : "jit_avx2", tablePrecision);
+        } else {
+            selectedType = makeSelectedTypeStr("ref", tablePrecision);
+        }
+        if (inType == ElementType::bf16) {
+            rel_threshold = 1e-2;
+        }
         targetDevice = CommonTestUtils::DEVICE_CPU;
 
         init_input_shapes({ inputShapes });
@@ -109,6 +118,7 @@ TEST_P(EmbeddingSegmentsSumLayerCPUTest, CompareWithRefs) {
 namespace {
 const std::vector<ElementType> netPrecisions = {
         ElementType::f32,
+        ElementType::bf16,
         ElementType::i32,
         ElementType::u8
 };
@@ -361,6 +361,64 @@ protected:
     }
 };
 
+class LoopForLongConcatLayerCPUTest : public LoopLayerCPUTest {
+    // for trip_count:
+    //   y = y + x
+    //   ys = concat(ys, y)
+    //   return y, ys
+    // the concatenation buffer grows several times and the body writes to it in place
+
+protected:
+    void SetUp() override {
+        InputLayerType trip_count_type;
+        int64_t trip_count;
+        bool exec_cond;
+        std::vector<InputShape> shapes;
+        std::vector<LOOP_IN_TYPE> types;
+        std::tie(trip_count_type, trip_count, exec_cond, shapes, types, inType) = this->GetParam();
+
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        init_input_shapes(shapes);
+
+        auto params = ngraph::builder::makeDynamicParams(inType, inputDynamicShapes);
+        auto body_params = ngraph::builder::makeDynamicParams(inType, inputDynamicShapes);
+
+        auto body_condition_const = std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, true);
+        auto exec_condition = std::make_shared<ngraph::opset5::Constant>(ngraph::element::boolean, ngraph::Shape{1}, exec_cond);
+        std::shared_ptr<ngraph::Node> trip_count_input;
+        int shift = 0;
+        if (trip_count_type == InputLayerType::PARAMETER) {
+            for (auto& target : targetStaticShapes)
+                target.insert(target.begin(), ngraph::Shape{});
+            trip_count_input = std::make_shared<ngraph::opset5::Parameter>(ngraph::element::i64, ngraph::Shape{1});
+            trip_count_input->set_friendly_name("trip_count");
+            params.insert(params.begin(), ov::as_type_ptr<ngraph::opset5::Parameter>(trip_count_input));
+            shift++;
+        } else {
+            trip_count_input = std::make_shared<ngraph::opset5::Constant>(ngraph::element::i64, ngraph::Shape{1}, trip_count);
+        }
+
+        // Body
+        auto add = std::make_shared<ngraph::opset5::Add>(body_params[0], body_params[1]);
+
+        auto body = std::make_shared<ov::Model>(ngraph::OutputVector{body_condition_const, add}, body_params);
+
+        auto loop = std::make_shared<ngraph::opset5::Loop>(trip_count_input, exec_condition);
+        loop->set_function(body);
+        loop->set_special_body_ports(ngraph::opset5::Loop::SpecialBodyPorts{-1, 0});
+
+        loop->set_invariant_input(body_params[0], params[shift]);
+        loop->set_merged_input(body_params[1], params[shift + 1], add);
+
+        auto out0 = loop->get_iter_value(add, -1);
+        auto out1 = loop->get_concatenated_slices(add, 0, 1, 1, -1, 0);
+
+        auto result0 = std::make_shared<ngraph::opset5::Result>(out0);
+        auto result1 = std::make_shared<ngraph::opset5::Result>(out1);
+        function = std::make_shared<ov::Model>(ngraph::ResultVector{result0, result1}, params, "loop");
+    }
+};
+
 TEST_P(LoopLayerCPUTest, CompareWithRefs) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
 
@@ -385,6 +443,12 @@ TEST_P(LoopForConcatLayerCPUTest, CompareWithRefs) {
     run();
 }
 
+TEST_P(LoopForLongConcatLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
 namespace {
 
 const std::vector<ElementType> inputPrecisions = {
@@ -598,5 +662,36 @@ INSTANTIATE_TEST_SUITE_P(smoke_LoopForConcat, LoopForConcatLayerCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          LoopLayerCPUTest::getTestCaseName);
 
+std::vector<std::vector<InputShape>> inputs_5 = {
+        {  // first test suit
+            {  // first input
+                {1, -1},
+                { // target static shapes
+                    {1, 10},
+                    {1, 3},
+                    {1, 10},
+                }
+            },
+            {  // second input
+                {1, -1},
+                { // target static shapes
+                    {1, 10},
+                    {1, 3},
+                    {1, 10},
+                }
+            },
+        },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_LoopForLongConcat, LoopForLongConcatLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(trip_count_type),
+                                 ::testing::Values(1, 100),
+                                 ::testing::Values(true),
+                                 ::testing::ValuesIn(inputs_5),
+                                 ::testing::Values(std::vector<LOOP_IN_TYPE>{}),
+                                 ::testing::Values(ElementType::f32)),
+                         LoopLayerCPUTest::getTestCaseName);
+
 }  // namespace
 } // namespace CPULayerTestsDefinitions
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ov::test;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *       Parameter
+ *        /     \
+ *    MatMul     |
+ *      |        |
+ *     Relu      |
+ *      |        |
+ *    MatMul     |
+ *      |        |
+ *   Softmax     |
+ *        \     /
+ *          Add
+ *           |
+ *         Result
+ */
+// The intermediate tensors are placed in the arena, the repeated shapes reuse the cached plans,
+// the growing shapes rebuild them
+
+class DynamicMemoryArenaTest : virtual public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_DYNAMIC_MEMORY_ARENA, PluginConfigParams::YES});
+
+        const size_t K = 16;
+        const InputShape inputShape = {{-1, K}, {{1, K}, {8, K}, {1, K}, {8, K}, {33, K}, {8, K}, {33, K}}};
+        init_input_shapes({inputShape});
+
+        const auto precision = ov::element::f32;
+        auto params = ngraph::builder::makeDynamicParams(precision, inputDynamicShapes);
+        auto matMul1 = ngraph::builder::makeMatMul(params[0], ngraph::builder::makeConstant<float>(precision, {K, 2 * K}, {}, true));
+        auto relu = std::make_shared<ov::op::v0::Relu>(matMul1);
+        auto matMul2 = ngraph::builder::makeMatMul(relu, ngraph::builder::makeConstant<float>(precision, {2 * K, K}, {}, true));
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(matMul2, 1);
+        auto add = std::make_shared<ov::op::v1::Add>(softmax, params[0]);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(add)}, params, "DynamicMemoryArena");
+    }
+};
+
+TEST_F(DynamicMemoryArenaTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+} // namespace SubgraphTestsDefinitions
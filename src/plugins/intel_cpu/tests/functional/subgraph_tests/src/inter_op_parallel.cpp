@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+
+using namespace ngraph;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph:
+/*
+ *                  Parameter
+ *            /         |          \
+ *      Convolution Convolution  Convolution
+ *           |          |          |
+ *          Relu        |        Sigmoid
+ *            \        /           |
+ *               Add               |
+ *                  \             /
+ *                      Concat
+ *                        |
+ *                      Result
+ */
+
+class InterOpParallelTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_INTER_OP_PARALLEL, PluginConfigParams::YES});
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 8, 16, 16}});
+
+        auto makeBranch = [&](size_t kernel) {
+            const ptrdiff_t pad = kernel / 2;
+            return builder::makeConvolution(inputParams[0], ngPrc, {kernel, kernel}, {1, 1}, {pad, pad}, {pad, pad},
+                                            {1, 1}, op::PadType::EXPLICIT, 16);
+        };
+
+        auto relu = std::make_shared<opset1::Relu>(makeBranch(1));
+        auto add = builder::makeEltwise(relu, makeBranch(3), helpers::EltwiseTypes::ADD);
+        auto sigmoid = std::make_shared<opset1::Sigmoid>(makeBranch(5));
+        auto concat = builder::makeConcat({add, sigmoid}, 1);
+
+        function = std::make_shared<Function>(ResultVector{std::make_shared<opset1::Result>(concat)}, inputParams, "InterOpParallel");
+    }
+};
+
+TEST_F(InterOpParallelTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+
+    // the independent branches are placed to the same stage of the execution
+    std::map<int, std::vector<std::string>> stages;
+    for (const auto& node : executableNetwork.GetExecGraphInfo().getFunction()->get_ops()) {
+        const auto& rtInfo = node->get_rt_info();
+        // the constant nodes are executed once on the graph creation
+        const auto stage = rtInfo.find("executionStage");
+        if (stage == rtInfo.end())
+            continue;
+        stages[std::stoi(stage->second.as<std::string>())].push_back(node->get_friendly_name());
+    }
+    ASSERT_FALSE(stages.empty());
+    ASSERT_TRUE(std::any_of(stages.begin(), stages.end(), [](const std::pair<const int, std::vector<std::string>>& stage) {
+        return stage.second.size() > 1;
+    }));
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,178 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/*
+ *        Constant [u8/i8/u4/i4]
+ *           |
+ *        Convert    zero point
+ *            \       /
+ *           [Subtract]   scale
+ *                \       /
+ *   Parameter    Multiply
+ *        \          |
+ *         \     [Reshape]
+ *          \      /
+ *           MatMul
+ *
+ * The weights decompression subgraph has to be fused into FullyConnected unless the data has too many rows
+ * for the weights-only compressed execution, then it is executed once as constant nodes.
+ */
+using MatMulWeightsDecompressionParams = std::tuple<InputShape,   // data shape, the last dimension is static
+                                                    size_t,       // output channels
+                                                    bool,         // transpose weights
+                                                    ElementType,  // compressed weights precision
+                                                    bool,         // with zero point
+                                                    size_t>;      // group size, 0 for per-channel decompression
+
+class MatMulWeightsDecompression : public testing::WithParamInterface<MatMulWeightsDecompressionParams>,
+                                   virtual public SubgraphBaseTest,
+                                   public CPUTestsBase {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<MatMulWeightsDecompressionParams> obj) {
+        InputShape inputShape;
+        size_t outputChannels;
+        bool transposeWeights;
+        ElementType weightsPrecision;
+        bool withZeroPoint;
+        size_t groupSize;
+        std::tie(inputShape, outputChannels, transposeWeights, weightsPrecision, withZeroPoint, groupSize) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << CommonTestUtils::partialShape2str({inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : inputShape.second) {
+            result << "(" << CommonTestUtils::vec2str(shape) << ")_";
+        }
+        result << "OC=" << outputChannels << "_";
+        result << "transposeWeights=" << transposeWeights << "_";
+        result << "weightsPRC=" << weightsPrecision << "_";
+        result << "zeroPoint=" << withZeroPoint << "_";
+        result << "groupSize=" << groupSize;
+
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape;
+        size_t N;
+        bool transposeWeights;
+        ElementType weightsPrecision;
+        bool withZeroPoint;
+        size_t groupSize;
+        std::tie(inputShape, N, transposeWeights, weightsPrecision, withZeroPoint, groupSize) = this->GetParam();
+
+        init_input_shapes({inputShape});
+        abs_threshold = 1e-2;
+
+        const size_t K = inputDynamicShapes[0].rbegin()->get_length();
+        const size_t groups = groupSize ? K / groupSize : 1;
+        ov::Shape weightsShape;
+        ov::Shape decompressionShape;
+        if (groupSize) {
+            weightsShape = transposeWeights ? ov::Shape{N, groups, groupSize} : ov::Shape{groups, groupSize, N};
+            decompressionShape = transposeWeights ? ov::Shape{N, groups, 1} : ov::Shape{groups, 1, N};
+        } else {
+            weightsShape = transposeWeights ? ov::Shape{N, K} : ov::Shape{K, N};
+            decompressionShape = transposeWeights ? ov::Shape{N, 1} : ov::Shape{1, N};
+        }
+
+        const bool isSigned = weightsPrecision == ElementType::i8 || weightsPrecision == ElementType::i4;
+        std::vector<int> weightsValues(ov::shape_size(weightsShape));
+        for (size_t i = 0; i < weightsValues.size(); i++) {
+            weightsValues[i] = static_cast<int>((i * 7 + 3) % 16) - (isSigned ? 8 : 0);
+        }
+        auto weights = std::make_shared<ov::op::v0::Constant>(weightsPrecision, weightsShape, weightsValues);
+        std::shared_ptr<ov::Node> decompression = std::make_shared<ov::op::v0::Convert>(weights, ElementType::f32);
+
+        if (withZeroPoint) {
+            std::vector<float> zeroPoints(ov::shape_size(decompressionShape));
+            for (size_t i = 0; i < zeroPoints.size(); i++) {
+                zeroPoints[i] = static_cast<float>(i % 3) + (isSigned ? -1.f : 7.f);
+            }
+            auto zeroPointsConst = std::make_shared<ov::op::v0::Constant>(ElementType::f32, decompressionShape, zeroPoints);
+            decompression = std::make_shared<ov::op::v1::Subtract>(decompression, zeroPointsConst);
+        }
+
+        std::vector<float> scales(ov::shape_size(decompressionShape));
+        for (size_t i = 0; i < scales.size(); i++) {
+            scales[i] = 0.01f * static_cast<float>(1 + i % 5);
+        }
+        auto scalesConst = std::make_shared<ov::op::v0::Constant>(ElementType::f32, decompressionShape, scales);
+        decompression = std::make_shared<ov::op::v1::Multiply>(decompression, scalesConst);
+
+        if (groupSize) {
+            const auto targetShape = transposeWeights ? std::vector<int64_t>{static_cast<int64_t>(N), static_cast<int64_t>(K)}
+                                                      : std::vector<int64_t>{static_cast<int64_t>(K), static_cast<int64_t>(N)};
+            auto targetShapeConst = std::make_shared<ov::op::v0::Constant>(ElementType::i64, ov::Shape{2}, targetShape);
+            decompression = std::make_shared<ov::op::v1::Reshape>(decompression, targetShapeConst, false);
+        }
+
+        auto params = ngraph::builder::makeDynamicParams(ElementType::f32, inputDynamicShapes);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(params[0], decompression, false, transposeWeights);
+        function = std::make_shared<ov::Model>(matMul, params, "MatMulWeightsDecompression");
+    }
+};
+
+TEST_P(MatMulWeightsDecompression, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "FullyConnected", 1);
+    // the plugin keeps the decompression on the fly for the inputs which may have up to 16 rows
+    const auto& dataShape = inputDynamicShapes[0];
+    size_t minRows = 1;
+    for (size_t i = 0; i < dataShape.size() - 1; i++) {
+        minRows *= dataShape[i].get_min_length();
+    }
+    CheckNumberOfNodesWithType(compiledModel, "Convert", minRows <= 16 ? 0 : 1);
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{5, 64}}},
+    {{}, {{2, 3, 64}}},
+    {{}, {{4, 10, 64}}},
+    {{-1, 64}, {{1, 64}, {7, 64}, {1, 64}}},
+    {{-1, 64}, {{1, 64}, {40, 64}, {1, 64}}},
+    {{-1, -1, 64}, {{1, 1, 64}, {2, 9, 64}}},
+};
+
+const std::vector<ElementType> weightsPrecisions = {
+    ElementType::u8, ElementType::i8, ElementType::u4, ElementType::i4
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_PerChannel, MatMulWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(17, 32),
+                                            ::testing::Values(true, false),
+                                            ::testing::ValuesIn(weightsPrecisions),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(0)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulWeightsDecompression_PerGroup, MatMulWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(17),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(ElementType::u8, ElementType::u4),
+                                            ::testing::Values(true, false),
+                                            ::testing::Values(16)),
+                         MatMulWeightsDecompression::getTestCaseName);
+
+}  // namespace
+
+}  // namespace SubgraphTestsDefinitions
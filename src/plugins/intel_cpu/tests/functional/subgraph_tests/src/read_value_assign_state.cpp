@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/opsets/opset8.hpp>
+#include "functional_test_utils/ov_plugin_cache.hpp"
+#include <gtest/gtest.h>
+
+namespace SubgraphTestsDefinitions {
+
+// The state is accumulated across the inferences: ReadValue -> Add -> Assign.
+// The output reads the state too, so the state buffers are used directly by the graph edges
+// and swapped after each inference. Two requests check that each one keeps its own buffers.
+class ReadValueAssignStateTest : public ::testing::Test {
+protected:
+    static std::shared_ptr<ov::Model> createModel(const ov::Shape& shape) {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{shape, ov::element::f32, "accumulator"});
+        auto init = ov::opset8::Constant::create(ov::element::f32, shape, {0});
+        auto readValue = std::make_shared<ov::opset8::ReadValue>(init, variable);
+        auto add = std::make_shared<ov::opset8::Add>(readValue, param);
+        auto assign = std::make_shared<ov::opset8::Assign>(add, variable);
+        auto relu = std::make_shared<ov::opset8::Relu>(readValue);
+        auto result = std::make_shared<ov::opset8::Result>(relu);
+        return std::make_shared<ov::Model>(ov::ResultVector{result}, ov::SinkVector{assign}, ov::ParameterVector{param});
+    }
+
+    static void checkTensor(const ov::Tensor& tensor, float expected) {
+        auto data = tensor.data<const float>();
+        for (size_t i = 0; i < tensor.get_size(); ++i)
+            ASSERT_EQ(expected, data[i]) << "at index " << i;
+    }
+};
+
+TEST_F(ReadValueAssignStateTest, smoke_StateIsAccumulated) {
+    const ov::Shape shape{1, 64};
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(createModel(shape), "CPU");
+
+    std::vector<ov::InferRequest> requests{compiledModel.create_infer_request(), compiledModel.create_infer_request()};
+    const float steps[] = {1.f, 10.f};
+    for (size_t r = 0; r < requests.size(); ++r) {
+        ov::Tensor input(ov::element::f32, shape);
+        std::fill_n(input.data<float>(), input.get_size(), steps[r]);
+        requests[r].set_input_tensor(input);
+    }
+
+    for (size_t iter = 0; iter < 3; ++iter) {
+        for (size_t r = 0; r < requests.size(); ++r) {
+            requests[r].infer();
+            checkTensor(requests[r].get_output_tensor(), steps[r] * iter);
+            auto states = requests[r].query_state();
+            ASSERT_EQ(1, states.size());
+            checkTensor(states.front().get_state(), steps[r] * (iter + 1));
+        }
+    }
+
+    // the state set by the user is read by the next inference
+    ov::Tensor newState(ov::element::f32, shape);
+    std::fill_n(newState.data<float>(), newState.get_size(), 5.f);
+    requests[0].query_state().front().set_state(newState);
+    requests[0].infer();
+    checkTensor(requests[0].get_output_tensor(), 5.f);
+    checkTensor(requests[0].query_state().front().get_state(), 6.f);
+
+    requests[1].query_state().front().reset();
+    requests[1].infer();
+    checkTensor(requests[1].get_output_tensor(), 0.f);
+    checkTensor(requests[1].query_state().front().get_state(), 10.f);
+}
+
+TEST_F(ReadValueAssignStateTest, smoke_StateTensorFollowsInference) {
+    const ov::Shape shape{1, 64};
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(createModel(shape), "CPU");
+    auto request = compiledModel.create_infer_request();
+
+    ov::Tensor input(ov::element::f32, shape);
+    std::fill_n(input.data<float>(), input.get_size(), 1.f);
+    request.set_input_tensor(input);
+
+    // the tensor obtained before the inference reads the state committed by it
+    auto state = request.query_state().front().get_state();
+    checkTensor(state, 0.f);
+    for (size_t iter = 1; iter <= 3; ++iter) {
+        request.infer();
+        checkTensor(state, static_cast<float>(iter));
+    }
+
+    // and the values written through it are read by the next inference
+    std::fill_n(state.data<float>(), state.get_size(), 5.f);
+    request.infer();
+    checkTensor(request.get_output_tensor(), 5.f);
+    checkTensor(state, 6.f);
+}
+
+}  // namespace SubgraphTestsDefinitions
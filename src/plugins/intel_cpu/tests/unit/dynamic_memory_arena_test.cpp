@@ -0,0 +1,98 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <dynamic_memory_arena.h>
+#include <edge.h>
+#include <memory_desc/cpu_blocked_memory_desc.h>
+#include <nodes/input.h>
+
+#include <dnnl.hpp>
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+
+class DynamicMemoryArenaTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        // two tensors of the overlapping lifetimes, so the plan places them at different offsets
+        for (size_t i = 0; i < 2; i++) {
+            auto desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(ov::PartialShape{-1, channels}));
+            auto parent = std::make_shared<node::Input>(desc, "Input_" + std::to_string(i), "Parameter", engine, cache);
+            auto child = std::make_shared<node::Input>(desc, "Output_" + std::to_string(i), "Result", engine, cache);
+            for (auto& node : {parent, child}) {
+                node->init();
+                node->getSupportedDescriptors();
+                node->initSupportedPrimitiveDescriptors();
+                node->selectPrimitiveDescriptorByIndex(0);
+            }
+            auto edge = std::make_shared<Edge>(parent, child, 0, 0);
+            edge->changeStatus(Edge::Status::NeedAllocation);
+            edge->allocate(arena.addTensor({edge}, static_cast<int>(i), static_cast<int>(i) + 1));
+            edge->validate();
+            edges.push_back(edge);
+        }
+    }
+
+    // resizes the tensors as the nodes do during the inference
+    void infer(size_t batch) {
+        arena.prepare({{batch, channels}});
+        for (auto& edge : edges) {
+            edge->getMemoryPtr()->redefineDesc(
+                std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(VectorDims{batch, channels})));
+        }
+        arena.update();
+    }
+
+    bool areInArena() const {
+        auto first = static_cast<uint8_t*>(edges[0]->getMemoryPtr()->GetData());
+        auto second = static_cast<uint8_t*>(edges[1]->getMemoryPtr()->GetData());
+        const auto distance = static_cast<size_t>(first > second ? first - second : second - first);
+        return edges[0]->getMemoryPtr()->isUsedExternalStorage() && edges[1]->getMemoryPtr()->isUsedExternalStorage() &&
+               distance >= edges[0]->getMemoryPtr()->GetSize() && distance < arena.getSize();
+    }
+
+    const size_t channels = 16;
+    dnnl::engine engine{dnnl::engine::kind::cpu, 0};
+    WeightsSharing::Ptr cache;
+    DynamicMemoryArena arena;
+    std::vector<EdgePtr> edges;
+};
+
+TEST_F(DynamicMemoryArenaTest, PlanIsBuiltAndAppliedForKnownShapes) {
+    // the first inference of the shapes allocates the own buffers and builds the plan
+    infer(2);
+    ASSERT_FALSE(arena.isPlanApplied());
+    ASSERT_EQ(0u, arena.getSize());
+
+    infer(2);
+    ASSERT_TRUE(arena.isPlanApplied());
+    ASSERT_EQ(2 * 2 * channels * sizeof(float), arena.getSize());
+    ASSERT_TRUE(areInArena());
+}
+
+TEST_F(DynamicMemoryArenaTest, PlanIsCachedByInputShapes) {
+    infer(2);
+    infer(2);
+    ASSERT_TRUE(arena.isPlanApplied());
+
+    // the tensors don't fit into the plan of the other shapes, so they get the own buffers and a new plan
+    infer(8);
+    ASSERT_FALSE(arena.isPlanApplied());
+    infer(8);
+    ASSERT_TRUE(arena.isPlanApplied());
+    ASSERT_EQ(2 * 8 * channels * sizeof(float), arena.getSize());
+    ASSERT_TRUE(areInArena());
+
+    // the plan of the known shapes is taken from the cache and the arena is not shrunk
+    infer(2);
+    ASSERT_TRUE(arena.isPlanApplied());
+    ASSERT_EQ(2 * 8 * channels * sizeof(float), arena.getSize());
+    ASSERT_TRUE(areInArena());
+}
+
+}  // namespace
@@ -15,6 +15,7 @@
 #include <ngraph_transformations/convert_matmul_to_fc.hpp>
 #include <ngraph_transformations/fc_bias_fusion.hpp>
 #include <transformations/init_node_info.hpp>
+#include <transformations/rt_info/disable_constant_folding.hpp>
 #include <transformations/utils/utils.hpp>
 #include <ngraph/pass/manager.hpp>
 
@@ -510,3 +511,41 @@ TEST(TransformationTests, ConvertMatMulToFCTest_second_input_rank_adj_3) {
     auto res = compare_functions(f, f_ref, true);
     ASSERT_TRUE(res.first) << res.second;
 }
+
+TEST(TransformationTests, ConvertMatMulToFCTest_decompressed_weights) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 3, 4 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 4, 2 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        ov::disable_constant_folding(convert);
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 1, 2 }, { 1 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_point);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 2 }, { 1 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+        auto matmul = std::make_shared<ngraph::opset1::MatMul>(input1, multiply, false, false);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+        ngraph::pass::Manager m;
+        m.register_pass<ngraph::pass::InitNodeInfo>();
+        m.register_pass<ConvertMatMulToFC>();
+        m.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+    }
+
+    {
+        auto input1 = std::make_shared<ngraph::opset1::Parameter>(ngraph::element::f32, ngraph::Shape{ 3, 4 });
+        auto weights = ngraph::opset1::Constant::create(ngraph::element::u8, ngraph::Shape{ 2, 4 }, { 1 });
+        auto convert = std::make_shared<ngraph::opset1::Convert>(weights, ngraph::element::f32);
+        auto zero_point = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 2, 1 }, { 1 });
+        auto subtract = std::make_shared<ngraph::opset1::Subtract>(convert, zero_point);
+        auto scale = ngraph::opset1::Constant::create(ngraph::element::f32, ngraph::Shape{ 2, 1 }, { 1 });
+        auto multiply = std::make_shared<ngraph::opset1::Multiply>(subtract, scale);
+        auto matmul = std::make_shared<FullyConnectedNode>(input1, multiply, ngraph::Rank(2));
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{ matmul }, ngraph::ParameterVector{ input1 });
+    }
+
+    auto res = compare_functions(f, f_ref, true);
+    ASSERT_TRUE(res.first) << res.second;
+}
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "utils/numa_utils.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(NumaUtilsTest, FirstTouchPreservesData) {
+    std::vector<uint8_t> buffer(3 * 4096 + 17);
+    std::iota(buffer.begin(), buffer.end(), 0);
+    const auto expected = buffer;
+
+    firstTouch(buffer.data() + 1, buffer.size() - 1);
+    ASSERT_EQ(expected, buffer);
+}
+
+TEST(NumaUtilsTest, PlacementCountsSharedPagesOnce) {
+    std::vector<uint8_t> buffer(1 << 20, 1);
+    const auto placement = getNumaPlacement({{buffer.data(), buffer.size()},
+                                             {buffer.data() + 4096, 100},
+                                             {buffer.data() + buffer.size() / 2, buffer.size() / 2}});
+    if (placement.empty())
+        GTEST_SKIP() << "NUMA placement can't be queried";
+
+    uint64_t total = 0;
+    for (const auto& node : placement)
+        total += node.second;
+    // the buffer may start and end in the middle of a page
+    ASSERT_GE(total, buffer.size());
+    ASSERT_LT(total, buffer.size() + 2 * 4096 * 16);
+    // the buffer is written by the constructor, so all the pages are resident
+    ASSERT_EQ(0, placement.count(-1));
+}
+
+TEST(NumaUtilsTest, AllocateOnNegativeNodeIsIgnored) {
+    ASSERT_EQ(nullptr, allocateOnNumaNode(4096, -1));
+    ASSERT_EQ(nullptr, allocateOnNumaNode(0, 0));
+}
+
+TEST(NumaUtilsTest, AllocateOnNumaNodeUsesWholePages) {
+    const size_t size = 3 * 4096 + 17;
+    auto ptr = static_cast<uint8_t*>(allocateOnNumaNode(size, 0));
+    if (!ptr)
+        GTEST_SKIP() << "NUMA memory policy can't be applied";
+
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(ptr) % 4096);
+    std::fill(ptr, ptr + size, 1);
+    const auto placement = getNumaPlacement({{ptr, size}});
+    if (!placement.empty())
+        ASSERT_EQ(0, placement.count(-1));
+    freeOnNumaNode(ptr, size);
+}
+
+TEST(NumaUtilsTest, AllocatorFallsBackToSystemMemory) {
+    NumaMemoryAllocator allocator(-1);
+    auto handle = allocator.alloc(100);
+    ASSERT_NE(nullptr, handle);
+    ASSERT_EQ(handle, allocator.lock(handle));
+    ASSERT_TRUE(allocator.free(handle));
+    ASSERT_FALSE(allocator.free(handle));
+}
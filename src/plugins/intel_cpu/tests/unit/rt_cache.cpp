@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <atomic>
 #include <thread>
 
 #include <gtest/gtest.h>
@@ -9,6 +10,7 @@
 
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
+#include "cache/shared_cache_entry.h"
 
 using namespace ov::intel_cpu;
 
@@ -379,3 +381,90 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(SharedCacheEntryTests, BuildOnceConcurrently) {
+    using ValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 10;
+    constexpr size_t numThreads = 30;
+
+    std::atomic<size_t> buildsNum{0};
+    auto builder = [&](const IntKey& key) {
+        buildsNum++;
+        // keep the build in flight long enough for the other threads to request the same key
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        return std::make_shared<int>(key.data);
+    };
+
+    SharedCacheEntry<IntKey, ValueType> entry(capacity);
+
+    std::vector<ValueType> results(numThreads);
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread([&, i]() {
+                results[i] = entry.getOrCreate({42}, builder).first;
+            }));
+        }
+    }
+
+    ASSERT_EQ(buildsNum, 1);
+    for (const auto& result : results) {
+        ASSERT_NE(result, ValueType());
+        ASSERT_EQ(result, results.front());
+    }
+
+    auto stats = entry.getStatistics();
+    ASSERT_EQ(stats.misses, 1);
+    ASSERT_EQ(stats.hits, numThreads - 1);
+    ASSERT_EQ(stats.evictions, 0);
+}
+
+TEST(SharedCacheEntryTests, BuilderException) {
+    using ValueType = std::shared_ptr<int>;
+
+    SharedCacheEntry<IntKey, ValueType> entry(10);
+
+    auto throwingBuilder = [](const IntKey&) -> ValueType { throw std::runtime_error("build failed"); };
+    ASSERT_THROW(entry.getOrCreate({1}, throwingBuilder), std::runtime_error);
+
+    // the failed build must not stay in the cache
+    auto result = entry.getOrCreate({1}, [](const IntKey& key) { return std::make_shared<int>(key.data); });
+    ASSERT_NE(result.first, ValueType());
+    ASSERT_EQ(*result.first, 1);
+    ASSERT_EQ(result.second, CacheEntryBase::LookUpStatus::Miss);
+}
+
+TEST(MultiCacheTests, SharedStatistics) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 10;
+    constexpr size_t numThreads = 8;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity, true);
+    ASSERT_TRUE(cache.isThreadSafe());
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < 2 * capacity; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits + stats.misses, numThreads * 2 * capacity);
+    ASSERT_GE(stats.misses, 2 * capacity);
+    ASSERT_GE(stats.evictions, capacity);
+}
@@ -0,0 +1,106 @@
+// Copyright (C) 2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+
+#include <openvino/op/convolution.hpp>
+#include <openvino/op/parameter.hpp>
+#include <utils/shape_inference/memoized_shape_inference.hpp>
+#include <utils/shape_inference/static_shape.hpp>
+
+using namespace ov;
+using namespace ov::intel_cpu;
+
+namespace {
+std::shared_ptr<MemoizedShapeInfer> makeConvShapeInfer() {
+    const Strides strides{2, 2};
+    const Strides dilations{1, 1};
+    const CoordinateDiff pads_begin{0, 0};
+    const CoordinateDiff pads_end{0, 0};
+    auto data = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto filters = std::make_shared<op::v0::Parameter>(element::f32, PartialShape{-1, -1, -1, -1});
+    auto conv = std::make_shared<op::v1::Convolution>(data, filters, strides, pads_begin, pads_end, dilations,
+                                                      op::PadType::SAME_UPPER);
+    return std::make_shared<MemoizedShapeInfer>(make_shape_inference(conv), 4);
+}
+
+std::vector<VectorDims> inferAndStore(MemoizedShapeInfer& shapeInfer, const VectorDims& dataDims, const VectorDims& filtersDims) {
+    shapeInfer.resetKey();
+    shapeInfer.appendDims(dataDims);
+    shapeInfer.appendDims(filtersDims);
+    EXPECT_EQ(shapeInfer.find(), nullptr);
+
+    auto output_shapes = shapeInfer.infer({StaticShape(dataDims), StaticShape(filtersDims)}, {});
+    std::vector<VectorDims> result;
+    for (const auto& shape : output_shapes)
+        result.push_back(shape.to_shape());
+    shapeInfer.store(result);
+    return result;
+}
+}   // namespace
+
+TEST(MemoizedShapeInferenceTest, ConvolutionPadding) {
+    auto shapeInfer = makeConvShapeInfer();
+    ASSERT_TRUE(shapeInfer->has_pads());
+
+    const VectorDims filtersDims{7, 3, 3, 3};
+    const auto odd = inferAndStore(*shapeInfer, {1, 3, 5, 5}, filtersDims);
+    ASSERT_EQ(shapeInfer->get_pads_begin(), (CoordinateDiff{1, 1}));
+    ASSERT_EQ(shapeInfer->get_pads_end(), (CoordinateDiff{1, 1}));
+
+    const auto even = inferAndStore(*shapeInfer, {1, 3, 6, 6}, filtersDims);
+    ASSERT_EQ(shapeInfer->get_pads_begin(), (CoordinateDiff{0, 0}));
+    ASSERT_EQ(shapeInfer->get_pads_end(), (CoordinateDiff{1, 1}));
+
+    // the padding must follow the cached shapes, not the last inference
+    shapeInfer->resetKey();
+    shapeInfer->appendDims({1, 3, 5, 5});
+    shapeInfer->appendDims(filtersDims);
+    auto cached = shapeInfer->find();
+    ASSERT_NE(cached, nullptr);
+    ASSERT_EQ(*cached, odd);
+    ASSERT_EQ(shapeInfer->get_pads_begin(), (CoordinateDiff{1, 1}));
+    ASSERT_EQ(shapeInfer->get_pads_end(), (CoordinateDiff{1, 1}));
+
+    shapeInfer->resetKey();
+    shapeInfer->appendDims({1, 3, 6, 6});
+    shapeInfer->appendDims(filtersDims);
+    cached = shapeInfer->find();
+    ASSERT_NE(cached, nullptr);
+    ASSERT_EQ(*cached, even);
+    ASSERT_EQ(shapeInfer->get_pads_begin(), (CoordinateDiff{0, 0}));
+    ASSERT_EQ(shapeInfer->get_pads_end(), (CoordinateDiff{1, 1}));
+}
+
+TEST(MemoizedShapeInferenceTest, InputValuesInKey) {
+    auto shapeInfer = makeConvShapeInfer();
+
+    const int32_t values[] = {1, 2, 3};
+    const int32_t otherValues[] = {1, 2, 4};
+
+    shapeInfer->resetKey();
+    shapeInfer->appendDims({3});
+    shapeInfer->appendData(values, sizeof(values));
+    ASSERT_EQ(shapeInfer->find(), nullptr);
+    shapeInfer->store({{1, 2, 3}});
+
+    shapeInfer->resetKey();
+    shapeInfer->appendDims({3});
+    shapeInfer->appendData(otherValues, sizeof(otherValues));
+    ASSERT_EQ(shapeInfer->find(), nullptr);
+
+    shapeInfer->resetKey();
+    shapeInfer->appendDims({3});
+    shapeInfer->appendData(values, sizeof(values));
+    auto cached = shapeInfer->find();
+    ASSERT_NE(cached, nullptr);
+    ASSERT_EQ(*cached, (std::vector<VectorDims>{{1, 2, 3}}));
+
+    // too large inputs are not cached at all
+    std::vector<uint8_t> large(4096, 0);
+    shapeInfer->resetKey();
+    shapeInfer->appendDims({large.size()});
+    shapeInfer->appendData(large.data(), large.size());
+    shapeInfer->store({{1}});
+    ASSERT_EQ(shapeInfer->find(), nullptr);
+}
@@ -0,0 +1,151 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "weights_cache.hpp"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+
+using namespace ov::intel_cpu;
+using namespace InferenceEngine;
+
+namespace {
+
+class WeightsCacheTest : public ::testing::Test {
+protected:
+    MemoryPtr createMemory(const std::vector<float>& data) {
+        createCalls++;
+        auto memory = std::make_shared<Memory>(eng);
+        memory->Create(desc);
+        std::memcpy(memory->GetPtr(), data.data(), data.size() * sizeof(float));
+        return memory;
+    }
+
+    MemoryPtr findOrCreate(WeightsSharing& cache, const std::string& key, const std::vector<float>& data) {
+        // the source data is owned by the caller, e.g. by the constant of the model
+        auto source = std::make_shared<std::vector<float>>(data);
+        sources.push_back(source);
+        return cache.findOrCreateConstant(key,
+                                          std::shared_ptr<const void>(source, source->data()),
+                                          data.size() * sizeof(float),
+                                          desc,
+                                          desc,
+                                          [&]() {
+                                              return createMemory(data);
+                                          });
+    }
+
+    std::vector<std::shared_ptr<std::vector<float>>> sources;
+
+    dnnl::engine eng{dnnl::engine::kind::cpu, 0};
+    MemoryDescPtr desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(VectorDims{16}));
+    size_t createCalls = 0;
+};
+
+}  // namespace
+
+TEST_F(WeightsCacheTest, ProcessStoreSharesIdenticalWeights) {
+    auto processWeights = std::make_shared<ProcessWeightsSharing>();
+    WeightsSharing firstModel(processWeights);
+    WeightsSharing secondModel(processWeights);
+
+    std::vector<float> data(16);
+    std::iota(data.begin(), data.end(), 0.f);
+
+    auto first = findOrCreate(firstModel, "first_weights", data);
+    auto second = findOrCreate(secondModel, "second_weights", data);
+    ASSERT_EQ(first, second);
+    // the source data of the shared weights is compared, so nothing is created for the hit
+    ASSERT_EQ(createCalls, 1u);
+
+    auto stats = processWeights->getStatistics();
+    ASSERT_EQ(stats["hits"], 1u);
+    ASSERT_EQ(stats["misses"], 1u);
+    ASSERT_EQ(stats["saved_bytes"], data.size() * sizeof(float));
+    ASSERT_EQ(stats["stored_bytes"], data.size() * sizeof(float));
+
+    data[0] = 100.f;
+    auto other = findOrCreate(secondModel, "other_weights", data);
+    ASSERT_NE(first, other);
+    ASSERT_EQ(createCalls, 2u);
+}
+
+TEST_F(WeightsCacheTest, ProcessStoreComparesCreatedWeightsWithoutSource) {
+    auto processWeights = std::make_shared<ProcessWeightsSharing>();
+    WeightsSharing firstModel(processWeights);
+    WeightsSharing secondModel(processWeights);
+    const std::vector<float> data(16, 1.f);
+
+    auto first = findOrCreate(firstModel, "weights", data);
+    // the source of the stored weights is released, e.g. the model is freed after the compilation
+    sources.clear();
+    ASSERT_EQ(first, findOrCreate(secondModel, "weights", data));
+    ASSERT_EQ(createCalls, 2u);
+
+    // the stored weights refer to the source of the last lookup now
+    WeightsSharing thirdModel(processWeights);
+    ASSERT_EQ(first, findOrCreate(thirdModel, "weights", data));
+    ASSERT_EQ(createCalls, 2u);
+    ASSERT_EQ(processWeights->getStatistics()["hits"], 2u);
+}
+
+TEST_F(WeightsCacheTest, ProcessStoreComparesWeightsWithSameKey) {
+    ProcessWeightsSharing processWeights;
+    std::vector<float> data(16, 1.f);
+    const auto size = data.size() * sizeof(float);
+    auto create = [&]() {
+        return createMemory(data);
+    };
+    auto source = [](const std::vector<float>& values) {
+        auto owner = std::make_shared<std::vector<float>>(values);
+        return std::shared_ptr<const void>(owner, owner->data());
+    };
+
+    const auto firstSource = source(data);
+    auto first = processWeights.findOrCreate("weights", firstSource, size, create);
+    ASSERT_EQ(first, processWeights.findOrCreate("weights", source(data), size, create));
+
+    // a colliding key of the other weights
+    data[0] = 2.f;
+    auto other = processWeights.findOrCreate("weights", source(data), size, create);
+    ASSERT_NE(first, other);
+    ASSERT_EQ(static_cast<float*>(other->GetPtr())[0], 2.f);
+    ASSERT_EQ(static_cast<float*>(first->GetPtr())[0], 1.f);
+    ASSERT_EQ(createCalls, 2u);
+
+    auto stats = processWeights.getStatistics();
+    ASSERT_EQ(stats["hits"], 1u);
+    ASSERT_EQ(stats["misses"], 2u);
+}
+
+TEST_F(WeightsCacheTest, ProcessStoreReleasesUnusedWeights) {
+    auto processWeights = std::make_shared<ProcessWeightsSharing>();
+    const std::vector<float> data(16, 1.f);
+
+    {
+        WeightsSharing model(processWeights);
+        auto memory = findOrCreate(model, "weights", data);
+        ASSERT_EQ(processWeights->getStatistics()["stored_bytes"], data.size() * sizeof(float));
+    }
+    ASSERT_EQ(processWeights->getStatistics()["stored_bytes"], 0u);
+
+    WeightsSharing model(processWeights);
+    auto memory = findOrCreate(model, "weights", data);
+    ASSERT_EQ(createCalls, 2u);
+}
+
+TEST_F(WeightsCacheTest, NetworkStoreKeepsWeightsPerModel) {
+    WeightsSharing firstModel;
+    WeightsSharing secondModel;
+    const std::vector<float> data(16, 1.f);
+
+    auto first = findOrCreate(firstModel, "weights", data);
+    ASSERT_EQ(first, findOrCreate(firstModel, "weights", data));
+    ASSERT_NE(first, findOrCreate(secondModel, "weights", data));
+    ASSERT_EQ(createCalls, 2u);
+}
@@ -14,6 +14,7 @@
 #include "ngraph_functions/subgraph_builders.hpp"
 #include "functional_test_utils/blob_utils.hpp"
 #include "base/behavior_test_utils.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 
 using namespace ::testing;
 using namespace InferenceEngine;
@@ -49,6 +50,7 @@ protected:
     size_t num_streams;
     size_t num_requests;
     size_t num_batch;
+    size_t latency_budget = 0;  // in ms, enables the continuous batching
     std::vector<std::shared_ptr<ngraph::Function>> fn_ptrs;
 
     void TestAutoBatch() {
@@ -78,6 +80,8 @@ protected:
             }
             // minimize timeout to reduce test time
             config[CONFIG_KEY(AUTO_BATCH_TIMEOUT)] = std::to_string(1);
+            if (latency_budget)
+                config[CONFIG_KEY_INTERNAL(AUTO_BATCH_LATENCY_BUDGET)] = std::to_string(latency_budget);
             auto exec_net_ref = ie.LoadNetwork(net, std::string(CommonTestUtils::DEVICE_BATCH) + ":" +
                                                     target_device + "(" + std::to_string(num_batch) + ")",
                                                config);
@@ -160,6 +164,18 @@ public:
     }
 };
 
+class AutoBatching_Test_LatencyBudget : public AutoBatching_Test {
+public:
+    void SetUp() override {
+        AutoBatching_Test::SetUp();
+        latency_budget = 5;
+    };
+
+    static std::string getTestCaseName(const testing::TestParamInfo<AutoBatchTwoNetsParams> &obj) {
+        return "LatencyBudget_" + AutoBatching_Test::getTestCaseName(obj);
+    }
+};
+
 TEST_P(AutoBatching_Test, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
@@ -168,4 +184,8 @@ TEST_P(AutoBatching_Test_DetectionOutput, compareAutoBatchingToSingleBatch) {
     TestAutoBatch();
 }
 
-}  // namespace AutoBatchingTests
\ No newline at end of file
+TEST_P(AutoBatching_Test_LatencyBudget, compareAutoBatchingToSingleBatch) {
+    TestAutoBatch();
+}
+
+}  // namespace AutoBatchingTests
@@ -193,4 +193,61 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, pipelinedExecution) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINE_DEPTH)] = "2";
+    Run();
+}
+
+TEST_P(HeteroSyntheticTest, pipelinedConcurrentRequests) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINE_DEPTH)] = "2";
+    configuration[CONFIG_KEY(PERF_COUNT)] = CONFIG_VALUE(YES);
+    functionRefs = ngraph::clone_function(*function);
+    LoadNetwork();
+
+    // more requests than slots, so the requests wait for the slots released by each other
+    const std::size_t requestsCount = 5;
+    std::vector<InferenceEngine::InferRequest> requests;
+    std::vector<std::vector<InferenceEngine::Blob::Ptr>> requestsInputs;
+    const auto& inputsInfo = executableNetwork.GetInputsInfo();
+    for (std::size_t i = 0; i < requestsCount; ++i) {
+        auto request = executableNetwork.CreateInferRequest();
+        std::vector<InferenceEngine::Blob::Ptr> requestInputs;
+        for (auto&& param : function->get_parameters()) {
+            const auto infoIt = inputsInfo.find(param->get_friendly_name());
+            ASSERT_NE(infoIt, inputsInfo.cend());
+            // every request gets its own data, so the outputs mixed up between the slots don't match the references
+            auto blob = FuncTestUtils::createAndFillBlob(infoIt->second->getTensorDesc(), 10, 0, 1, i + 1);
+            request.SetBlob(infoIt->first, blob);
+            requestInputs.push_back(blob);
+        }
+        requests.push_back(request);
+        requestsInputs.push_back(requestInputs);
+    }
+
+    for (auto&& request : requests) {
+        request.StartAsync();
+    }
+    for (auto&& request : requests) {
+        request.Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+    }
+
+    for (std::size_t i = 0; i < requestsCount; ++i) {
+        inputs = requestsInputs[i];
+        auto expectedOutputs = CalculateRefs();
+        std::vector<InferenceEngine::Blob::Ptr> actualOutputs;
+        for (const auto& output : executableNetwork.GetOutputsInfo()) {
+            actualOutputs.push_back(requests[i].GetBlob(output.first));
+        }
+        ASSERT_EQ(expectedOutputs.size(), actualOutputs.size());
+        Compare(expectedOutputs, actualOutputs);
+        // the counters are kept by the request, since its slot may already execute another one
+        EXPECT_FALSE(requests[i].GetPerformanceCounts().empty());
+    }
+}
+
 }  //  namespace HeteroTests
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2018-2022 Intel Corporation
+# SPDX-License-Identifier: Apache-2.0
+
+"""
+Compare results of cpu_node_benchmark produced by 2 builds.
+Usage: ./scripts/compare_benchmarks.py reference.json current.json \
+       --threshold 5 --out_file comparison.json
+The script exits with code 1 if any case is slower than the reference by more than the threshold.
+"""
+
+import argparse
+import json
+import logging as log
+import sys
+
+
+def load_results(path):
+    """Load the results file and index the measured cases by name"""
+    with open(path) as results_file:
+        data = json.load(results_file)
+    return data, {item["name"]: item for item in data["results"] if item["status"] == "ok"}
+
+
+def case_time(item, metric):
+    """Return the compared time of the case. The node time is missing if the node was fused into
+    a differently named one, the whole inference latency is used in this case."""
+    if metric == "node_time_us" and item.get("node_time_us"):
+        return item["node_time_us"]["median"], metric
+    return item["latency_us"]["median"], "latency_us"
+
+
+def compare(references, current, metric, threshold):
+    """Compare the cases measured by both builds"""
+    records = []
+    for name in sorted(set(references) & set(current)):
+        ref_time, ref_metric = case_time(references[name], metric)
+        cur_time, cur_metric = case_time(current[name], metric)
+        if ref_metric != cur_metric:
+            ref_time, _ = case_time(references[name], "latency_us")
+            cur_time, cur_metric = case_time(current[name], "latency_us")
+        ratio = cur_time / ref_time if ref_time else float("inf")
+        records.append({
+            "name": name,
+            "metric": cur_metric,
+            "reference": ref_time,
+            "current": cur_time,
+            "ratio": ratio,
+            "reference_exec_type": references[name].get("exec_type", ""),
+            "current_exec_type": current[name].get("exec_type", ""),
+            "regression": ratio > 1 + threshold / 100,
+        })
+    return records
+
+
+def main():
+    """Main entry point"""
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("reference", help="results of the reference build")
+    parser.add_argument("current", help="results of the build under test")
+    parser.add_argument("--metric", choices=["node_time_us", "latency_us"], default="node_time_us",
+                        help="compared time, node execution time by default")
+    parser.add_argument("--threshold", type=float, default=5,
+                        help="allowed slowdown in percents, 5 by default")
+    parser.add_argument("--out_file", help="path to write the comparison in JSON format")
+    args = parser.parse_args()
+
+    log.basicConfig(format="[ %(levelname)s ] %(message)s", level=log.INFO, stream=sys.stdout)
+
+    _, references = load_results(args.reference)
+    _, current = load_results(args.current)
+    for name in sorted(set(references) ^ set(current)):
+        log.warning("Case %s is measured by one build only", name)
+
+    records = compare(references, current, args.metric, args.threshold)
+    print("{:<48} {:>12} {:>12} {:>8}  {}".format("case", "reference", "current", "ratio", "exec type"))
+    for record in records:
+        exec_type = record["current_exec_type"]
+        if record["reference_exec_type"] != exec_type:
+            exec_type = "{} -> {}".format(record["reference_exec_type"], exec_type)
+        print("{:<48} {:>12.1f} {:>12.1f} {:>8.3f}  {}{}".format(
+            record["name"], record["reference"], record["current"], record["ratio"], exec_type,
+            "  REGRESSION" if record["regression"] else ""))
+
+    if args.out_file:
+        with open(args.out_file, "w") as out_file:
+            json.dump(records, out_file, indent=2)
+
+    regressions = [record for record in records if record["regression"]]
+    if regressions:
+        log.error("%d of %d cases are slower than the reference by more than %s%%",
+                  len(regressions), len(records), args.threshold)
+        return 1
+    log.info("No regressions found in %d cases", len(records))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
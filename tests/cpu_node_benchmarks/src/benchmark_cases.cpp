@@ -0,0 +1,317 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "benchmark_cases.h"
+
+#include <openvino/core/preprocess/pre_post_process.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include <algorithm>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+using namespace ov::opset8;
+
+namespace {
+const char benchmarkedNodeName[] = "bench";
+
+/**
+ * @brief Creates constant weights filled with reproducible random values in [-1, 1]
+ */
+std::shared_ptr<Constant> makeWeights(const ov::Shape &shape) {
+    std::mt19937 generator(shape_size(shape));
+    std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+    std::vector<float> values(shape_size(shape));
+    for (auto &value : values)
+        value = distribution(generator);
+    return std::make_shared<Constant>(ov::element::f32, shape, values);
+}
+
+ov::Output<ov::Node> quantize(const ov::Output<ov::Node> &input, float low, float high, size_t levels) {
+    auto lowConst = Constant::create(ov::element::f32, {}, {low});
+    auto highConst = Constant::create(ov::element::f32, {}, {high});
+    return std::make_shared<FakeQuantize>(input, lowConst, highConst, lowConst, highConst, levels);
+}
+
+/**
+ * @brief u8 quantization of the activations, the inputs are filled with [0, 10) values by the runner
+ */
+ov::Output<ov::Node> quantizeData(const ov::Output<ov::Node> &input) {
+    return quantize(input, 0.f, 10.f, 256);
+}
+
+/**
+ * @brief i8 quantization of the weights
+ */
+ov::Output<ov::Node> quantizeWeights(const ov::Output<ov::Node> &input) {
+    return quantize(input, -1.27f, 1.27f, 255);
+}
+
+std::shared_ptr<ov::Model> makeModel(const std::shared_ptr<ov::Node> &node, const ov::ParameterVector &params) {
+    node->set_friendly_name(benchmarkedNodeName);
+    auto result = std::make_shared<Result>(node);
+    return std::make_shared<ov::Model>(ov::ResultVector{result}, params);
+}
+
+std::shared_ptr<ov::Model> makeConvolution(const Variant &variant, bool quantized) {
+    auto data = std::make_shared<Parameter>(ov::element::f32, variant.shapes[0]);
+    ov::Output<ov::Node> input = data;
+    ov::Output<ov::Node> weights = makeWeights(variant.shapes[1]);
+    if (quantized) {
+        input = quantizeData(input);
+        weights = quantizeWeights(weights);
+    }
+    const size_t stride = variant.params[0];
+    const std::ptrdiff_t pad = variant.shapes[1][2] / 2;
+    auto conv = std::make_shared<Convolution>(input, weights,
+                                              ov::Strides{stride, stride},
+                                              ov::CoordinateDiff{pad, pad},
+                                              ov::CoordinateDiff{pad, pad},
+                                              ov::Strides{1, 1});
+    return makeModel(conv, {data});
+}
+
+std::shared_ptr<ov::Model> makeFullyConnected(const Variant &variant, bool quantized) {
+    auto data = std::make_shared<Parameter>(ov::element::f32, variant.shapes[0]);
+    ov::Output<ov::Node> input = data;
+    ov::Output<ov::Node> weights = makeWeights(variant.shapes[1]);
+    if (quantized) {
+        input = quantizeData(input);
+        weights = quantizeWeights(weights);
+    }
+    // MatMul with the constant weights is executed as FullyConnected by the CPU plugin
+    auto fc = std::make_shared<MatMul>(input, weights, false, true);
+    return makeModel(fc, {data});
+}
+
+std::shared_ptr<ov::Model> makeMatMul(const Variant &variant, bool quantized) {
+    auto a = std::make_shared<Parameter>(ov::element::f32, variant.shapes[0]);
+    auto b = std::make_shared<Parameter>(ov::element::f32, variant.shapes[1]);
+    ov::Output<ov::Node> inputA = a;
+    ov::Output<ov::Node> inputB = b;
+    if (quantized) {
+        inputA = quantizeData(inputA);
+        inputB = quantizeData(inputB);
+    }
+    auto matmul = std::make_shared<MatMul>(inputA, inputB);
+    return makeModel(matmul, {a, b});
+}
+
+std::shared_ptr<ov::Model> makeEltwise(const Variant &variant, bool) {
+    ov::ParameterVector params;
+    for (const auto &shape : variant.shapes)
+        params.push_back(std::make_shared<Parameter>(ov::element::f32, shape));
+
+    std::shared_ptr<ov::Node> eltwise;
+    const auto &op = variant.name;
+    if (op == "add" || op == "add_bcast") {
+        eltwise = std::make_shared<Add>(params[0], params[1]);
+    } else if (op == "multiply") {
+        eltwise = std::make_shared<Multiply>(params[0], params[1]);
+    } else if (op == "sigmoid") {
+        eltwise = std::make_shared<Sigmoid>(params[0]);
+    } else if (op == "exp") {
+        eltwise = std::make_shared<Exp>(params[0]);
+    } else if (op == "gelu") {
+        eltwise = std::make_shared<Gelu>(params[0]);
+    } else if (op == "swish") {
+        eltwise = std::make_shared<Swish>(params[0]);
+    } else {
+        throw std::logic_error("Unknown eltwise variant " + op);
+    }
+    return makeModel(eltwise, params);
+}
+
+std::shared_ptr<ov::Model> makeReduce(const Variant &variant, bool) {
+    auto data = std::make_shared<Parameter>(ov::element::f32, variant.shapes[0]);
+    auto axes = Constant::create(ov::element::i64, {variant.params.size()}, variant.params);
+
+    std::shared_ptr<ov::Node> reduce;
+    if (variant.name.find("sum") == 0) {
+        reduce = std::make_shared<ReduceSum>(data, axes, true);
+    } else if (variant.name.find("mean") == 0) {
+        reduce = std::make_shared<ReduceMean>(data, axes, true);
+    } else if (variant.name.find("max") == 0) {
+        reduce = std::make_shared<ReduceMax>(data, axes, true);
+    } else {
+        throw std::logic_error("Unknown reduce variant " + variant.name);
+    }
+    return makeModel(reduce, {data});
+}
+
+std::shared_ptr<ov::Model> makeGather(const Variant &variant, bool) {
+    auto data = std::make_shared<Parameter>(ov::element::f32, variant.shapes[0]);
+    const auto axis = variant.params[0];
+    const auto count = static_cast<size_t>(variant.params[1]);
+    const auto dim = variant.shapes[0][axis];
+    // the indices are spread evenly over the gathered dimension
+    std::vector<int32_t> indices(count);
+    for (size_t i = 0; i < count; ++i)
+        indices[i] = static_cast<int32_t>(i * dim / count);
+    auto indicesConst = Constant::create(ov::element::i32, {count}, indices);
+    auto axisConst = Constant::create(ov::element::i64, {}, {axis});
+    auto gather = std::make_shared<Gather>(data, indicesConst, axisConst);
+    return makeModel(gather, {data});
+}
+
+/**
+ * @brief Scaled dot product attention subgraph which is fused into a single MHA node by the CPU plugin
+ * shapes[0] is [batch, sequence, heads, head size] of query, key and value
+ */
+std::shared_ptr<ov::Model> makeMHA(const Variant &variant, bool) {
+    const auto &shape = variant.shapes[0];
+    auto query = std::make_shared<Parameter>(ov::element::f32, shape);
+    auto key = std::make_shared<Parameter>(ov::element::f32, shape);
+    auto value = std::make_shared<Parameter>(ov::element::f32, shape);
+    auto mask = std::make_shared<Parameter>(ov::element::f32, ov::Shape{shape[0], 1, 1, shape[1]});
+
+    auto order = [](const std::vector<int64_t> &values) {
+        return Constant::create(ov::element::i64, {values.size()}, values);
+    };
+    auto transposeQ = std::make_shared<Transpose>(query, order({0, 2, 1, 3}));
+    auto transposeK = std::make_shared<Transpose>(key, order({0, 2, 3, 1}));
+    auto scores = std::make_shared<MatMul>(transposeQ, transposeK);
+    auto masked = std::make_shared<Add>(scores, mask);
+    auto softmax = std::make_shared<Softmax>(masked, 3);
+    auto transposeV = std::make_shared<Transpose>(value, order({0, 2, 1, 3}));
+    auto attention = std::make_shared<MatMul>(softmax, transposeV);
+    auto output = std::make_shared<Transpose>(attention, order({0, 2, 1, 3}));
+    return makeModel(output, {query, key, value, mask});
+}
+
+std::shared_ptr<ov::Model> makeInterpolate(const Variant &variant, bool) {
+    auto data = std::make_shared<Parameter>(ov::element::f32, variant.shapes[0]);
+    const float scale = static_cast<float>(variant.params[0]);
+
+    Interpolate::InterpolateAttrs attrs;
+    attrs.shape_calculation_mode = Interpolate::ShapeCalcMode::SCALES;
+    attrs.pads_begin = std::vector<size_t>(4, 0);
+    attrs.pads_end = std::vector<size_t>(4, 0);
+    if (variant.name == "nearest") {
+        attrs.mode = Interpolate::InterpolateMode::NEAREST;
+    } else if (variant.name == "linear_onnx") {
+        attrs.mode = Interpolate::InterpolateMode::LINEAR_ONNX;
+    } else if (variant.name == "cubic") {
+        attrs.mode = Interpolate::InterpolateMode::CUBIC;
+    } else {
+        throw std::logic_error("Unknown interpolate variant " + variant.name);
+    }
+
+    const auto &shape = variant.shapes[0];
+    auto outputShape = Constant::create(ov::element::i64, {2}, std::vector<int64_t>{
+        static_cast<int64_t>(shape[2] * scale), static_cast<int64_t>(shape[3] * scale)});
+    auto scales = Constant::create(ov::element::f32, {2}, {scale, scale});
+    auto axes = Constant::create(ov::element::i64, {2}, {2, 3});
+    auto interpolate = std::make_shared<Interpolate>(data, outputShape, scales, axes, attrs);
+    return makeModel(interpolate, {data});
+}
+
+std::shared_ptr<ov::Model> applyLayout(const std::shared_ptr<ov::Model> &model, const std::string &layout) {
+    if (layout.empty() || layout == "NCHW")
+        return model;
+    ov::preprocess::PrePostProcessor ppp(model);
+    for (size_t i = 0; i < model->inputs().size(); ++i) {
+        if (model->input(i).get_partial_shape().rank() != 4)
+            continue;
+        ppp.input(i).tensor().set_layout(ov::Layout(layout));
+        ppp.input(i).model().set_layout("NCHW");
+    }
+    return ppp.build();
+}
+}  // namespace
+
+std::string BenchmarkCase::name() const {
+    std::stringstream name;
+    name << node << "_" << variant.name << "_" << precision;
+    if (!layout.empty())
+        name << "_" << layout;
+    name << "_t" << threads;
+    return name.str();
+}
+
+const std::vector<NodeBenchmark> &getNodeBenchmarks() {
+    static const std::vector<NodeBenchmark> benchmarks = {
+        {"conv",
+         {{"3x3_64", {{1, 64, 56, 56}, {64, 64, 3, 3}}, {1}},
+          {"1x1_256_1024", {{1, 256, 14, 14}, {1024, 256, 1, 1}}, {1}},
+          {"7x7s2_3_64", {{1, 3, 224, 224}, {64, 3, 7, 7}}, {2}}},
+         makeConvolution, true, true},
+        {"fc",
+         {{"1x1024x1000", {{1, 1024}, {1000, 1024}}, {}},
+          {"128x768x3072", {{128, 768}, {3072, 768}}, {}}},
+         makeFullyConnected, true, false},
+        {"matmul",
+         {{"attention_scores", {{1, 12, 128, 64}, {1, 12, 64, 128}}, {}},
+          {"square_512", {{1, 512, 512}, {1, 512, 512}}, {}}},
+         makeMatMul, true, false},
+        {"eltwise",
+         {{"add", {{1, 64, 56, 56}, {1, 64, 56, 56}}, {}},
+          {"add_bcast", {{1, 64, 56, 56}, {1, 64, 1, 1}}, {}},
+          {"multiply", {{1, 64, 56, 56}, {1, 64, 56, 56}}, {}},
+          {"sigmoid", {{1, 64, 56, 56}}, {}},
+          {"exp", {{1, 64, 56, 56}}, {}},
+          {"gelu", {{1, 64, 56, 56}}, {}},
+          {"swish", {{1, 64, 56, 56}}, {}}},
+         makeEltwise, false, true},
+        {"reduce",
+         {{"sum_hw", {{1, 256, 56, 56}}, {2, 3}},
+          {"mean_c", {{1, 256, 56, 56}}, {1}},
+          {"max_hw", {{1, 256, 56, 56}}, {2, 3}}},
+         makeReduce, false, true},
+        {"gather",
+         {{"rows", {{4096, 768}}, {0, 512}},
+          {"channels", {{1, 256, 56, 56}}, {1, 64}}},
+         makeGather, false, false},
+        {"mha",
+         {{"s128", {{1, 128, 12, 64}}, {}},
+          {"s384", {{1, 384, 12, 64}}, {}}},
+         makeMHA, false, false},
+        {"interpolate",
+         {{"nearest", {{1, 64, 56, 56}}, {2}},
+          {"linear_onnx", {{1, 64, 56, 56}}, {2}},
+          {"cubic", {{1, 64, 56, 56}}, {2}}},
+         makeInterpolate, false, true},
+    };
+    return benchmarks;
+}
+
+std::vector<BenchmarkCase> generateCases(const std::vector<std::string> &nodes,
+                                         const std::vector<std::string> &precisions,
+                                         const std::vector<std::string> &layouts,
+                                         const std::vector<size_t> &threads) {
+    for (const auto &node : nodes) {
+        const auto &benchmarks = getNodeBenchmarks();
+        if (std::none_of(benchmarks.begin(), benchmarks.end(), [&](const NodeBenchmark &b) { return b.node == node; }))
+            throw std::logic_error("Unknown node " + node);
+    }
+
+    std::vector<BenchmarkCase> cases;
+    for (const auto &benchmark : getNodeBenchmarks()) {
+        if (!nodes.empty() && std::find(nodes.begin(), nodes.end(), benchmark.node) == nodes.end())
+            continue;
+        const auto caseLayouts = benchmark.supportsLayouts ? layouts : std::vector<std::string>{""};
+        for (const auto &variant : benchmark.variants) {
+            for (const auto &precision : precisions) {
+                if (precision == "i8" && !benchmark.supportsInt8)
+                    continue;
+                for (const auto &layout : caseLayouts) {
+                    for (const auto threadsNum : threads)
+                        cases.push_back({benchmark.node, variant, precision, layout, threadsNum});
+                }
+            }
+        }
+    }
+    return cases;
+}
+
+std::shared_ptr<ov::Model> buildModel(const BenchmarkCase &benchmarkCase) {
+    for (const auto &benchmark : getNodeBenchmarks()) {
+        if (benchmark.node != benchmarkCase.node)
+            continue;
+        auto model = benchmark.builder(benchmarkCase.variant, benchmarkCase.precision == "i8");
+        return applyLayout(model, benchmarkCase.layout);
+    }
+    throw std::logic_error("Unknown node " + benchmarkCase.node);
+}
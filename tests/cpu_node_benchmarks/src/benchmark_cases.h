@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/openvino.hpp>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Shapes and operation specific parameters of a single benchmarked graph
+ */
+struct Variant {
+    std::string name;
+    std::vector<ov::Shape> shapes;
+    std::vector<int64_t> params;
+};
+
+/**
+ * @brief Single point of the benchmark sweep
+ */
+struct BenchmarkCase {
+    std::string node;
+    Variant variant;
+    std::string precision;
+    // layout of the 4D input tensors, empty for the nodes without the layout sweep
+    std::string layout;
+    // 0 means all the available cores
+    size_t threads;
+
+    /**
+     * @brief Returns the case identifier used to match the results of different builds
+     */
+    std::string name() const;
+};
+
+/**
+ * @brief Description of a benchmarked node: the graph builder and the sweep dimensions it supports
+ */
+struct NodeBenchmark {
+    std::string node;
+    std::vector<Variant> variants;
+    // builds a single-op graph, FakeQuantize operations are inserted on the inputs for i8 precision
+    std::function<std::shared_ptr<ov::Model>(const Variant &, bool quantized)> builder;
+    bool supportsInt8;
+    bool supportsLayouts;
+};
+
+/**
+ * @brief Returns all the known node benchmarks
+ */
+const std::vector<NodeBenchmark> &getNodeBenchmarks();
+
+/**
+ * @brief Builds the cartesian product of the requested sweep dimensions
+ * Combinations the node doesn't support (e.g. i8 eltwise) are not generated.
+ */
+std::vector<BenchmarkCase> generateCases(const std::vector<std::string> &nodes,
+                                         const std::vector<std::string> &precisions,
+                                         const std::vector<std::string> &layouts,
+                                         const std::vector<size_t> &threads);
+
+/**
+ * @brief Builds the graph of the case, the benchmarked operation is named "bench"
+ */
+std::shared_ptr<ov::Model> buildModel(const BenchmarkCase &benchmarkCase);
@@ -0,0 +1,186 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "benchmark_runner.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+const char benchmarkedNodeName[] = "bench";
+
+DurationStats aggregate(std::vector<double> durations) {
+    DurationStats stats;
+    if (durations.empty())
+        return stats;
+    std::sort(durations.begin(), durations.end());
+    const size_t size = durations.size();
+    stats.median = size % 2 ? durations[size / 2] : (durations[size / 2 - 1] + durations[size / 2]) / 2;
+    stats.min = durations.front();
+    stats.mean = std::accumulate(durations.begin(), durations.end(), 0.0) / size;
+    return stats;
+}
+
+/**
+ * @brief Fills the inputs with reproducible random values in [0, 10)
+ */
+void fillInputs(ov::InferRequest &request, const ov::CompiledModel &compiledModel) {
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distribution(0.f, 10.f);
+    for (const auto &input : compiledModel.inputs()) {
+        ov::Tensor tensor(input.get_element_type(), input.get_shape());
+        if (input.get_element_type() == ov::element::f32) {
+            auto data = tensor.data<float>();
+            for (size_t i = 0; i < tensor.get_size(); ++i)
+                data[i] = distribution(generator);
+        } else {
+            std::fill_n(static_cast<uint8_t *>(tensor.data()), tensor.get_byte_size(), 0);
+        }
+        request.set_tensor(input, tensor);
+    }
+}
+
+ov::AnyMap makeConfig(const BenchmarkCase &benchmarkCase) {
+    ov::AnyMap config;
+    // int8 execution is driven by the FakeQuantize operations in the graph, the rest is computed in f32
+    config.emplace(ov::hint::inference_precision(benchmarkCase.precision == "bf16" ? ov::element::bf16
+                                                                                   : ov::element::f32));
+    config.emplace(ov::num_streams(1));
+    if (benchmarkCase.threads)
+        config.emplace(ov::inference_num_threads(static_cast<int>(benchmarkCase.threads)));
+    config.emplace(ov::enable_profiling(true));
+    return config;
+}
+
+std::string escape(const std::string &value) {
+    std::stringstream escaped;
+    for (const char c : value) {
+        switch (c) {
+        case '"':
+            escaped << "\\\"";
+            break;
+        case '\\':
+            escaped << "\\\\";
+            break;
+        case '\n':
+            escaped << "\\n";
+            break;
+        case '\t':
+            escaped << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20)
+                escaped << ' ';
+            else
+                escaped << c;
+        }
+    }
+    return escaped.str();
+}
+
+std::string shapesToString(const std::vector<ov::Shape> &shapes) {
+    std::stringstream result;
+    for (size_t i = 0; i < shapes.size(); ++i) {
+        if (i)
+            result << ";";
+        for (size_t j = 0; j < shapes[i].size(); ++j) {
+            if (j)
+                result << "x";
+            result << shapes[i][j];
+        }
+    }
+    return result.str();
+}
+
+void writeStats(std::ostream &out, const DurationStats &stats) {
+    out << "{\"median\": " << stats.median << ", \"min\": " << stats.min << ", \"mean\": " << stats.mean << "}";
+}
+}  // namespace
+
+BenchmarkResult runBenchmark(ov::Core &core, const std::string &device, const BenchmarkCase &benchmarkCase,
+                             size_t niter, size_t nwarmup) {
+    BenchmarkResult result;
+    result.benchmarkCase = benchmarkCase;
+
+    ov::CompiledModel compiledModel;
+    try {
+        compiledModel = core.compile_model(buildModel(benchmarkCase), device, makeConfig(benchmarkCase));
+    } catch (const std::exception &ex) {
+        result.status = "skipped";
+        result.error = ex.what();
+        return result;
+    }
+
+    auto request = compiledModel.create_infer_request();
+    fillInputs(request, compiledModel);
+    for (size_t i = 0; i < nwarmup; ++i)
+        request.infer();
+
+    std::vector<double> latencies;
+    std::vector<double> nodeTimes;
+    for (size_t i = 0; i < niter; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        request.infer();
+        const auto end = std::chrono::steady_clock::now();
+        latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+
+        for (const auto &info : request.get_profiling_info()) {
+            if (info.node_name != benchmarkedNodeName || info.status != ov::ProfilingInfo::Status::EXECUTED)
+                continue;
+            nodeTimes.push_back(static_cast<double>(info.real_time.count()));
+            result.execType = info.exec_type;
+        }
+    }
+
+    result.status = "ok";
+    result.latency = aggregate(latencies);
+    result.nodeTime = aggregate(nodeTimes);
+    return result;
+}
+
+void writeResults(const std::string &path, const std::string &device, size_t niter,
+                  const std::vector<BenchmarkResult> &results) {
+    std::ofstream out(path);
+    if (!out.good())
+        throw std::runtime_error("Results file \"" + path + "\" can't be used for writing");
+
+    out << "{\n";
+    out << "  \"device\": \"" << escape(device) << "\",\n";
+    out << "  \"version\": \"" << escape(ov::get_openvino_version().buildNumber) << "\",\n";
+    out << "  \"niter\": " << niter << ",\n";
+    out << "  \"results\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const auto &result = results[i];
+        const auto &benchmarkCase = result.benchmarkCase;
+        out << (i ? ",\n" : "\n") << "    {";
+        out << "\"name\": \"" << escape(benchmarkCase.name()) << "\", ";
+        out << "\"node\": \"" << benchmarkCase.node << "\", ";
+        out << "\"variant\": \"" << escape(benchmarkCase.variant.name) << "\", ";
+        out << "\"shapes\": \"" << shapesToString(benchmarkCase.variant.shapes) << "\", ";
+        out << "\"precision\": \"" << benchmarkCase.precision << "\", ";
+        out << "\"layout\": \"" << benchmarkCase.layout << "\", ";
+        out << "\"threads\": " << benchmarkCase.threads << ", ";
+        out << "\"status\": \"" << result.status << "\"";
+        if (result.status != "ok") {
+            out << ", \"error\": \"" << escape(result.error) << "\"}";
+            continue;
+        }
+        out << ", \"exec_type\": \"" << escape(result.execType) << "\", ";
+        out << "\"latency_us\": ";
+        writeStats(out, result.latency);
+        out << ", \"node_time_us\": ";
+        // the node may be missing in the performance counters if the plugin fused it into a differently named one
+        if (result.execType.empty())
+            out << "null";
+        else
+            writeStats(out, result.nodeTime);
+        out << "}";
+    }
+    out << "\n  ]\n}\n";
+}
@@ -0,0 +1,47 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "benchmark_cases.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Aggregated durations of the measured iterations in microseconds
+ */
+struct DurationStats {
+    double median = 0;
+    double min = 0;
+    double mean = 0;
+};
+
+/**
+ * @brief Outcome of a single benchmark case
+ */
+struct BenchmarkResult {
+    BenchmarkCase benchmarkCase;
+    // "ok", or "skipped" when the case can't be compiled on the device (e.g. bf16 without avx512)
+    std::string status;
+    std::string error;
+    // implementation type the plugin selected for the benchmarked node, e.g. jit_avx512_FP32
+    std::string execType;
+    // wall time of the whole inference including the pre- and post-processing of the plugin
+    DurationStats latency;
+    // execution time of the benchmarked node reported by the performance counters
+    DurationStats nodeTime;
+};
+
+/**
+ * @brief Compiles the graph of the case and measures it
+ */
+BenchmarkResult runBenchmark(ov::Core &core, const std::string &device, const BenchmarkCase &benchmarkCase,
+                             size_t niter, size_t nwarmup);
+
+/**
+ * @brief Writes the results in JSON format
+ */
+void writeResults(const std::string &path, const std::string &device, size_t niter,
+                  const std::vector<BenchmarkResult> &results);
@@ -0,0 +1,108 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <gflags/gflags.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/// @brief message for help argument
+static const char help_message[] =
+        "Print a usage message.";
+
+/// @brief message for target device argument
+static const char target_device_message[] =
+        "Optional. Specify a target device to run the benchmarks on. Default value is CPU.";
+
+/// @brief message for nodes argument
+static const char nodes_message[] =
+        "Optional. Comma separated list of the benchmarked nodes. \n"
+        "Supported values: conv, fc, matmul, eltwise, reduce, gather, mha, interpolate. All the nodes by default.";
+
+/// @brief message for precisions argument
+static const char precisions_message[] =
+        "Optional. Comma separated list of the inference precisions. \n"
+        "Supported values: f32, bf16, i8. Default value is f32,bf16,i8. \n"
+        "The cases not supported by the platform or by the node are reported as skipped.";
+
+/// @brief message for layouts argument
+static const char layouts_message[] =
+        "Optional. Comma separated list of the input tensor layouts for the nodes with 4D data input. \n"
+        "Supported values: NCHW, NHWC. Default value is NCHW,NHWC.";
+
+/// @brief message for threads argument
+static const char threads_message[] =
+        "Optional. Comma separated list of the number of threads, 0 means all the available cores. \n"
+        "Default value is 1,0.";
+
+/// @brief message for iterations argument
+static const char niter_message[] =
+        "Optional. Number of the measured inferences per case. Default value is 100.";
+
+/// @brief message for warm up iterations argument
+static const char nwarmup_message[] =
+        "Optional. Number of the inferences excluded from the statistics per case. Default value is 10.";
+
+/// @brief message for statistics path argument
+static const char statistics_path_message[] =
+        "Required. Path to a file to write the results in JSON format.";
+
+/// @brief Define flag for showing help message <br>
+DEFINE_bool(h, false, help_message);
+
+/// @brief Declare flag for showing help message <br>
+DECLARE_bool(help);
+
+/// @brief Define parameter for set target device <br>
+/// It is a non-required parameter
+DEFINE_string(d, "CPU", target_device_message);
+
+/// @brief Define parameter for set benchmarked nodes <br>
+/// It is a non-required parameter
+DEFINE_string(nodes, "", nodes_message);
+
+/// @brief Define parameter for set inference precisions <br>
+/// It is a non-required parameter
+DEFINE_string(precisions, "f32,bf16,i8", precisions_message);
+
+/// @brief Define parameter for set input tensor layouts <br>
+/// It is a non-required parameter
+DEFINE_string(layouts, "NCHW,NHWC", layouts_message);
+
+/// @brief Define parameter for set numbers of threads <br>
+/// It is a non-required parameter
+DEFINE_string(threads, "1,0", threads_message);
+
+/// @brief Define parameter for set number of measured iterations <br>
+/// It is a non-required parameter
+DEFINE_uint32(niter, 100, niter_message);
+
+/// @brief Define parameter for set number of warm up iterations <br>
+/// It is a non-required parameter
+DEFINE_uint32(nwarmup, 10, nwarmup_message);
+
+/// @brief Define parameter for set path to a file to write statistics <br>
+/// It is a required parameter
+DEFINE_string(s, "", statistics_path_message);
+
+/**
+ * @brief This function show a help message
+ */
+static void showUsage() {
+    std::cout << std::endl;
+    std::cout << "CpuNodeBenchmark [OPTION]" << std::endl;
+    std::cout << "Options:" << std::endl;
+    std::cout << std::endl;
+    std::cout << "    -h, --help           " << help_message << std::endl;
+    std::cout << "    -s \"<path>\"        " << statistics_path_message << std::endl;
+    std::cout << "    -d \"<device>\"      " << target_device_message << std::endl;
+    std::cout << "    -nodes               " << nodes_message << std::endl;
+    std::cout << "    -precisions          " << precisions_message << std::endl;
+    std::cout << "    -layouts             " << layouts_message << std::endl;
+    std::cout << "    -threads             " << threads_message << std::endl;
+    std::cout << "    -niter               " << niter_message << std::endl;
+    std::cout << "    -nwarmup             " << nwarmup_message << std::endl;
+}
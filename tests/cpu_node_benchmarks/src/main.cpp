@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "cli.h"
+#include "benchmark_cases.h"
+#include "benchmark_runner.h"
+
+#include <iostream>
+#include <sstream>
+
+
+/**
+ * @brief Splits comma separated list
+ */
+std::vector<std::string> split(const std::string &value) {
+    std::vector<std::string> items;
+    std::stringstream stream(value);
+    std::string item;
+    while (std::getline(stream, item, ','))
+        if (!item.empty())
+            items.push_back(item);
+    return items;
+}
+
+/**
+ * @brief Parses command line and check required arguments
+ */
+bool parseAndCheckCommandLine(int argc, char **argv) {
+    gflags::ParseCommandLineNonHelpFlags(&argc, &argv, true);
+    if (FLAGS_help || FLAGS_h) {
+        showUsage();
+        return false;
+    }
+
+    if (FLAGS_s.empty())
+        throw std::logic_error(
+                "Statistics file path is required but not set. Please set -s option.");
+
+    for (const auto &precision : split(FLAGS_precisions))
+        if (precision != "f32" && precision != "bf16" && precision != "i8")
+            throw std::logic_error("Unsupported precision " + precision + ". Please check -precisions option.");
+
+    for (const auto &layout : split(FLAGS_layouts))
+        if (layout != "NCHW" && layout != "NHWC")
+            throw std::logic_error("Unsupported layout " + layout + ". Please check -layouts option.");
+
+    return true;
+}
+
+/**
+ * @brief Main entry point
+ */
+int main(int argc, char **argv) {
+    try {
+        if (!parseAndCheckCommandLine(argc, argv))
+            return -1;
+
+        std::vector<size_t> threads;
+        for (const auto &value : split(FLAGS_threads))
+            threads.push_back(std::stoul(value));
+
+        const auto cases = generateCases(split(FLAGS_nodes), split(FLAGS_precisions), split(FLAGS_layouts), threads);
+
+        ov::Core core;
+        std::vector<BenchmarkResult> results;
+        for (const auto &benchmarkCase : cases) {
+            results.push_back(runBenchmark(core, FLAGS_d, benchmarkCase, FLAGS_niter, FLAGS_nwarmup));
+            const auto &result = results.back();
+            std::cout << benchmarkCase.name() << ": " << result.status;
+            if (result.status == "ok")
+                std::cout << ", latency " << result.latency.median << "us, node " << result.nodeTime.median << "us "
+                          << result.execType;
+            std::cout << std::endl;
+        }
+
+        writeResults(FLAGS_s, FLAGS_d, FLAGS_niter, results);
+    } catch (const std::exception &ex) {
+        std::cerr << ex.what() << std::endl;
+        return -1;
+    }
+    return 0;
+}
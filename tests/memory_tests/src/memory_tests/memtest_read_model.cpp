@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <openvino/runtime/core.hpp>
+
+#include "memory_tests_helper/memory_counter.h"
+#include "memory_tests_helper/utils.h"
+
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ * The pipeline only reads the model, so vmhwm of the read_network step is the
+ * peak memory of the model deserialization without any plugin loaded.
+ */
+int runPipeline(const std::string &model, const std::string &device,
+                std::map<std::string, ov::PartialShape> reshapeShapes,
+                std::map<std::string, std::vector<size_t>> dataShapes) {
+    auto pipeline = [](const std::string &model) {
+        ov::Core ie;
+        std::shared_ptr<ov::Model> cnnNetwork;
+        MEMORY_SNAPSHOT(create_core);
+
+        cnnNetwork = ie.read_model(model);
+        MEMORY_SNAPSHOT(read_network);
+
+        cnnNetwork.reset();
+        MEMORY_SNAPSHOT(release_network);
+    };
+
+    try {
+        pipeline(model);
+    } catch (const InferenceEngine::Exception &iex) {
+        std::cerr
+                << "Inference Engine pipeline failed with Inference Engine exception:\n"
+                << iex.what();
+        return 1;
+    } catch (const std::exception &ex) {
+        std::cerr << "Inference Engine pipeline failed with exception:\n"
+                  << ex.what();
+        return 2;
+    } catch (...) {
+        std::cerr << "Inference Engine pipeline failed\n";
+        return 3;
+    }
+    return 0;
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <openvino/runtime/core.hpp>
+
+#include "timetests_helper/timer.h"
+#include "timetests_helper/utils.h"
+
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ * The pipeline only reads the model to measure the startup time of the frontends
+ * isolated from the compilation of the model.
+ */
+int runPipeline(const std::string &model, const std::string &device, const bool isCacheEnabled,
+                std::map<std::string, ov::PartialShape> reshapeShapes,
+                std::map<std::string, std::vector<size_t>> dataShapes) {
+    auto pipeline = [](const std::string &model) {
+        ov::Core ie;
+        std::shared_ptr<ov::Model> cnnNetwork;
+        {
+            SCOPED_TIMER(read_network);
+            cnnNetwork = ie.read_model(model);
+        }
+        {
+            SCOPED_TIMER(release_network);
+            cnnNetwork.reset();
+        }
+    };
+
+    try {
+        pipeline(model);
+    } catch (const ov::Exception &iex) {
+        std::cerr
+                << "Inference Engine pipeline failed with Inference Engine exception:\n"
+                << iex.what();
+        return 1;
+    } catch (const std::exception &ex) {
+        std::cerr << "Inference Engine pipeline failed with exception:\n"
+                  << ex.what();
+        return 2;
+    } catch (...) {
+        std::cerr << "Inference Engine pipeline failed\n";
+        return 3;
+    }
+    return 0;
+}
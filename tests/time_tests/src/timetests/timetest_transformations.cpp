@@ -0,0 +1,93 @@
+// Copyright (C) 2018-2022 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <openvino/runtime/core.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/op/util/binary_elementwise_arithmetic.hpp>
+#include <openvino/op/util/unary_elementwise_arithmetic.hpp>
+#include <openvino/pass/graph_rewrite.hpp>
+#include <openvino/pass/pattern/op/label.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+
+#include "timetests_helper/timer.h"
+#include "timetests_helper/utils.h"
+
+
+namespace {
+/**
+ * @brief Builds GraphRewrite with the matchers shaped as the ones of the large merged passes: a matcher per
+ * operation type of the opset, matchers with the parent type roots and matchers with the `any_input` and
+ * predicate only roots. The callbacks don't change the model, so only the matchers dispatch and matching is measured.
+ */
+std::shared_ptr<ov::pass::GraphRewrite> createMatchers() {
+    auto rewrite = std::make_shared<ov::pass::GraphRewrite>();
+    auto callback = [](ov::pass::pattern::Matcher &) {
+        return false;
+    };
+    auto addMatcher = [&](const std::shared_ptr<ov::Node> &root, const std::string &name) {
+        auto matcher = std::make_shared<ov::pass::pattern::Matcher>(root, name);
+        rewrite->add_matcher(std::make_shared<ov::pass::MatcherPass>(matcher, callback));
+    };
+
+    for (const auto &type_info : ov::get_opset8().get_types_info()) {
+        auto input = ov::pass::pattern::any_input(ov::pass::pattern::has_static_rank());
+        addMatcher(std::make_shared<ov::pass::pattern::op::WrapType>(type_info, ov::pass::pattern::consumers_count(1),
+                                                                     ov::OutputVector{input}),
+                   std::string(type_info.name) + "Matcher");
+    }
+    addMatcher(ov::pass::pattern::wrap_type<ov::op::util::BinaryElementwiseArithmetic>(),
+               "BinaryElementwiseArithmeticMatcher");
+    addMatcher(ov::pass::pattern::wrap_type<ov::op::util::UnaryElementwiseArithmetic>(),
+               "UnaryElementwiseArithmeticMatcher");
+    addMatcher(ov::pass::pattern::any_input(), "AnyInputMatcher");
+    addMatcher(ov::pass::pattern::any_input(ov::pass::pattern::consumers_count(2)), "PredicateMatcher");
+    return rewrite;
+}
+}  // namespace
+
+/**
+ * @brief Function that contain executable pipeline which will be called from
+ * main(). The function should not throw any exceptions and responsible for
+ * handling it by itself.
+ * The pipeline measures the transformations of the read model: the matchers dispatch of
+ * GraphRewrite isolated from the passes logic and the compilation of the model, which
+ * time is dominated by the plugin transformations for the large models.
+ */
+int runPipeline(const std::string &model, const std::string &device, const bool isCacheEnabled,
+                std::map<std::string, ov::PartialShape> reshapeShapes,
+                std::map<std::string, std::vector<size_t>> dataShapes) {
+    auto pipeline = [](const std::string &model, const std::string &device) {
+        ov::Core ie;
+        std::shared_ptr<ov::Model> cnnNetwork;
+        ov::CompiledModel exeNetwork;
+        {
+            SCOPED_TIMER(read_network);
+            cnnNetwork = ie.read_model(model);
+        }
+        {
+            SCOPED_TIMER(matchers_dispatch);
+            createMatchers()->run_on_model(cnnNetwork);
+        }
+        {
+            SCOPED_TIMER(load_network);
+            exeNetwork = ie.compile_model(cnnNetwork, device);
+        }
+    };
+
+    try {
+        pipeline(model, device);
+    } catch (const ov::Exception &iex) {
+        std::cerr
+                << "Inference Engine pipeline failed with Inference Engine exception:\n"
+                << iex.what();
+        return 1;
+    } catch (const std::exception &ex) {
+        std::cerr << "Inference Engine pipeline failed with exception:\n"
+                  << ex.what();
+        return 2;
+    } catch (...) {
+        std::cerr << "Inference Engine pipeline failed\n";
+        return 3;
+    }
+    return 0;
+}